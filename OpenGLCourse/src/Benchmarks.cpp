@@ -0,0 +1,1571 @@
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <thread>
+#include "Benchmarks.h"
+#include "GLStateCache.h"
+#include "Shader.h"
+#include "ShaderBatch.h"
+#include "Headless.h"
+#include "TextureManager.h"
+#include "BlockEncoder.h"
+#include "SpriteBatch.h"
+#include "Std140.h"
+#include "StreamBuffer.h"
+#include "UniformBuffer.h"
+#include "VertexFormat.h"
+#include "InstancedMesh.h"
+#include "LodMesh.h"
+#include "JobSystem.h"
+#include "MeshOptimizer.h"
+#include "RenderQueue.h"
+#include "SceneBounds.h"
+#include "Util.h"
+#include "stb_image.h"
+
+// scene helpers shared by the benchmarks
+static unsigned int createQuadVertexArray(unsigned int* buffers);
+static void createBumpySphere(int rings, int segments, std::vector<float>& vertices, std::vector<unsigned int>& indices);
+
+// 1M vec4 uniform updates spread over the 4 uniforms of vshader_uniforms.glsl: with a glGetUniformLocation query per
+// call (what Shader::SetFloat4 did before the uniform table), by name through the table, and through handles
+// resolved once; prints ns per update
+// ---------------------------------------------------------------------------------------------------------
+void runUniformLookupBenchmark()
+{
+	const int UPDATE_COUNT = 1000000;
+	const char* names[] = { "u_Camera", "u_Time", "u_Transform", "u_Tint" };
+
+	Shader shader("src/assets/shaders/vshader_uniforms.glsl", "src/assets/shaders/fshader_color.glsl");
+	UniformHandle handles[4];
+	for (int i = 0; i < 4; i++)
+		handles[i] = shader.GetUniform(names[i]);
+	shader.Bind();
+
+	auto measure = [&](const char* label, int method) {
+		glFinish();
+		double start = NowMs();
+		for (int i = 0; i < UPDATE_COUNT; i++)
+		{
+			vector4 value = { (float)i, 0.5f, 0.25f, 1.0f };
+			if (method == 0)
+			{
+				std::string name = names[i & 3];
+				int location = glGetUniformLocation(shader.GetID(), name.c_str());
+				glUniform4f(location, value.x, value.y, value.z, value.w);
+			}
+			else if (method == 1)
+				shader.SetFloat4(names[i & 3], value);
+			else
+				shader.Set(handles[i & 3], value);
+		}
+		glFinish();
+		double ms = NowMs() - start;
+		std::cout << "  " << std::setw(22) << std::left << label << std::right << std::setw(8) << ms * 1e6 / UPDATE_COUNT << " ns per update, "
+			<< std::setw(8) << ms << " ms total" << std::endl;
+	};
+
+	FixedFormat outputFormat(std::cout, 1);
+	std::cout << "Uniform lookup benchmark, " << UPDATE_COUNT << " updates:" << std::endl;
+	measure("glGetUniformLocation", 0);
+	measure("by name (table)", 1);
+	measure("handle", 2);
+}
+
+// decode every JPEG in src/assets/textures (add files there to widen the corpus) on one thread with each kernel set
+// of stb_image: plain C, SSE2 and AVX2 (a set the CPU lacks falls back to the one below); prints MB/s of decoded
+// pixels and the largest difference to the plain C output
+// ---------------------------------------------------------------------------------------------------------
+void runJpegBenchmark()
+{
+	const double MIN_MS = 200.0;  // decoding time per file and kernel set
+
+	std::vector<std::vector<char>> files;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("src/assets/textures"))
+	{
+		std::string extension = entry.path().extension().string();
+		if (extension != ".jpg" && extension != ".jpeg")
+			continue;
+		std::ifstream file(entry.path(), std::ios::binary);
+		files.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	if (files.empty())
+	{
+		std::cout << "ERROR::JPEG_BENCHMARK::NO_FILES in src/assets/textures" << std::endl;
+		return;
+	}
+
+	const char* names[] = { "plain C", "SSE2", "AVX2" };
+	std::vector<std::vector<unsigned char>> reference(files.size());
+	stbi_set_jpeg_threads(1);
+	FixedFormat outputFormat(std::cout, 1);
+	std::cout << "JPEG benchmark, " << files.size() << " files, one thread:" << std::endl;
+	for (int level = 0; level < 3; level++)
+	{
+		stbi_set_jpeg_kernels(level);
+		double ms = 0.0, bytes = 0.0;
+		int maxDifference = 0;
+		bool failed = false;
+		for (size_t i = 0; i < files.size() && !failed; i++)
+		{
+			double start = NowMs();
+			do
+			{
+				int width, height, channels;
+				unsigned char* data = stbi_load_from_memory((const stbi_uc*)files[i].data(), (int)files[i].size(), &width, &height, &channels, 0);
+				if (!data)
+				{
+					failed = true;
+					break;
+				}
+				size_t size = (size_t)width * height * channels;
+				if (reference[i].empty())
+					reference[i].assign(data, data + size);
+				for (size_t byte = 0; byte < size; byte++)
+					maxDifference = std::max(maxDifference, std::abs(data[byte] - reference[i][byte]));
+				bytes += size;
+				stbi_image_free(data);
+			} while (NowMs() - start < MIN_MS);
+			ms += NowMs() - start;
+		}
+		if (failed)
+			std::cout << "  " << std::setw(8) << std::left << names[level] << std::right << " failed: " << stbi_failure_reason() << std::endl;
+		else
+			std::cout << "  " << std::setw(8) << std::left << names[level] << std::right << std::setw(8) << bytes / 1e3 / ms << " MB/s, max difference to plain C "
+				<< maxDifference << std::endl;
+	}
+	stbi_set_jpeg_kernels(2);
+	stbi_set_jpeg_threads(0);
+}
+
+// 2048 x 2048 RGB and RGBA images (gradients plus noise) encoded with each PNG filter type into uncompressed zlib
+// blocks, so unfiltering dominates the decode, decoded with the scalar and the SIMD unfilter loops; prints MB/s of
+// decoded pixels for both and whether the output matches the source image
+// ---------------------------------------------------------------------------------------------------------
+void runPngBenchmark()
+{
+	const int SIZE = 2048;
+	const double MIN_MS = 150.0;  // decoding time per image and unfilter path
+	const char* filterNames[] = { "None", "Sub", "Up", "Average", "Paeth" };
+	XorShift32 random;
+
+	FixedFormat outputFormat(std::cout, 1);
+	std::cout << "PNG unfilter benchmark, " << SIZE << " x " << SIZE << " images, MB/s scalar / SIMD:" << std::endl;
+	for (int channels = 3; channels <= 4; channels++)
+	{
+		std::vector<unsigned char> pixels((size_t)SIZE * SIZE * channels);
+		for (int y = 0; y < SIZE; y++)
+			for (int x = 0; x < SIZE; x++)
+				for (int c = 0; c < channels; c++)
+					pixels[((size_t)y * SIZE + x) * channels + c] = (unsigned char)((x * (c + 1) + y * (3 - c)) / 16 + (random.Next() & 15));
+
+		for (int filter = 1; filter <= 4; filter++)
+		{
+			std::vector<unsigned char> png = EncodePNG(SIZE, SIZE, channels, pixels.data(), filter);
+			double mbPerS[2] = {};
+			bool matches = true;
+			for (int simd = 0; simd < 2; simd++)
+			{
+				stbi_set_png_simd(simd);
+				double start = NowMs(), bytes = 0.0;
+				do
+				{
+					int width, height, fileChannels;
+					unsigned char* data = stbi_load_from_memory(png.data(), (int)png.size(), &width, &height, &fileChannels, 0);
+					matches = matches && data && std::memcmp(data, pixels.data(), pixels.size()) == 0;
+					bytes += pixels.size();
+					stbi_image_free(data);
+				} while (NowMs() - start < MIN_MS);
+				mbPerS[simd] = bytes / 1e3 / (NowMs() - start);
+			}
+			std::cout << "  " << (channels == 4 ? "RGBA " : "RGB  ") << std::setw(8) << std::left << filterNames[filter] << std::right << std::setw(8) << mbPerS[0]
+				<< " / " << std::setw(7) << mbPerS[1] << (matches ? "" : "  OUTPUT MISMATCH") << std::endl;
+		}
+	}
+	stbi_set_png_simd(1);
+}
+
+// inflate the image data (IDAT zlib streams) of every PNG in src/assets/textures with the fast loop of stb_image's
+// inflate and with the symbol-at-a-time decoder alone; prints MB/s of inflated data and whether both agree
+// ---------------------------------------------------------------------------------------------------------
+void runInflateBenchmark()
+{
+	const double MIN_MS = 200.0;  // inflating time per file and decoder
+
+	// the concatenated IDAT chunks of a PNG file form one zlib stream
+	std::vector<std::string> names;
+	std::vector<std::vector<char>> streams;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("src/assets/textures"))
+	{
+		if (entry.path().extension().string() != ".png")
+			continue;
+		std::ifstream file(entry.path(), std::ios::binary);
+		std::vector<unsigned char> png((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		std::vector<char> stream;
+		for (size_t offset = 8; offset + 12 <= png.size(); )
+		{
+			size_t length = (size_t)png[offset] << 24 | png[offset + 1] << 16 | png[offset + 2] << 8 | png[offset + 3];
+			if (length > png.size() - offset - 12)
+				break;
+			if (std::memcmp(&png[offset + 4], "IDAT", 4) == 0)
+				stream.insert(stream.end(), &png[offset + 8], &png[offset + 8] + length);
+			offset += length + 12;
+		}
+		names.push_back(entry.path().filename().string());
+		streams.push_back(stream);
+	}
+	if (streams.empty())
+	{
+		std::cout << "ERROR::INFLATE_BENCHMARK::NO_FILES in src/assets/textures" << std::endl;
+		return;
+	}
+
+	FixedFormat outputFormat(std::cout, 1);
+	std::cout << "Inflate benchmark, MB/s symbol at a time / fast loop:" << std::endl;
+	for (size_t i = 0; i < streams.size(); i++)
+	{
+		double mbPerS[2] = {};
+		std::vector<char> outputs[2];
+		for (int fast = 0; fast < 2; fast++)
+		{
+			stbi_set_zlib_fast(fast);
+			double start = NowMs(), bytes = 0.0;
+			do
+			{
+				int length = 0;
+				char* data = stbi_zlib_decode_malloc(streams[i].data(), (int)streams[i].size(), &length);
+				if (!data)
+					break;
+				if (outputs[fast].empty())
+					outputs[fast].assign(data, data + length);
+				bytes += length;
+				free(data);
+			} while (NowMs() - start < MIN_MS);
+			mbPerS[fast] = bytes / 1e3 / (NowMs() - start);
+		}
+		bool matches = !outputs[0].empty() && outputs[0] == outputs[1];
+		std::cout << "  " << std::setw(20) << std::left << names[i] << std::right << std::setw(6) << streams[i].size() / 1024 << " KiB -> "
+			<< std::setw(6) << outputs[1].size() / 1024 << " KiB " << std::setw(8) << mbPerS[0] << " / " << std::setw(7) << mbPerS[1]
+			<< (matches ? "" : "  OUTPUT MISMATCH") << std::endl;
+	}
+	stbi_set_zlib_fast(1);
+}
+
+// load N textures (cycling through the sample assets) the old way, stbi_load + glTexImage2D inline, and through
+// the TextureManager driven by simulated 60 Hz frames; prints total time and the longest stall a frame would see
+// ---------------------------------------------------------------------------------------------------------
+void runTextureBenchmark(int count)
+{
+	const char* paths[] = { "src/assets/textures/container.jpg", "src/assets/textures/awesomeface.png" };
+
+	// serial: everything happens on the render thread before the first frame
+	std::vector<unsigned int> serialTextures(count);
+	double start = NowMs();
+	stbi_set_flip_vertically_on_load(true);
+	for (int i = 0; i < count; i++)
+	{
+		int width, height, channels;
+		unsigned char* data = stbi_load(paths[i % 2], &width, &height, &channels, 0);
+		glGenTextures(1, &serialTextures[i]);
+		GLStateCache::Get().BindTexture(0, serialTextures[i]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		if (data)
+		{
+			GLenum format = channels == 4 ? GL_RGBA : GL_RGB;
+			glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+			glGenerateMipmap(GL_TEXTURE_2D);
+		}
+		stbi_image_free(data);
+	}
+	glFinish();
+	double serialMs = NowMs() - start;
+	glDeleteTextures(count, serialTextures.data());
+	for (unsigned int texture : serialTextures)
+		GLStateCache::Get().ForgetTexture(texture);
+
+	// streamed: one Update() per simulated 60 Hz frame until every texture is resident
+	int frames = 0;
+	start = NowMs();
+	{
+		TextureManager textures;
+		for (int i = 0; i < count; i++)
+			textures.Load(paths[i % 2]);
+		while (textures.GetStats().resident + textures.GetStats().failed < count)
+		{
+			double frameStart = NowMs();
+			textures.Update();
+			frames++;
+			double frameLeft = 1000.0 / 60.0 - (NowMs() - frameStart);
+			if (frameLeft > 0.0)
+				std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(frameLeft));
+		}
+		glFinish();
+		double streamedMs = NowMs() - start;
+
+		std::cout << "Texture benchmark, " << count << " textures:" << std::endl;
+		std::cout << "  serial:   " << serialMs << " ms blocking the render thread" << std::endl;
+		std::cout << "  streamed: " << streamedMs << " ms over " << frames << " frames, longest frame stall "
+			<< textures.GetStats().maxUpdateMs << " ms" << std::endl;
+		std::cout << "  ";
+		textures.PrintStats();
+	}
+}
+
+// draw 10k, 100k and 1M small sprites with random positions and textures through the SpriteBatch, in submission order
+// and sorted by texture, plus 10k sprites with one draw call each for comparison; prints sprites per second (CPU + GPU)
+// ---------------------------------------------------------------------------------------------------------
+void runSpriteBenchmark(int width, int height)
+{
+	const int TEXTURE_COUNT = 24; // more than the 16 sampler slots, so submission order has to split draw calls
+	const int SPRITE_SIZE = 8;
+
+	Shader spriteShader("src/assets/shaders/vshader_sprite.glsl", "src/assets/shaders/fshader_sprite.glsl");
+	SpriteBatch batch(spriteShader, (float)width, (float)height);
+
+	// small solid color textures
+	std::vector<unsigned int> textures(TEXTURE_COUNT);
+	glGenTextures(TEXTURE_COUNT, textures.data());
+	for (int i = 0; i < TEXTURE_COUNT; i++)
+	{
+		unsigned char pixel[4] = { (unsigned char)(i * 40), (unsigned char)(255 - i * 10), (unsigned char)(i * 90), 255 };
+		std::vector<unsigned char> pixels(SPRITE_SIZE * SPRITE_SIZE * 4);
+		for (size_t p = 0; p < pixels.size(); p++)
+			pixels[p] = pixel[p % 4];
+		GLStateCache::Get().BindTexture(0, textures[i]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, SPRITE_SIZE, SPRITE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+	}
+
+	// random sprites, generated up front so only the batch is timed
+	struct BenchSprite { float x, y; unsigned int texture; };
+	std::vector<BenchSprite> sprites(1000000);
+	XorShift32 random;
+	for (BenchSprite& sprite : sprites)
+		sprite = BenchSprite{ (float)(random.Next() % (width - SPRITE_SIZE)), (float)(random.Next() % (height - SPRITE_SIZE)), textures[random.Next() % TEXTURE_COUNT] };
+
+	// sprites per second over enough frames to draw about two million sprites, and the draw calls of one frame
+	auto measure = [&](int count, SpriteSortMode sortMode, bool drawCallPerSprite, int& drawCalls) {
+		int frames = std::max(2, 2000000 / count);
+		glFinish();
+		double start = NowMs();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			glClear(GL_COLOR_BUFFER_BIT);
+			drawCalls = 0;
+			batch.Begin(sortMode);
+			for (int i = 0; i < count; i++)
+			{
+				batch.Draw(sprites[i].texture, sprites[i].x, sprites[i].y, (float)SPRITE_SIZE, (float)SPRITE_SIZE);
+				if (drawCallPerSprite)
+				{
+					batch.End();
+					drawCalls += batch.GetStats().drawCalls;
+					batch.Begin(sortMode);
+				}
+			}
+			batch.End();
+			drawCalls += batch.GetStats().drawCalls;
+		}
+		glFinish();
+		return count * frames / ((NowMs() - start) / 1000.0);
+	};
+
+	std::cout << "Sprite benchmark (" << SPRITE_SIZE << "x" << SPRITE_SIZE << " px sprites, " << TEXTURE_COUNT << " textures), sprites per second:" << std::endl;
+	const int counts[] = { 10000, 100000, 1000000 };
+	for (int count : counts)
+	{
+		int deferredDraws = 0, sortedDraws = 0;
+		double deferred = measure(count, SPRITE_SORT_DEFERRED, false, deferredDraws);
+		double sorted = measure(count, SPRITE_SORT_TEXTURE, false, sortedDraws);
+		std::cout << "  " << std::setw(7) << count << " sprites: submission order " << std::setw(11) << (long long)deferred << " (" << deferredDraws
+			<< " draw calls/frame), sorted by texture " << std::setw(11) << (long long)sorted << " (" << sortedDraws << " draw calls/frame)" << std::endl;
+	}
+	int unbatchedDraws = 0;
+	double unbatched = measure(10000, SPRITE_SORT_DEFERRED, true, unbatchedDraws);
+	std::cout << "    10000 sprites, one draw call each: " << (long long)unbatched << " (" << unbatchedDraws << " draw calls/frame)" << std::endl;
+	const StreamBufferStats& stream = batch.GetStreamStats();
+	std::cout << "  vertex stream (" << (batch.IsStreamPersistent() ? "persistent mapping" : "glMapBufferRange") << "): " << stream.bytesStreamed / (1024 * 1024)
+		<< " MiB, " << stream.wraps << " wraps, " << stream.fencesWaited << " fence waits (" << stream.fenceWaitMs << " ms)" << std::endl;
+
+	glDeleteTextures(TEXTURE_COUNT, textures.data());
+	for (unsigned int texture : textures)
+		GLStateCache::Get().ForgetTexture(texture);
+}
+
+// a crowd of 100k small quads drawn with one glDrawElements each and with one glDrawElementsInstanced;
+// prints draw calls, CPU submit time and the time until the GPU finished, per frame
+// ---------------------------------------------------------------------------------------------------------
+void runInstancingBenchmark()
+{
+	const int INSTANCE_COUNT = 100000;
+	const int FRAMES = 5;
+
+	float vertices[] = {
+		 0.5f,  0.5f, 0.0f,  1.0f, 0.0f, 0.0f,  1.0f, 1.0f,
+		 0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,  1.0f, 0.0f,
+		-0.5f, -0.5f, 0.0f,  0.0f, 0.0f, 1.0f,  0.0f, 0.0f,
+		-0.5f,  0.5f, 0.0f,  1.0f, 1.0f, 0.0f,  0.0f, 1.0f
+	};
+	unsigned int indices[] = { 0, 1, 3,  1, 2, 3 };
+	InstancedMesh quad(vertices, 4, indices, 6);
+	Shader instancedShader("src/assets/shaders/vshader_instanced.glsl", "src/assets/shaders/fshader.glsl");
+
+	std::vector<InstanceData> instances(INSTANCE_COUNT);
+	XorShift32 random;
+	for (InstanceData& instance : instances)
+		instance = InstanceData::Make(random.Next01() * 2.0f - 1.0f, random.Next01() * 2.0f - 1.0f, 0.0f, 0.01f, random.Next01() * 6.2832f, { random.Next01(), random.Next01(), random.Next01(), 1.0f });
+
+	instancedShader.Bind();
+	quad.SetInstances(instances.data(), INSTANCE_COUNT);
+	auto measure = [&](const char* label, bool instanced, bool upload) {
+		double submitMs = 0.0, frameMs = 0.0;
+		glFinish();
+		for (int frame = 0; frame < FRAMES; frame++)
+		{
+			double start = NowMs();
+			glClear(GL_COLOR_BUFFER_BIT);
+			if (upload)
+				quad.SetInstances(instances.data(), INSTANCE_COUNT);
+			if (instanced)
+				quad.Draw();
+			else
+				quad.DrawSeparately();
+			submitMs += NowMs() - start;
+			glFinish();
+			frameMs += NowMs() - start;
+		}
+		std::cout << "  " << std::setw(32) << std::left << label << std::right << std::setw(7) << (instanced ? 1 : INSTANCE_COUNT) << " draw calls, submit "
+			<< std::setw(8) << submitMs / FRAMES << " ms, until finished " << std::setw(8) << frameMs / FRAMES << " ms" << std::endl;
+	};
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Instancing benchmark, " << INSTANCE_COUNT << " quads, per frame:" << std::endl;
+	measure("one draw call per quad", false, false);
+	measure("instanced", true, false);
+	measure("instanced, uploaded every frame", true, true);
+}
+
+// 20k small textured quads with random programs, texture pairs, vertex arrays and depths, drawn through the
+// RenderQueue in submission order and sorted; prints state changes, GL state calls and CPU/GPU time per frame
+// ---------------------------------------------------------------------------------------------------------
+void runQueueBenchmark()
+{
+	const int OBJECT_COUNT = 20000;
+	const int PROGRAM_COUNT = 8, TEXTURE_COUNT = 16, TEXTURE_SET_COUNT = 32, VERTEX_ARRAY_COUNT = 16;
+	const int FRAMES = 10;
+	XorShift32 random;
+	GLStateCache& state = GLStateCache::Get();
+
+	// materials: separately linked programs (same source, as different shaders would be) and pairs of solid textures
+	std::vector<std::unique_ptr<Shader>> programs;
+	for (int i = 0; i < PROGRAM_COUNT; i++)
+	{
+		programs.emplace_back(new Shader("src/assets/shaders/vshader_transform.glsl", "src/assets/shaders/fshader.glsl"));
+		programs.back()->Bind();
+		programs.back()->SetInt("texture1", 0);
+		programs.back()->SetInt("texture2", 1);
+	}
+	std::vector<unsigned int> textures(TEXTURE_COUNT);
+	glGenTextures(TEXTURE_COUNT, textures.data());
+	for (int i = 0; i < TEXTURE_COUNT; i++)
+	{
+		unsigned char pixel[4] = { (unsigned char)(i * 16), (unsigned char)(255 - i * 16), (unsigned char)(i * 96), 255 };
+		state.BindTexture(0, textures[i]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+	}
+
+	// meshes: the quad of main.cpp in separate vertex arrays
+	std::vector<unsigned int> vertexArrays(VERTEX_ARRAY_COUNT), buffers(VERTEX_ARRAY_COUNT * 2);
+	for (int i = 0; i < VERTEX_ARRAY_COUNT; i++)
+		vertexArrays[i] = createQuadVertexArray(&buffers[i * 2]);
+
+	// the scene: every object picks its material and mesh at random
+	std::vector<RenderCommand> objects(OBJECT_COUNT);
+	std::vector<float> depths(OBJECT_COUNT);
+	std::pair<unsigned int, unsigned int> textureSets[TEXTURE_SET_COUNT];
+	for (auto& set : textureSets)
+		set = { textures[random.Next() % TEXTURE_COUNT], textures[random.Next() % TEXTURE_COUNT] };
+	for (int i = 0; i < OBJECT_COUNT; i++)
+	{
+		RenderCommand& object = objects[i];
+		object.shader = programs[random.Next() % PROGRAM_COUNT].get();
+		object.vertexArray = vertexArrays[random.Next() % VERTEX_ARRAY_COUNT];
+		const auto& set = textureSets[random.Next() % TEXTURE_SET_COUNT];
+		object.textures[0] = set.first;
+		object.textures[1] = set.second;
+		object.textureCount = 2;
+		object.indexCount = 6;
+		object.uniform = object.shader->GetUniform("u_Transform");
+		depths[i] = random.Next01();
+		object.uniformValue = { random.Next01() * 2.0f - 1.0f, random.Next01() * 2.0f - 1.0f, 0.02f, depths[i] * 2.0f - 1.0f };
+	}
+
+	RenderQueue queue;
+	auto measure = [&](const char* label, RenderQueueOrder order) {
+		double recordMs = 0.0, sortMs = 0.0, executeMs = 0.0, frameMs = 0.0;
+		int stateCalls = 0;
+		glFinish();
+		for (int frame = 0; frame < FRAMES; frame++)
+		{
+			double start = NowMs();
+			glClear(GL_COLOR_BUFFER_BIT);
+			for (int i = 0; i < OBJECT_COUNT; i++)
+				queue.Submit(objects[i], 0, depths[i]);
+			recordMs += NowMs() - start;
+			queue.Execute(order);
+			sortMs += queue.GetStats().sortMs;
+			executeMs += queue.GetStats().executeMs;
+			glFinish();
+			frameMs += NowMs() - start;
+			state.EndFrame();
+			stateCalls += state.GetFrameStats().issued;
+		}
+		const RenderQueueStats& stats = queue.GetStats();
+		std::cout << "  " << std::setw(17) << std::left << label << std::right << " program changes " << std::setw(6) << stats.programChanges
+			<< ", texture changes " << std::setw(6) << stats.textureChanges << ", vertex array changes " << std::setw(6) << stats.vertexArrayChanges
+			<< ", GL state calls " << std::setw(6) << stateCalls / FRAMES << std::endl;
+		std::cout << "  " << std::setw(17) << "" << " record " << std::setw(6) << recordMs / FRAMES << " ms, sort " << std::setw(6) << sortMs / FRAMES
+			<< " ms, execute " << std::setw(7) << executeMs / FRAMES << " ms, until finished " << std::setw(7) << frameMs / FRAMES << " ms" << std::endl;
+	};
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Render queue benchmark, " << OBJECT_COUNT << " draws (" << PROGRAM_COUNT << " programs, "
+		<< TEXTURE_SET_COUNT << " texture pairs, " << VERTEX_ARRAY_COUNT << " vertex arrays), per frame:" << std::endl;
+	measure("submission order", RENDER_QUEUE_SUBMISSION);
+	measure("sorted", RENDER_QUEUE_SORTED);
+
+	glDeleteVertexArrays(VERTEX_ARRAY_COUNT, vertexArrays.data());
+	for (unsigned int vertexArray : vertexArrays)
+		state.ForgetVertexArray(vertexArray);
+	glDeleteBuffers(VERTEX_ARRAY_COUNT * 2, buffers.data());
+	glDeleteTextures(TEXTURE_COUNT, textures.data());
+	for (unsigned int texture : textures)
+		state.ForgetTexture(texture);
+}
+
+// a 200k object scene (moving, spinning quads with random materials) whose update, culling, sort key generation and
+// uniform packing run on the JobSystem with per thread command lists, for 1, 2, 4, ... up to maxThreads threads;
+// the GL thread merges the lists and replays them through the RenderQueue. Prints the time of each part per frame.
+// ---------------------------------------------------------------------------------------------------------
+void runJobsBenchmark(int maxThreads)
+{
+	const int OBJECT_COUNT = 200000;
+	const int PROGRAM_COUNT = 4, TEXTURE_COUNT = 8, VERTEX_ARRAY_COUNT = 4;
+	const int FRAMES = 10;
+	const int GRAIN = 2048;                 // objects per task
+	const float WORLD_SIZE = 8.0f;          // objects move in [-4, 4]^2, the view shows [-1, 1]^2
+	if (maxThreads <= 0)
+		maxThreads = std::max(1, (int)std::thread::hardware_concurrency());
+	XorShift32 random;
+	GLStateCache& state = GLStateCache::Get();
+
+	// materials and meshes as in runQueueBenchmark()
+	std::vector<std::unique_ptr<Shader>> programs;
+	std::vector<UniformHandle> transforms;
+	for (int i = 0; i < PROGRAM_COUNT; i++)
+	{
+		programs.emplace_back(new Shader("src/assets/shaders/vshader_transform.glsl", "src/assets/shaders/fshader.glsl"));
+		programs.back()->Bind();
+		programs.back()->SetInt("texture1", 0);
+		programs.back()->SetInt("texture2", 1);
+		transforms.push_back(programs.back()->GetUniform("u_Transform"));
+	}
+	std::vector<unsigned int> textures(TEXTURE_COUNT);
+	glGenTextures(TEXTURE_COUNT, textures.data());
+	for (int i = 0; i < TEXTURE_COUNT; i++)
+	{
+		unsigned char pixel[4] = { (unsigned char)(i * 32), (unsigned char)(255 - i * 32), (unsigned char)(i * 96), 255 };
+		state.BindTexture(0, textures[i]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+	}
+	std::vector<unsigned int> vertexArrays(VERTEX_ARRAY_COUNT), buffers(VERTEX_ARRAY_COUNT * 2);
+	for (int i = 0; i < VERTEX_ARRAY_COUNT; i++)
+		vertexArrays[i] = createQuadVertexArray(&buffers[i * 2]);
+
+	struct SceneObject
+	{
+		float x, y, vx, vy, scale, angle, spin;
+		int program, vertexArray, texture1, texture2;
+	};
+	std::vector<SceneObject> initialScene(OBJECT_COUNT);
+	for (SceneObject& object : initialScene)
+	{
+		object = SceneObject{ (random.Next01() - 0.5f) * WORLD_SIZE, (random.Next01() - 0.5f) * WORLD_SIZE, (random.Next01() - 0.5f) * 0.02f, (random.Next01() - 0.5f) * 0.02f,
+			0.01f + random.Next01() * 0.02f, random.Next01() * 6.2832f, (random.Next01() - 0.5f) * 0.2f, 0, 0, 0, 0 };
+		object.program = (int)(random.Next01() * PROGRAM_COUNT);
+		object.vertexArray = (int)(random.Next01() * VERTEX_ARRAY_COUNT);
+		object.texture1 = (int)(random.Next01() * TEXTURE_COUNT);
+		object.texture2 = (int)(random.Next01() * TEXTURE_COUNT);
+	}
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Jobs benchmark, " << OBJECT_COUNT << " objects (update, cull, sort key, uniforms per object), "
+		<< std::thread::hardware_concurrency() << " cores, per frame:" << std::endl;
+	double singleThreadMs = 0.0;
+	for (int threads = 1; ; threads = std::min(threads * 2, maxThreads))
+	{
+		JobSystem jobs(threads);
+		RenderQueue queue;
+		std::vector<RenderCommandList> lists(threads);
+		std::vector<SceneObject> scene = initialScene; // every run animates the same frames
+		double recordMs = 0.0, mergeMs = 0.0, sortMs = 0.0, executeMs = 0.0;
+		int drawn = 0;
+		glFinish();
+		for (int frame = 0; frame < FRAMES; frame++)
+		{
+			glClear(GL_COLOR_BUFFER_BIT);
+			double start = NowMs();
+			for (RenderCommandList& list : lists)
+				list.Clear();
+			jobs.ParallelFor(OBJECT_COUNT, GRAIN, [&](int begin, int end, int thread) {
+				RenderCommandList& list = lists[thread];
+				RenderCommand command;
+				command.textureCount = 2;
+				command.indexCount = 6;
+				for (int i = begin; i < end; i++)
+				{
+					// update: move, wrap around the world and spin
+					SceneObject& object = scene[i];
+					object.x += object.vx;
+					object.y += object.vy;
+					if (object.x < -WORLD_SIZE * 0.5f) object.x += WORLD_SIZE;
+					if (object.x > WORLD_SIZE * 0.5f) object.x -= WORLD_SIZE;
+					if (object.y < -WORLD_SIZE * 0.5f) object.y += WORLD_SIZE;
+					if (object.y > WORLD_SIZE * 0.5f) object.y -= WORLD_SIZE;
+					object.angle += object.spin;
+
+					// cull: bounding circle of the rotated quad against the view
+					float radius = object.scale * 0.7072f;
+					if (std::fabs(object.x) > 1.0f + radius || std::fabs(object.y) > 1.0f + radius)
+						continue;
+
+					// pack the draw and its sort key, depth from the distance to the view center
+					command.shader = programs[object.program].get();
+					command.vertexArray = vertexArrays[object.vertexArray];
+					command.textures[0] = textures[object.texture1];
+					command.textures[1] = textures[object.texture2];
+					float depth = std::sqrt(object.x * object.x + object.y * object.y) * 0.7071f;
+					command.uniform = transforms[object.program];
+					command.uniformValue = { object.x, object.y, object.scale, depth * 2.0f - 1.0f };
+					list.Add(queue.MakeKey(command, 0, depth), command);
+				}
+			});
+			double recorded = NowMs();
+			for (const RenderCommandList& list : lists)
+				queue.Append(list);
+			double merged = NowMs();
+			drawn = queue.GetCommandCount();
+			queue.Execute();
+			recordMs += recorded - start;
+			mergeMs += merged - recorded;
+			sortMs += queue.GetStats().sortMs;
+			executeMs += queue.GetStats().executeMs;
+			glFinish();
+		}
+		if (threads == 1)
+			singleThreadMs = recordMs;
+		std::cout << "  " << std::setw(2) << threads << " threads: record " << std::setw(7) << recordMs / FRAMES << " ms (x" << singleThreadMs / recordMs
+			<< "), merge " << std::setw(5) << mergeMs / FRAMES << " ms, sort " << std::setw(5) << sortMs / FRAMES << " ms, execute "
+			<< std::setw(7) << executeMs / FRAMES << " ms, " << drawn << " draws" << std::endl;
+		if (threads == maxThreads)
+			break;
+	}
+
+	glDeleteVertexArrays(VERTEX_ARRAY_COUNT, vertexArrays.data());
+	for (unsigned int vertexArray : vertexArrays)
+		state.ForgetVertexArray(vertexArray);
+	glDeleteBuffers(VERTEX_ARRAY_COUNT * 2, buffers.data());
+	glDeleteTextures(TEXTURE_COUNT, textures.data());
+	for (unsigned int texture : textures)
+		state.ForgetTexture(texture);
+}
+
+// std140 mirrors of the uniform blocks of vshader_blocks.glsl
+struct FrameUniforms
+{
+	Std140Vec4 camera;
+	Std140Vec4 time;
+};
+typedef Std140Layout<Std140Vec4, Std140Vec4> FrameUniformsLayout;
+STD140_MEMBER(FrameUniforms, FrameUniformsLayout, 0, camera);
+STD140_MEMBER(FrameUniforms, FrameUniformsLayout, 1, time);
+STD140_SIZE(FrameUniforms, FrameUniformsLayout);
+
+struct DrawUniforms
+{
+	Std140Vec4 transform;
+	Std140Vec4 tint;
+};
+typedef Std140Layout<Std140Vec4, Std140Vec4> DrawUniformsLayout;
+STD140_MEMBER(DrawUniforms, DrawUniformsLayout, 0, transform);
+STD140_MEMBER(DrawUniforms, DrawUniformsLayout, 1, tint);
+STD140_SIZE(DrawUniforms, DrawUniformsLayout);
+
+// 10k quads over 4 programs with per frame (camera, time) and per draw (transform, tint) data, set with glUniform4f
+// calls vs. read from uniform buffers: one upload of the frame block shared by all programs and the draw blocks
+// written into a StreamBuffer, one glBindBufferRange per draw; prints GL calls, CPU submit and finish time per frame
+// ---------------------------------------------------------------------------------------------------------
+void runUniformBenchmark()
+{
+	const int DRAW_COUNT = 10000;
+	const int PROGRAM_COUNT = 4;
+	const int FRAMES = 10;
+	XorShift32 random;
+	GLStateCache& state = GLStateCache::Get();
+
+	std::vector<std::unique_ptr<Shader>> uniformPrograms, blockPrograms;
+	for (int i = 0; i < PROGRAM_COUNT; i++)
+	{
+		uniformPrograms.emplace_back(new Shader("src/assets/shaders/vshader_uniforms.glsl", "src/assets/shaders/fshader_color.glsl"));
+		blockPrograms.emplace_back(new Shader("src/assets/shaders/vshader_blocks.glsl", "src/assets/shaders/fshader_color.glsl"));
+		blockPrograms.back()->BindBlock("FrameUniforms", UNIFORM_BLOCK_FRAME, sizeof(FrameUniforms));
+		blockPrograms.back()->BindBlock("DrawUniforms", UNIFORM_BLOCK_DRAW, sizeof(DrawUniforms));
+	}
+	// the programs are built from the same source, so their uniform tables and handles are the same
+	UniformHandle camera = uniformPrograms[0]->GetUniform("u_Camera"), time = uniformPrograms[0]->GetUniform("u_Time");
+	UniformHandle transform = uniformPrograms[0]->GetUniform("u_Transform"), tint = uniformPrograms[0]->GetUniform("u_Tint");
+
+	unsigned int quadBuffers[2];
+	unsigned int quad = createQuadVertexArray(quadBuffers);
+	std::vector<DrawUniforms> draws(DRAW_COUNT);
+	for (DrawUniforms& draw : draws)
+		draw = DrawUniforms{ { random.Next01() * 2.0f - 1.0f, random.Next01() * 2.0f - 1.0f, 0.02f, 0.0f }, { random.Next01(), random.Next01(), random.Next01(), 1.0f } };
+
+	// per draw blocks are packed at the driver's offset alignment for glBindBufferRange
+	int alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	size_t stride = (sizeof(DrawUniforms) + alignment - 1) / alignment * alignment;
+	UniformBuffer<FrameUniforms> frameBuffer(UNIFORM_BLOCK_FRAME);
+	StreamBuffer drawBuffer(DRAW_COUNT * stride);
+
+	auto toVector4 = [](const Std140Vec4& value) { return vector4{ value.x, value.y, value.z, value.w }; };
+	auto measure = [&](const char* label, bool blocks) {
+		double submitMs = 0.0, frameMs = 0.0;
+		int calls = 0;
+		glFinish();
+		for (int frame = 0; frame < FRAMES; frame++)
+		{
+			double start = NowMs();
+			glClear(GL_COLOR_BUFFER_BIT);
+			FrameUniforms frameData = { { 0.1f, 0.0f, 0.9f, 0.0f }, { frame / 60.0f, 0.0f, 0.0f, 0.0f } };
+			calls = 0;
+			StreamAllocation allocation;
+			if (blocks)
+			{
+				// everything a frame needs in two uploads
+				frameBuffer.Update(frameData);
+				allocation = drawBuffer.Map(DRAW_COUNT * stride, alignment);
+				if (!allocation.data)
+					return;
+				for (int i = 0; i < DRAW_COUNT; i++)
+					std::memcpy((char*)allocation.data + i * stride, &draws[i], sizeof(DrawUniforms));
+				drawBuffer.Unmap();
+				calls += 2;
+			}
+			state.BindVertexArray(quad);
+			for (int program = 0; program < PROGRAM_COUNT; program++)
+			{
+				const Shader& shader = blocks ? *blockPrograms[program] : *uniformPrograms[program];
+				shader.Bind();
+				if (!blocks)
+				{
+					// every program has its own copy of the per frame uniforms
+					shader.Set(camera, toVector4(frameData.camera));
+					shader.Set(time, toVector4(frameData.time));
+					calls += 2;
+				}
+				for (int i = program; i < DRAW_COUNT; i += PROGRAM_COUNT)
+				{
+					if (blocks)
+					{
+						glBindBufferRange(GL_UNIFORM_BUFFER, UNIFORM_BLOCK_DRAW, drawBuffer.GetBuffer(), allocation.offset + i * stride, sizeof(DrawUniforms));
+						calls += 1;
+					}
+					else
+					{
+						shader.Set(transform, toVector4(draws[i].transform));
+						shader.Set(tint, toVector4(draws[i].tint));
+						calls += 2;
+					}
+					glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+				}
+			}
+			if (blocks)
+				drawBuffer.Fence();
+			submitMs += NowMs() - start;
+			glFinish();
+			frameMs += NowMs() - start;
+		}
+		std::cout << "  " << std::setw(16) << std::left << label << std::right << std::setw(6) << calls << " uniform calls, submit "
+			<< std::setw(7) << submitMs / FRAMES << " ms, until finished " << std::setw(7) << frameMs / FRAMES << " ms" << std::endl;
+	};
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Uniform benchmark, " << DRAW_COUNT << " draws, " << PROGRAM_COUNT << " programs, per frame (offset alignment "
+		<< alignment << " bytes):" << std::endl;
+	measure("glUniform4f", false);
+	measure("uniform buffers", true);
+
+	glDeleteVertexArrays(1, &quad);
+	state.ForgetVertexArray(quad);
+	glDeleteBuffers(2, quadBuffers);
+}
+
+// 200 distinct programs (the demo shaders with a unique comment each, so no driver side cache can serve them) built
+// one by one with blocking Shader constructors vs. submitted as one ShaderBatch that is polled between frames of a
+// loading screen; prints the total time, the loading frames rendered meanwhile and the longest frame stall
+// ---------------------------------------------------------------------------------------------------------
+void runCompileBenchmark()
+{
+	const int PROGRAM_COUNT = 200;
+	auto readFile = [](const char* path) { std::ifstream file(path); std::stringstream stream; stream << file.rdbuf(); return stream.str(); };
+	std::string vertexSource = readFile("src/assets/shaders/vshader.glsl");
+	std::string fragmentSource = readFile("src/assets/shaders/fshader.glsl");
+	if (vertexSource.empty() || fragmentSource.empty())
+	{
+		std::cout << "ERROR::COMPILE_BENCH::SHADERS_NOT_FOUND" << std::endl;
+		return;
+	}
+
+	// write the variants, the comment goes after the #version line and differs between runs too
+	std::error_code error;
+	std::filesystem::path directory = std::filesystem::temp_directory_path(error) / "opengl_course_compile_bench";
+	std::filesystem::create_directories(directory, error);
+	long long nonce = std::chrono::steady_clock::now().time_since_epoch().count();
+	std::vector<std::string> paths;
+	for (int pass = 0; pass < 2; pass++)
+	{
+		for (int i = 0; i < PROGRAM_COUNT; i++)
+		{
+			const std::string* sources[2] = { &vertexSource, &fragmentSource };
+			for (int stage = 0; stage < 2; stage++)
+			{
+				std::string source = *sources[stage];
+				std::string comment = "\n// variant " + std::to_string(nonce) + " " + std::to_string(pass) + " " + std::to_string(i);
+				source.insert(source.find('\n'), comment);
+				paths.push_back((directory / ((stage == 0 ? "v" : "f") + std::to_string(pass) + "_" + std::to_string(i) + ".glsl")).string());
+				std::ofstream(paths.back()) << source;
+			}
+		}
+	}
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Compile benchmark, " << PROGRAM_COUNT << " programs (parallel shader compile: "
+		<< (GLAD_GL_KHR_parallel_shader_compile ? "KHR" : GLAD_GL_ARB_parallel_shader_compile ? "ARB" : "not supported") << "):" << std::endl;
+
+	// serial: every constructor waits for its compile and link, nothing can be drawn meanwhile
+	{
+		glFinish();
+		double start = NowMs();
+		std::vector<std::unique_ptr<Shader>> programs;
+		for (int i = 0; i < PROGRAM_COUNT; i++)
+			programs.emplace_back(new Shader(paths[i * 2].c_str(), paths[i * 2 + 1].c_str()));
+		double totalMs = NowMs() - start;
+		std::cout << "  serial   " << std::setw(9) << totalMs << " ms total, 0 loading frames, one stall of " << totalMs << " ms" << std::endl;
+	}
+
+	// batched: submit everything, then draw loading frames and collect finished programs in between
+	{
+		glFinish();
+		double start = NowMs();
+		ShaderBatch batch;
+		for (int i = PROGRAM_COUNT; i < 2 * PROGRAM_COUNT; i++)
+			batch.Add(paths[i * 2].c_str(), paths[i * 2 + 1].c_str());
+		int frames = 0;
+		double longestFrameMs = 0.0;
+		for (bool done = false; !done; frames++)
+		{
+			double frameStart = NowMs();
+			done = batch.Poll();
+			float progress = 1.0f - batch.GetPendingCount() / (float)PROGRAM_COUNT;
+			GLStateCache::Get().ClearColor(0.1f, 0.1f + 0.5f * progress, 0.1f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT);
+			glFinish();
+			longestFrameMs = std::max(longestFrameMs, NowMs() - frameStart);
+		}
+		double totalMs = NowMs() - start;
+		const ShaderBatchStats& stats = batch.GetStats();
+		std::cout << "  batched  " << std::setw(9) << totalMs << " ms total, " << frames << " loading frames, longest loading frame " << longestFrameMs
+			<< " ms (submit " << stats.submitMs << " ms, " << stats.built << " built, " << stats.failed << " failed)" << std::endl;
+	}
+
+	std::filesystem::remove_all(directory, error);
+}
+
+// a 1024 x 1024 vertex height field (2M triangles) with position, color, texture coordinate and normal, drawn with
+// every attribute as floats (44 bytes per vertex) vs. packed (half positions, UNORM8 colors, UNORM16 texture
+// coordinates, 2_10_10_10 normals: 20 bytes); prints bytes per vertex, the quantization errors against their
+// bounds and the GPU time per frame (GL_TIME_ELAPSED)
+// ---------------------------------------------------------------------------------------------------------
+void runVertexFormatBenchmark()
+{
+	const int GRID = 1024;
+	const int FRAMES = 10;
+	const int vertexCount = GRID * GRID;
+	GLStateCache& state = GLStateCache::Get();
+
+	VertexFormat floatFormat, packedFormat;
+	floatFormat.Add(0, 3, VERTEX_FLOAT32).Add(1, 3, VERTEX_FLOAT32).Add(2, 2, VERTEX_FLOAT32).Add(3, 3, VERTEX_FLOAT32);
+	packedFormat.Add(0, 3, VERTEX_FLOAT16).Add(1, 3, VERTEX_UNORM8).Add(2, 2, VERTEX_UNORM16).Add(3, 4, VERTEX_SNORM_2_10_10_10);
+
+	// height field over [-1, 1]^2 with analytic normals
+	std::vector<float> floatVertices((size_t)vertexCount * floatFormat.GetStride() / sizeof(float));
+	for (int y = 0; y < GRID; y++)
+	{
+		for (int x = 0; x < GRID; x++)
+		{
+			float u = x / (float)(GRID - 1), v = y / (float)(GRID - 1);
+			float px = u * 2.0f - 1.0f, py = v * 2.0f - 1.0f;
+			float height = 0.2f * std::sin(px * 6.0f) * std::cos(py * 5.0f);
+			float dx = 1.2f * std::cos(px * 6.0f) * std::cos(py * 5.0f), dy = -1.0f * std::sin(px * 6.0f) * std::sin(py * 5.0f);
+			float length = std::sqrt(dx * dx + dy * dy + 1.0f);
+			float vertex[11] = { px, py, height,  u, v, 0.5f + height,  u, v,  -dx / length, -dy / length, 1.0f / length };
+			std::memcpy(&floatVertices[((size_t)y * GRID + x) * 11], vertex, sizeof(vertex));
+		}
+	}
+	std::vector<unsigned int> indices;
+	indices.reserve((size_t)(GRID - 1) * (GRID - 1) * 6);
+	for (int y = 0; y + 1 < GRID; y++)
+	{
+		for (int x = 0; x + 1 < GRID; x++)
+		{
+			unsigned int corner = y * GRID + x;
+			unsigned int quad[6] = { corner, corner + 1, corner + GRID,  corner + 1, corner + GRID + 1, corner + GRID };
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+	std::vector<unsigned char> packedVertices((size_t)vertexCount * packedFormat.GetStride());
+	std::vector<VertexQuantizationError> errors = QuantizeVertices(floatFormat, floatVertices.data(), packedFormat, packedVertices.data(), vertexCount);
+
+	Shader shader("src/assets/shaders/vshader_mesh.glsl", "src/assets/shaders/fshader.glsl", ShaderDefines{ { "USE_VERTEX_COLOR", "1" } });
+	unsigned int indexBuffer, query;
+	glGenBuffers(1, &indexBuffer);
+	glGenQueries(1, &query);
+
+	auto measure = [&](const char* label, const VertexFormat& format, const void* data) {
+		unsigned int vertexArray, vertexBuffer;
+		glGenVertexArrays(1, &vertexArray);
+		glGenBuffers(1, &vertexBuffer);
+		state.BindVertexArray(vertexArray);
+		glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+		glBufferData(GL_ARRAY_BUFFER, (size_t)vertexCount * format.GetStride(), data, GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+		format.Apply();
+		shader.Bind();
+
+		// one warm up frame, then the average of FRAMES
+		double gpuMs = 0.0;
+		for (int frame = 0; frame <= FRAMES; frame++)
+		{
+			glClear(GL_COLOR_BUFFER_BIT);
+			glBeginQuery(GL_TIME_ELAPSED, query);
+			glDrawElements(GL_TRIANGLES, (int)indices.size(), GL_UNSIGNED_INT, 0);
+			glEndQuery(GL_TIME_ELAPSED);
+			GLuint64 elapsed = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+			if (frame > 0)
+				gpuMs += elapsed / 1e6;
+		}
+		std::cout << "  " << std::setw(7) << std::left << label << std::right << std::setw(3) << format.GetStride() << " bytes per vertex, "
+			<< std::setw(6) << (double)vertexCount * format.GetStride() / (1024.0 * 1024.0) << " MiB, GPU " << std::setw(7) << gpuMs / FRAMES << " ms per frame" << std::endl;
+
+		glDeleteVertexArrays(1, &vertexArray);
+		state.ForgetVertexArray(vertexArray);
+		glDeleteBuffers(1, &vertexBuffer);
+	};
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Vertex format benchmark, " << vertexCount << " vertices, " << indices.size() / 3 << " triangles:" << std::endl;
+	measure("float", floatFormat, floatVertices.data());
+	measure("packed", packedFormat, packedVertices.data());
+	const char* names[] = { "position", "color", "texcoord", "normal" };
+	std::cout << std::scientific << std::setprecision(2);
+	for (const VertexQuantizationError& error : errors)
+		std::cout << "  " << std::setw(9) << std::left << names[error.location] << std::right << " max error " << error.maxError << " (bound " << error.maxBound
+			<< "), " << error.outOfBound << " over bound, " << error.clamped << " clamped" << std::endl;
+
+	glDeleteQueries(1, &query);
+	glDeleteBuffers(1, &indexBuffer);
+}
+
+// a bumpy sphere (about 100k triangles, 52k vertices) in shuffled triangle and vertex order, as an importer might
+// hand it over, through the optimizer passes one at a time; prints the simulated vertex cache efficiency (ACMR and
+// ATVR), the index buffer size, and the GPU time and overdraw (fragments shaded per visible pixel, depth tested
+// and back faces culled) of each stage
+// ---------------------------------------------------------------------------------------------------------
+void runMeshBenchmark()
+{
+	const int RINGS = 160, SEGMENTS = 320;
+	const int DRAWS = 8;    // per frame, each on a cleared depth buffer
+	const int FRAMES = 5;
+	const int FLOATS = 11;  // position, color, texture coordinate, normal
+	GLStateCache& state = GLStateCache::Get();
+
+	std::vector<float> vertices;
+	std::vector<unsigned int> authored;
+	createBumpySphere(RINGS, SEGMENTS, vertices, authored);
+	const int vertexCount = (int)(vertices.size() / FLOATS);
+
+	// the importer's order: triangles and vertices shuffled (fixed seed, reproducible)
+	std::mt19937 random(1234);
+	std::vector<unsigned int> shuffled(authored.size());
+	std::vector<size_t> triangles(authored.size() / 3);
+	for (size_t t = 0; t < triangles.size(); t++)
+		triangles[t] = t;
+	std::shuffle(triangles.begin(), triangles.end(), random);
+	std::vector<unsigned int> vertexOrder(vertexCount);
+	for (int v = 0; v < vertexCount; v++)
+		vertexOrder[v] = v;
+	std::shuffle(vertexOrder.begin(), vertexOrder.end(), random);
+	std::vector<float> shuffledVertices(vertices.size());
+	for (int v = 0; v < vertexCount; v++)
+		std::memcpy(&shuffledVertices[(size_t)vertexOrder[v] * FLOATS], &vertices[(size_t)v * FLOATS], FLOATS * sizeof(float));
+	for (size_t t = 0; t < triangles.size(); t++)
+		for (int corner = 0; corner < 3; corner++)
+			shuffled[t * 3 + corner] = vertexOrder[authored[triangles[t] * 3 + corner]];
+
+	// the passes, each on the result of the previous one
+	double start = NowMs();
+	std::vector<unsigned int> cacheOptimized = MeshOptimizer::OptimizeVertexCache(shuffled, vertexCount);
+	double cacheMs = NowMs() - start;
+	std::vector<unsigned int> overdrawOptimized = cacheOptimized;
+	start = NowMs();
+	MeshOptimizer::OptimizeOverdraw(overdrawOptimized, shuffledVertices.data(), FLOATS * sizeof(float), vertexCount);
+	double overdrawMs = NowMs() - start;
+	std::vector<unsigned int> fetchOptimized = overdrawOptimized;
+	std::vector<float> fetchVertices = shuffledVertices;
+	start = NowMs();
+	size_t fetchVertexCount = MeshOptimizer::OptimizeVertexFetch(fetchOptimized, fetchVertices.data(), vertexCount, FLOATS * sizeof(float));
+	double fetchMs = NowMs() - start;
+
+	VertexFormat format;
+	format.Add(0, 3, VERTEX_FLOAT32).Add(1, 3, VERTEX_FLOAT32).Add(2, 2, VERTEX_FLOAT32).Add(3, 3, VERTEX_FLOAT32);
+	Shader shader("src/assets/shaders/vshader_mesh.glsl", "src/assets/shaders/fshader.glsl", ShaderDefines{ { "USE_VERTEX_COLOR", "1" } });
+	unsigned int timeQuery, samplesQuery;
+	glGenQueries(1, &timeQuery);
+	glGenQueries(1, &samplesQuery);
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	FixedFormat outputFormat(std::cout, 3);
+	std::cout << "Mesh optimizer benchmark, " << vertexCount << " vertices, " << authored.size() / 3 << " triangles ("
+		<< "vertex cache " << cacheMs << " ms, overdraw " << overdrawMs << " ms, vertex fetch " << fetchMs << " ms on the CPU):" << std::endl;
+	std::cout << "  stage           ACMR 16  ATVR 16  ACMR 32  index KiB  GPU ms/frame  overdraw" << std::endl;
+	auto measure = [&](const char* label, const std::vector<unsigned int>& indices, const std::vector<float>& data, size_t count, bool narrow) {
+		VertexCacheStats cache16 = MeshOptimizer::AnalyzeVertexCache(indices, count, 16);
+		VertexCacheStats cache32 = MeshOptimizer::AnalyzeVertexCache(indices, count, 32);
+		std::vector<unsigned char> indexData;
+		GLenum indexType = GL_UNSIGNED_INT;
+		if (narrow)
+			indexType = MeshOptimizer::PackIndices(indices, count, indexData);
+		else
+			indexData.assign((const unsigned char*)indices.data(), (const unsigned char*)(indices.data() + indices.size()));
+
+		unsigned int vertexArray, buffers[2];
+		glGenVertexArrays(1, &vertexArray);
+		glGenBuffers(2, buffers);
+		state.BindVertexArray(vertexArray);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+		glBufferData(GL_ARRAY_BUFFER, count * format.GetStride(), data.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+		format.Apply();
+		shader.Bind();
+
+		// one warm up frame, then the average of FRAMES
+		double gpuMs = 0.0;
+		for (int frame = 0; frame <= FRAMES; frame++)
+		{
+			glBeginQuery(GL_TIME_ELAPSED, timeQuery);
+			for (int draw = 0; draw < DRAWS; draw++)
+			{
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+				glDrawElements(GL_TRIANGLES, (int)indices.size(), indexType, 0);
+			}
+			glEndQuery(GL_TIME_ELAPSED);
+			GLuint64 elapsed = 0;
+			glGetQueryObjectui64v(timeQuery, GL_QUERY_RESULT, &elapsed);
+			if (frame > 0)
+				gpuMs += elapsed / 1e6;
+		}
+
+		// fragments shaded in one draw vs. the visible ones (those matching the final depth)
+		GLuint shaded = 0, visible = 0;
+		glClear(GL_DEPTH_BUFFER_BIT);
+		glBeginQuery(GL_SAMPLES_PASSED, samplesQuery);
+		glDrawElements(GL_TRIANGLES, (int)indices.size(), indexType, 0);
+		glEndQuery(GL_SAMPLES_PASSED);
+		glGetQueryObjectuiv(samplesQuery, GL_QUERY_RESULT, &shaded);
+		glDepthFunc(GL_EQUAL);
+		glBeginQuery(GL_SAMPLES_PASSED, samplesQuery);
+		glDrawElements(GL_TRIANGLES, (int)indices.size(), indexType, 0);
+		glEndQuery(GL_SAMPLES_PASSED);
+		glGetQueryObjectuiv(samplesQuery, GL_QUERY_RESULT, &visible);
+		glDepthFunc(GL_LESS);
+
+		std::cout << "  " << std::setw(14) << std::left << label << std::right << std::setw(9) << cache16.acmr << std::setw(9) << cache16.atvr
+			<< std::setw(9) << cache32.acmr << std::setw(11) << std::setprecision(1) << indexData.size() / 1024.0 << std::setw(14) << std::setprecision(3)
+			<< gpuMs / FRAMES << std::setw(10) << (visible ? (double)shaded / visible : 0.0) << std::endl;
+
+		glDeleteVertexArrays(1, &vertexArray);
+		state.ForgetVertexArray(vertexArray);
+		glDeleteBuffers(2, buffers);
+	};
+	measure("authored", authored, vertices, vertexCount, false);
+	measure("shuffled", shuffled, shuffledVertices, vertexCount, false);
+	measure("+ cache", cacheOptimized, shuffledVertices, vertexCount, false);
+	measure("+ overdraw", overdrawOptimized, shuffledVertices, vertexCount, false);
+	measure("+ fetch", fetchOptimized, fetchVertices, fetchVertexCount, false);
+	measure("+ 16-bit", fetchOptimized, fetchVertices, fetchVertexCount, true);
+
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_DEPTH_TEST);
+	glDeleteQueries(1, &timeQuery);
+	glDeleteQueries(1, &samplesQuery);
+}
+
+// 10k bumpy spheres (9k triangles each at full detail) spread through a perspective view from 3 to 150 units
+// away, drawn through the render queue once with LOD 0 everywhere and once with the LOD SelectLod() picks for a
+// one pixel error; prints the LOD chain, triangles submitted, CPU time (LOD selection and recording included) and
+// GPU time per frame
+// ---------------------------------------------------------------------------------------------------------
+void runLodBenchmark()
+{
+	const int OBJECT_COUNT = 10000;
+	const int FRAMES = 3;
+	const float FOV = 1.0472f;  // 60 degrees vertical
+	const float NEAR = 0.1f, FAR = 500.0f;
+	XorShift32 random;
+
+	std::vector<float> vertices;
+	std::vector<unsigned int> indices;
+	createBumpySphere(48, 96, vertices, indices);
+	VertexFormat format;
+	format.Add(0, 3, VERTEX_FLOAT32).Add(1, 3, VERTEX_FLOAT32).Add(2, 2, VERTEX_FLOAT32).Add(3, 3, VERTEX_FLOAT32);
+	double start = NowMs();
+	LodMesh mesh(indices, vertices.data(), vertices.size() / 11, format);
+	double buildMs = NowMs() - start;
+
+	FixedFormat outputFormat(std::cout, 4);
+	std::cout << "LOD benchmark, " << OBJECT_COUNT << " meshes, chain built in " << std::setprecision(1) << buildMs << " ms:" << std::endl;
+	for (int lod = 0; lod < mesh.GetLodCount(); lod++)
+		std::cout << "  LOD " << lod << ": " << std::setw(5) << mesh.GetLod(lod).indexCount / 3 << " triangles, error " << std::setprecision(4)
+			<< mesh.GetLod(lod).error << std::setprecision(1) << std::endl;
+
+	Shader shader("src/assets/shaders/vshader_lod.glsl", "src/assets/shaders/fshader.glsl", ShaderDefines{ { "USE_VERTEX_COLOR", "1" } });
+	UniformHandle transform = shader.GetUniform("u_Transform");
+	int viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	float focal = 1.0f / std::tan(FOV * 0.5f), aspect = viewport[2] / (float)viewport[3];
+	shader.Bind();
+	shader.Set(shader.GetUniform("u_Projection"), vector4{ focal / aspect, focal, (FAR + NEAR) / (NEAR - FAR), 2.0f * FAR * NEAR / (NEAR - FAR) });
+	float pixelsPerUnit = LodMesh::PixelsPerUnit((float)viewport[3], FOV);
+
+	// objects inside the view: uniform in depth, anywhere across the frustum at that depth
+	struct SceneObject { float x, y, z, scale; };
+	std::vector<SceneObject> scene(OBJECT_COUNT);
+	for (SceneObject& object : scene)
+	{
+		object.z = -(3.0f + random.Next01() * 147.0f);
+		object.x = (random.Next01() * 2.0f - 1.0f) * -object.z * aspect / focal;
+		object.y = (random.Next01() * 2.0f - 1.0f) * -object.z / focal;
+		object.scale = 0.5f + random.Next01() * 0.5f;
+	}
+
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+	unsigned int query;
+	glGenQueries(1, &query);
+	RenderQueue queue;
+	for (int useLods = 0; useLods < 2; useLods++)
+	{
+		// one warm up frame, then the average of FRAMES
+		double cpuMs = 0.0, gpuMs = 0.0;
+		long long triangles = 0;
+		std::vector<int> lodCounts(mesh.GetLodCount(), 0);
+		for (int frame = 0; frame <= FRAMES; frame++)
+		{
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			glBeginQuery(GL_TIME_ELAPSED, query);
+			double frameStart = NowMs();
+			RenderCommand command;
+			command.shader = &shader;
+			command.uniform = transform;
+			for (const SceneObject& object : scene)
+			{
+				float distance = std::sqrt(object.x * object.x + object.y * object.y + object.z * object.z);
+				int lod = useLods ? mesh.SelectLod(distance, pixelsPerUnit, object.scale) : 0;
+				mesh.SetCommand(command, lod);
+				command.uniformValue = { object.x, object.y, object.z, object.scale };
+				queue.Submit(command, 0, -object.z / FAR);
+				if (frame > 0)
+				{
+					triangles += command.indexCount / 3;
+					lodCounts[lod]++;
+				}
+			}
+			queue.Execute();
+			double frameCpuMs = NowMs() - frameStart;
+			glEndQuery(GL_TIME_ELAPSED);
+			GLuint64 elapsed = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+			if (frame > 0)
+			{
+				cpuMs += frameCpuMs;
+				gpuMs += elapsed / 1e6;
+			}
+		}
+		std::cout << "  " << (useLods ? "LOD by screen error" : "full detail        ") << ": " << std::setw(10) << triangles / FRAMES << " triangles, CPU "
+			<< std::setw(6) << cpuMs / FRAMES << " ms, GPU " << std::setw(8) << gpuMs / FRAMES << " ms per frame";
+		if (useLods)
+		{
+			std::cout << " (meshes per LOD:";
+			for (int count : lodCounts)
+				std::cout << " " << count / FRAMES;
+			std::cout << ")";
+		}
+		std::cout << std::endl;
+	}
+
+	glDeleteQueries(1, &query);
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_DEPTH_TEST);
+}
+
+// 1M objects scattered through a 1000 unit cube, culled against a 60 degree view (300 units deep) turning
+// around in 16 steps: one object at a time, SIMD over every object, and through the BVH, each on one thread and
+// on all cores; prints objects culled per millisecond and checks that every path finds the same objects
+// ---------------------------------------------------------------------------------------------------------
+void runCullBenchmark()
+{
+	const int OBJECT_COUNT = 1000000;
+	const int VIEWS = 16;
+	XorShift32 random;
+
+	SceneBounds scene;
+	for (int i = 0; i < OBJECT_COUNT; i++)
+	{
+		float extent[3] = { 0.25f + random.Next01() * 1.75f, 0.25f + random.Next01() * 1.75f, 0.25f + random.Next01() * 1.75f };
+		float radius = 0.8f * std::sqrt(extent[0] * extent[0] + extent[1] * extent[1] + extent[2] * extent[2]);
+		scene.Add((random.Next01() - 0.5f) * 1000.0f, (random.Next01() - 0.5f) * 1000.0f, (random.Next01() - 0.5f) * 1000.0f, extent[0], extent[1], extent[2], radius);
+	}
+	double start = NowMs();
+	scene.BuildBvh();
+	double buildMs = NowMs() - start;
+	start = NowMs();
+	scene.RefitBvh();
+	double refitMs = NowMs() - start;
+
+	// the view turned around y: the frustum planes rotate with it
+	Frustum projection = Frustum::Perspective(1.0472f, 800.0f / 600.0f, 0.1f, 300.0f);
+	std::vector<Frustum> views;
+	for (int view = 0; view < VIEWS; view++)
+	{
+		float angle = view * 6.2832f / VIEWS, c = std::cos(angle), s = std::sin(angle);
+		Frustum frustum = projection;
+		for (float* plane : frustum.planes)
+		{
+			float x = plane[0], z = plane[2];
+			plane[0] = c * x - s * z;
+			plane[2] = s * x + c * z;
+		}
+		views.push_back(frustum);
+	}
+
+	JobSystem jobs(0);
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Cull benchmark, " << OBJECT_COUNT << " objects, " << VIEWS << " views, SIMD width "
+		<< SceneBounds::SimdWidth() << ", " << jobs.GetThreadCount() << " threads, BVH built in " << buildMs << " ms (refit " << refitMs << " ms):" << std::endl;
+	std::vector<std::vector<int>> reference(VIEWS);
+	std::vector<int> visible;
+	const char* names[] = { "scalar", "SIMD linear", "SIMD linear, threads", "BVH", "BVH, threads" };
+	for (int method = 0; method < 5; method++)
+	{
+		double ms = 0.0;
+		long long found = 0, nodes = 0, tested = 0;
+		bool mismatch = false;
+		for (int view = 0; view < VIEWS; view++)
+		{
+			start = NowMs();
+			switch (method)
+			{
+			case 0: scene.CullScalar(views[view], visible); break;
+			case 1: scene.CullLinear(views[view], visible); break;
+			case 2: scene.CullLinear(views[view], visible, &jobs); break;
+			case 3: scene.Cull(views[view], visible); break;
+			default: scene.Cull(views[view], visible, &jobs); break;
+			}
+			ms += NowMs() - start;
+			found += visible.size();
+			nodes += scene.GetStats().nodesVisited;
+			tested += scene.GetStats().objectsTested;
+			std::sort(visible.begin(), visible.end());
+			if (method == 0)
+				reference[view] = visible;
+			else if (visible != reference[view])
+				mismatch = true;
+		}
+		std::cout << "  " << std::setw(21) << std::left << names[method] << std::right << std::setw(8) << ms / VIEWS << " ms per cull, "
+			<< std::setw(9) << OBJECT_COUNT / (ms / VIEWS) << " objects/ms, " << found / VIEWS << " visible, " << nodes / VIEWS << " nodes and "
+			<< tested / VIEWS << " objects tested" << std::endl;
+		if (mismatch)
+			std::cout << "ERROR::CULL_BENCH::RESULTS_DIFFER: " << names[method] << std::endl;
+	}
+}
+
+// encode the sample textures into block compressed .dds files next to them (BC1 for opaque images, BC3 for images
+// with alpha, or one given format for all) with full mip chains, flipped like the TextureManager's stb_image path
+// so it picks them up in their place; prints the memory saved and the error against the source, then loads the
+// textures both ways through the TextureManager
+// ---------------------------------------------------------------------------------------------------------
+void runTextureCompression(const char* formatName)
+{
+	const char* paths[] = { "src/assets/textures/container.jpg", "src/assets/textures/awesomeface.png" };
+	auto psnr = [](double squaredError, size_t samples) { return squaredError > 0.0 ? 10.0 * std::log10(255.0 * 255.0 * samples / squaredError) : 99.0; };
+
+	TextureBlockFormat forced = TEXTURE_BLOCK_NONE;
+	if (std::strcmp(formatName, "bc1") == 0)
+		forced = TEXTURE_BC1;
+	else if (std::strcmp(formatName, "bc3") == 0)
+		forced = TEXTURE_BC3;
+	else if (std::strcmp(formatName, "bc7") == 0)
+		forced = TEXTURE_BC7;
+	else if (std::strcmp(formatName, "auto") != 0)
+		std::cout << "WARNING::ARGS::UNKNOWN_TEXTURE_FORMAT: " << formatName << ", using auto" << std::endl;
+
+	FixedFormat outputFormat(std::cout, 2);
+	std::cout << "Texture compression:" << std::endl;
+	size_t totalUncompressed = 0, totalCompressed = 0;
+	stbi_set_flip_vertically_on_load_thread(true);
+	for (const char* path : paths)
+	{
+		int width, height, channels;
+		unsigned char* pixels = stbi_load(path, &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			std::cout << "ERROR::TEXTURE::FAILED_TO_LOAD_TEXTURE: " << path << " (" << stbi_failure_reason() << ")" << std::endl;
+			continue;
+		}
+		size_t texels = (size_t)width * height;
+		bool opaque = true;
+		for (size_t i = 0; i < texels && opaque; i++)
+			opaque = pixels[i * 4 + 3] == 255;
+		TextureBlockFormat format = forced != TEXTURE_BLOCK_NONE ? forced : opaque ? TEXTURE_BC1 : TEXTURE_BC3;
+
+		double start = NowMs();
+		CompressedImage image = BlockEncoder::Encode(pixels, width, height, format);
+		double encodeMs = NowMs() - start;
+
+		// what the top level lost, color and alpha apart
+		std::vector<unsigned char> decoded;
+		double colorError = 0.0, alphaError = 0.0;
+		BlockEncoder::DecodeLevel(image, 0, decoded);
+		for (size_t i = 0; i < texels * 4; i++)
+		{
+			double difference = (double)decoded[i] - pixels[i];
+			(i % 4 == 3 ? alphaError : colorError) += difference * difference;
+		}
+		stbi_image_free(pixels);
+
+		std::string output = std::filesystem::path(path).replace_extension(".dds").string();
+		if (!CompressedTexture::SaveDDS(output, image))
+			std::cout << "ERROR::TEXTURE::FAILED_TO_WRITE: " << output << std::endl;
+		std::cout << "  " << output << ": " << width << "x" << height << " " << CompressedTexture::FormatName(format) << ", "
+			<< image.levels.size() << " levels, " << image.UncompressedSize() / 1024 << " KiB as RGBA8 -> " << image.data.size() / 1024 << " KiB ("
+			<< (double)image.UncompressedSize() / image.data.size() << ":1), PSNR " << psnr(colorError, texels * 3) << " dB";
+		if (!opaque)
+			std::cout << " color, " << psnr(alphaError, texels) << " dB alpha";
+		std::cout << ", encoded in " << encodeMs << " ms" << std::endl;
+		totalUncompressed += image.UncompressedSize();
+		totalCompressed += image.data.size();
+	}
+	stbi_set_flip_vertically_on_load_thread(false);
+	std::cout << "  total: " << totalUncompressed / 1024 << " KiB -> " << totalCompressed / 1024 << " KiB, "
+		<< (totalUncompressed - totalCompressed) / 1024 << " KiB of texture memory saved" << std::endl;
+
+	// the same textures streamed from the source images and from the containers just written
+	for (int useCompressed = 0; useCompressed < 2; useCompressed++)
+	{
+		TextureManager textures;
+		textures.SetUseCompressed(useCompressed == 1);
+		double start = NowMs();
+		for (const char* path : paths)
+			textures.Load(path);
+		textures.WaitAll();
+		glFinish();
+		std::cout << (useCompressed ? "  from .dds: " : "  decoded:   ") << NowMs() - start << " ms until resident, ";
+		textures.PrintStats();
+	}
+}
+
+// feed CompressedTexture well formed and malformed DDS/KTX2 headers (mip counts past 1x1, sizes of 0, negative as
+// int or above the limit, truncated data, level offsets that wrap around when the size is added); the malformed
+// ones must be rejected without reading out of bounds (run it under ASan/UBSan). false when any case fails
+// ---------------------------------------------------------------------------------------------------------
+bool runContainerCheck()
+{
+	auto put32 = [](std::vector<unsigned char>& bytes, size_t offset, uint32_t value) {
+		for (int i = 0; i < 4; i++)
+			bytes[offset + i] = (unsigned char)(value >> (i * 8));
+	};
+	auto put64 = [&](std::vector<unsigned char>& bytes, size_t offset, uint64_t value) {
+		put32(bytes, offset, (uint32_t)value);
+		put32(bytes, offset + 4, (uint32_t)(value >> 32));
+	};
+	// BC1 DDS with dataSize bytes of blocks after the header
+	auto dds = [&](uint32_t width, uint32_t height, uint32_t levelCount, size_t dataSize) {
+		std::vector<unsigned char> bytes(128 + dataSize, 0);
+		std::memcpy(bytes.data(), "DDS ", 4);
+		put32(bytes, 4, 124);
+		put32(bytes, 8, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000);
+		put32(bytes, 12, height);
+		put32(bytes, 16, width);
+		put32(bytes, 28, levelCount);
+		put32(bytes, 76, 32);
+		put32(bytes, 80, 0x4);
+		std::memcpy(&bytes[84], "DXT1", 4);
+		return bytes;
+	};
+	// BC1 KTX2 with one level at levelOffset, levelSize bytes long, and dataSize bytes of blocks after the index
+	auto ktx2 = [&](uint32_t width, uint32_t height, uint32_t levelCount, uint64_t levelOffset, uint64_t levelSize, size_t dataSize) {
+		static const unsigned char identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+		std::vector<unsigned char> bytes(104 + dataSize, 0);
+		std::memcpy(bytes.data(), identifier, 12);
+		put32(bytes, 12, 131);  // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+		put32(bytes, 16, 1);
+		put32(bytes, 20, width);
+		put32(bytes, 24, height);
+		put32(bytes, 36, 1);
+		put32(bytes, 40, levelCount);
+		put64(bytes, 80, levelOffset);
+		put64(bytes, 88, levelSize);
+		put64(bytes, 96, levelSize);
+		return bytes;
+	};
+
+	struct Case { const char* name; bool ktx2; std::vector<unsigned char> bytes; bool valid; };
+	std::vector<Case> cases = {
+		{ "DDS 16x16, 5 levels", false, dds(16, 16, 5, 128 + 32 + 8 + 8 + 8), true },
+		{ "DDS 100 levels", false, dds(16, 16, 100, 4096), false },
+		{ "DDS 2^32-1 levels", false, dds(16, 16, 0xFFFFFFFF, 4096), false },
+		{ "DDS width 0", false, dds(0, 16, 1, 4096), false },
+		{ "DDS width 2^31", false, dds(0x80000000, 16, 1, 4096), false },
+		{ "DDS width above the limit", false, dds(CompressedTexture::MAX_DIMENSION * 2, 4, 1, 4096), false },
+		{ "DDS truncated", false, dds(16, 16, 1, 64), false },
+		{ "KTX2 4x4", true, ktx2(4, 4, 1, 104, 8, 8), true },
+		{ "KTX2 level offset wrapping around", true, ktx2(4, 4, 1, 0xFFFFFFFFFFFFFFF8ull, 8, 8), false },
+		{ "KTX2 level past the end", true, ktx2(4, 4, 1, 108, 8, 8), false },
+		{ "KTX2 100 levels", true, ktx2(4, 4, 100, 104, 8, 4096), false },
+		{ "KTX2 height 0", true, ktx2(4, 0, 1, 104, 8, 8), false },
+		{ "KTX2 height 2^32-1", true, ktx2(4, 0xFFFFFFFF, 1, 104, 8, 8), false },
+	};
+
+	int failures = 0;
+	for (const Case& test : cases)
+	{
+		CompressedImage image;
+		std::string error;
+		bool loaded = test.ktx2 ? CompressedTexture::LoadKTX2(test.bytes, image, error) : CompressedTexture::LoadDDS(test.bytes, image, error);
+		if (loaded != test.valid)
+		{
+			std::cout << "ERROR::CONTAINER_CHECK::" << (loaded ? "ACCEPTED: " : "REJECTED: ") << test.name << " (" << error << ")" << std::endl;
+			failures++;
+		}
+	}
+	std::cout << "Texture container check: " << cases.size() - failures << "/" << cases.size() << " cases passed" << std::endl;
+	return failures == 0;
+}
+
+// a sphere of rings x segments quads whose radius is bumped by +-25%, so the surface has valleys that hide
+// behind their ridges; 11 floats per vertex (position, color, texture coordinate, normal), indices counter
+// clockwise seen from outside
+// ---------------------------------------------------------------------------------------------------------
+static void createBumpySphere(int rings, int segments, std::vector<float>& vertices, std::vector<unsigned int>& indices)
+{
+	const int FLOATS = 11;
+	const float PI = 3.14159265f;
+	vertices.assign((size_t)(rings + 1) * (segments + 1) * FLOATS, 0.0f);
+	indices.clear();
+	for (int ring = 0; ring <= rings; ring++)
+	{
+		for (int segment = 0; segment <= segments; segment++)
+		{
+			float u = segment / (float)segments, v = ring / (float)rings;
+			float theta = v * PI, phi = u * 2.0f * PI;
+			float radius = 0.8f * (1.0f + 0.25f * std::sin(theta * 9.0f) * std::sin(phi * 11.0f));
+			float* vertex = &vertices[((size_t)ring * (segments + 1) + segment) * FLOATS];
+			vertex[0] = radius * std::sin(theta) * std::cos(phi);
+			vertex[1] = radius * std::cos(theta);
+			vertex[2] = radius * std::sin(theta) * std::sin(phi);
+			vertex[3] = 0.4f + 0.6f * u;  vertex[4] = 0.4f + 0.6f * v;  vertex[5] = radius;
+			vertex[6] = u;  vertex[7] = v;
+		}
+	}
+	for (int ring = 0; ring < rings; ring++)
+	{
+		for (int segment = 0; segment < segments; segment++)
+		{
+			unsigned int corner = ring * (segments + 1) + segment;
+			unsigned int quad[6] = { corner, corner + segments + 1, corner + 1,  corner + 1, corner + segments + 1, corner + segments + 2 };
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+	// counter clockwise seen from outside (the surface is star shaped around the origin), normals from the faces
+	for (size_t i = 0; i < indices.size(); i += 3)
+	{
+		const float* p[3] = { &vertices[indices[i] * FLOATS], &vertices[indices[i + 1] * FLOATS], &vertices[indices[i + 2] * FLOATS] };
+		float e1[3] = { p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2] };
+		float e2[3] = { p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2] };
+		float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		if (n[0] * (p[0][0] + p[1][0] + p[2][0]) + n[1] * (p[0][1] + p[1][1] + p[2][1]) + n[2] * (p[0][2] + p[1][2] + p[2][2]) < 0.0f)
+		{
+			std::swap(indices[i + 1], indices[i + 2]);
+			for (int axis = 0; axis < 3; axis++)
+				n[axis] = -n[axis];
+		}
+		for (int corner = 0; corner < 3; corner++)
+			for (int axis = 0; axis < 3; axis++)
+				vertices[indices[i + corner] * FLOATS + 8 + axis] += n[axis];
+	}
+}
+
+// the quad of main.cpp (position, color, texture coordinate) in a new vertex array, which stays bound;
+// its vertex and index buffer are returned in buffers[0] and buffers[1]
+// ---------------------------------------------------------------------------------------------------------
+static unsigned int createQuadVertexArray(unsigned int* buffers)
+{
+	float vertices[] = {
+		 0.5f,  0.5f, 0.0f,  1.0f, 0.0f, 0.0f,  1.0f, 1.0f,
+		 0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,  1.0f, 0.0f,
+		-0.5f, -0.5f, 0.0f,  0.0f, 0.0f, 1.0f,  0.0f, 0.0f,
+		-0.5f,  0.5f, 0.0f,  1.0f, 1.0f, 0.0f,  0.0f, 1.0f
+	};
+	unsigned int indices[] = { 0, 1, 3,  1, 2, 3 };
+	unsigned int vertexArray;
+	glGenVertexArrays(1, &vertexArray);
+	glGenBuffers(2, buffers);
+	GLStateCache::Get().BindVertexArray(vertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	VertexFormat format;
+	format.Add(0, 3, VERTEX_FLOAT32).Add(1, 3, VERTEX_FLOAT32).Add(2, 2, VERTEX_FLOAT32);
+	format.Apply();
+	return vertexArray;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+// The benchmark and check modes of the command line (--uniform-bench, --jpeg-bench, ...): each one runs on the
+// current GL context and prints its results, main() exits afterwards.
+
+void runUniformLookupBenchmark();
+void runJpegBenchmark();
+void runPngBenchmark();
+void runInflateBenchmark();
+void runTextureBenchmark(int count);
+void runSpriteBenchmark(int width, int height);
+void runInstancingBenchmark();
+void runQueueBenchmark();
+void runJobsBenchmark(int maxThreads);
+void runUniformBenchmark();
+void runCompileBenchmark();
+void runVertexFormatBenchmark();
+void runMeshBenchmark();
+void runLodBenchmark();
+void runCullBenchmark();
+void runTextureCompression(const char* formatName);
+bool runContainerCheck();
@@ -0,0 +1,532 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "CompressedTexture.h"
+
+// CPU encoder for the block compressed formats the assets are converted to offline:
+// - BC1 for opaque color: the colors are fitted by the principal axis of the block, the 5:6:5 endpoints are then
+//   refined by least squares over the chosen indices (the stb_dxt approach); no punch-through alpha.
+// - BC3 for color with alpha: a BC1 color block plus the alpha block between the block's alpha min and max.
+// - BC7 in mode 6 only: one RGBA endpoint pair with 7 bits and a shared p-bit per endpoint, 16 weights. Mode 6
+//   alone already beats BC3 on most blocks; the partitioned modes would need a far larger search.
+// Decoding covers the same subset (BC1, BC3 and BC7 mode 6), enough to measure what the encoder lost.
+class BlockEncoder
+{
+public:
+	static bool CanEncode(TextureBlockFormat format)
+	{
+		return format == TEXTURE_BC1 || format == TEXTURE_BC3 || format == TEXTURE_BC7;
+	}
+
+	// encode width x height RGBA8 texels (rows as given), with a box filtered mip chain down to 1x1 when mipmaps is set
+	// ------------------------------------------------------------------------
+	static CompressedImage Encode(const unsigned char* rgba, int width, int height, TextureBlockFormat format, bool mipmaps = true)
+	{
+		CompressedImage image;
+		if (!CanEncode(format))
+		{
+			std::cout << "ERROR::BLOCK_ENCODER::UNSUPPORTED_FORMAT: " << CompressedTexture::FormatName(format) << std::endl;
+			return image;
+		}
+		image.format = format;
+		image.width = width;
+		image.height = height;
+
+		std::vector<unsigned char> level(rgba, rgba + (size_t)width * height * 4);
+		for (;;)
+		{
+			CompressedLevel entry = { width, height, image.data.size(), CompressedTexture::LevelSize(format, width, height) };
+			image.levels.push_back(entry);
+			image.data.resize(entry.offset + entry.size);
+			EncodeLevel(level.data(), width, height, format, &image.data[entry.offset]);
+			if (!mipmaps || (width == 1 && height == 1))
+				break;
+			level = Downsample(level.data(), width, height);
+			width = std::max(width / 2, 1);
+			height = std::max(height / 2, 1);
+		}
+		return image;
+	}
+
+	// blocks in row order; partial blocks at the right and top edges repeat the last texel
+	static void EncodeLevel(const unsigned char* rgba, int width, int height, TextureBlockFormat format, unsigned char* blocks)
+	{
+		unsigned char block[64];
+		int blockBytes = CompressedTexture::BlockBytes(format);
+		for (int by = 0; by < (height + 3) / 4; by++)
+		{
+			for (int bx = 0; bx < (width + 3) / 4; bx++)
+			{
+				for (int y = 0; y < 4; y++)
+					for (int x = 0; x < 4; x++)
+						std::memcpy(&block[(y * 4 + x) * 4], &rgba[((size_t)std::min(by * 4 + y, height - 1) * width + std::min(bx * 4 + x, width - 1)) * 4], 4);
+				EncodeBlock(format, block, blocks);
+				blocks += blockBytes;
+			}
+		}
+	}
+
+	// one 4x4 block of RGBA8 texels, row by row
+	static void EncodeBlock(TextureBlockFormat format, const unsigned char* block, unsigned char* out)
+	{
+		if (format == TEXTURE_BC1)
+			encodeColor(block, out);
+		else if (format == TEXTURE_BC3)
+		{
+			encodeAlpha(block, out);
+			encodeColor(block, out + 8);
+		}
+		else if (format == TEXTURE_BC7)
+			encodeMode6(block, out);
+	}
+
+	// back to RGBA8; false for formats and BC7 modes the decoder does not cover
+	// ------------------------------------------------------------------------
+	static bool DecodeBlock(TextureBlockFormat format, const unsigned char* in, unsigned char* block)
+	{
+		if (format == TEXTURE_BC1)
+		{
+			decodeColor(in, block, true);
+			return true;
+		}
+		if (format == TEXTURE_BC3)
+		{
+			decodeColor(in + 8, block, false);
+			decodeAlpha(in, block);
+			return true;
+		}
+		if (format == TEXTURE_BC7 && (in[0] & 0x7F) == 0x40)
+		{
+			decodeMode6(in, block);
+			return true;
+		}
+		return false;
+	}
+
+	static bool DecodeLevel(const CompressedImage& image, int levelIndex, std::vector<unsigned char>& rgba)
+	{
+		const CompressedLevel& level = image.levels[levelIndex];
+		const unsigned char* blocks = &image.data[level.offset];
+		unsigned char block[64];
+		rgba.resize((size_t)level.width * level.height * 4);
+		for (int by = 0; by < (level.height + 3) / 4; by++)
+		{
+			for (int bx = 0; bx < (level.width + 3) / 4; bx++)
+			{
+				if (!DecodeBlock(image.format, blocks, block))
+					return false;
+				blocks += CompressedTexture::BlockBytes(image.format);
+				for (int y = 0; y < 4 && by * 4 + y < level.height; y++)
+					for (int x = 0; x < 4 && bx * 4 + x < level.width; x++)
+						std::memcpy(&rgba[((size_t)(by * 4 + y) * level.width + bx * 4 + x) * 4], &block[(y * 4 + x) * 4], 4);
+			}
+		}
+		return true;
+	}
+
+	// next mip level by averaging 2x2 texels (in the stored encoding, like glGenerateMipmap on a linear texture)
+	static std::vector<unsigned char> Downsample(const unsigned char* rgba, int width, int height)
+	{
+		int halfWidth = std::max(width / 2, 1), halfHeight = std::max(height / 2, 1);
+		std::vector<unsigned char> result((size_t)halfWidth * halfHeight * 4);
+		for (int y = 0; y < halfHeight; y++)
+		{
+			int y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+			for (int x = 0; x < halfWidth; x++)
+			{
+				int x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+				for (int c = 0; c < 4; c++)
+				{
+					int sum = rgba[((size_t)y0 * width + x0) * 4 + c] + rgba[((size_t)y0 * width + x1) * 4 + c]
+						+ rgba[((size_t)y1 * width + x0) * 4 + c] + rgba[((size_t)y1 * width + x1) * 4 + c];
+					result[((size_t)y * halfWidth + x) * 4 + c] = (unsigned char)((sum + 2) / 4);
+				}
+			}
+		}
+		return result;
+	}
+
+private:
+	// BC7 interpolation weights of 4 bit indices, in 64ths
+	static constexpr int WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	// principal axis of the first channels of the 16 texels by power iteration, and the texels' extent along it
+	// ------------------------------------------------------------------------
+	static void fitAxis(const unsigned char* block, int channels, float* low, float* high)
+	{
+		float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, covariance[4][4] = {};
+		for (int i = 0; i < 16; i++)
+			for (int c = 0; c < channels; c++)
+				mean[c] += block[i * 4 + c] / 16.0f;
+		for (int i = 0; i < 16; i++)
+			for (int a = 0; a < channels; a++)
+				for (int b = 0; b < channels; b++)
+					covariance[a][b] += (block[i * 4 + a] - mean[a]) * (block[i * 4 + b] - mean[b]);
+
+		float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		for (int iteration = 0; iteration < 8; iteration++)
+		{
+			float next[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, length = 0.0f;
+			for (int a = 0; a < channels; a++)
+			{
+				for (int b = 0; b < channels; b++)
+					next[a] += covariance[a][b] * axis[b];
+				length = std::max(length, std::fabs(next[a]));
+			}
+			if (length == 0.0f)
+				break;  // a flat block, any axis will do
+			for (int c = 0; c < channels; c++)
+				axis[c] = next[c] / length;
+		}
+		float squared = 0.0f;
+		for (int c = 0; c < channels; c++)
+			squared += axis[c] * axis[c];
+		for (int c = 0; c < channels; c++)
+			axis[c] /= std::sqrt(squared);
+
+		float minProjection = 0.0f, maxProjection = 0.0f;
+		for (int i = 0; i < 16; i++)
+		{
+			float projection = 0.0f;
+			for (int c = 0; c < channels; c++)
+				projection += (block[i * 4 + c] - mean[c]) * axis[c];
+			minProjection = std::min(minProjection, projection);
+			maxProjection = std::max(maxProjection, projection);
+		}
+		for (int c = 0; c < channels; c++)
+		{
+			low[c] = mean[c] + axis[c] * minProjection;
+			high[c] = mean[c] + axis[c] * maxProjection;
+		}
+	}
+
+	// endpoints minimizing the squared error for fixed indices: texel i ~ (1 - w_i) * low + w_i * high
+	static bool leastSquares(const unsigned char* block, int channels, const float* weights, float* low, float* high)
+	{
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax[4] = {}, bx[4] = {};
+		for (int i = 0; i < 16; i++)
+		{
+			float b = weights[i], a = 1.0f - b;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (int c = 0; c < channels; c++)
+			{
+				ax[c] += a * block[i * 4 + c];
+				bx[c] += b * block[i * 4 + c];
+			}
+		}
+		float determinant = aa * bb - ab * ab;
+		if (std::fabs(determinant) < 1e-6f)
+			return false;
+		for (int c = 0; c < channels; c++)
+		{
+			low[c] = std::min(std::max((ax[c] * bb - bx[c] * ab) / determinant, 0.0f), 255.0f);
+			high[c] = std::min(std::max((bx[c] * aa - ax[c] * ab) / determinant, 0.0f), 255.0f);
+		}
+		return true;
+	}
+
+	static unsigned short to565(const float* color)
+	{
+		int r = (int)(std::min(std::max(color[0], 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+		int g = (int)(std::min(std::max(color[1], 0.0f), 255.0f) * 63.0f / 255.0f + 0.5f);
+		int b = (int)(std::min(std::max(color[2], 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+		return (unsigned short)(r << 11 | g << 5 | b);
+	}
+
+	static void from565(unsigned short color, int* rgb)
+	{
+		int r = color >> 11, g = (color >> 5) & 63, b = color & 31;
+		rgb[0] = r << 3 | r >> 2;
+		rgb[1] = g << 2 | g >> 4;
+		rgb[2] = b << 3 | b >> 2;
+	}
+
+	// the four color mode palette of two 5:6:5 endpoints
+	static void colorPalette(unsigned short color0, unsigned short color1, int palette[4][3])
+	{
+		from565(color0, palette[0]);
+		from565(color1, palette[1]);
+		for (int c = 0; c < 3; c++)
+		{
+			palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+			palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+		}
+	}
+
+	// nearest palette entry of every texel, with color0 > color1 so BC1 stays in four color mode; the squared error
+	static int colorIndices(const unsigned char* block, unsigned short& color0, unsigned short& color1, unsigned char* indices)
+	{
+		if (color0 < color1)
+			std::swap(color0, color1);
+		int palette[4][3], error = 0;
+		colorPalette(color0, color1, palette);
+		for (int i = 0; i < 16; i++)
+		{
+			int best = INT_MAX;
+			for (int entry = 0; entry < (color0 == color1 ? 1 : 4); entry++)
+			{
+				int dr = block[i * 4] - palette[entry][0], dg = block[i * 4 + 1] - palette[entry][1], db = block[i * 4 + 2] - palette[entry][2];
+				int distance = dr * dr + dg * dg + db * db;
+				if (distance < best)
+				{
+					best = distance;
+					indices[i] = (unsigned char)entry;
+				}
+			}
+			error += best;
+		}
+		return error;
+	}
+
+	// ------------------------------------------------------------------------
+	static void encodeColor(const unsigned char* block, unsigned char* out)
+	{
+		static const float weightOfIndex[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };  // towards color1
+		float low[4], high[4];
+		fitAxis(block, 3, low, high);
+
+		unsigned short bestColor0 = 0, bestColor1 = 0;
+		unsigned char bestIndices[16] = {}, indices[16];
+		int bestError = INT_MAX;
+		for (int iteration = 0; iteration < 3; iteration++)
+		{
+			unsigned short color0 = to565(high), color1 = to565(low);
+			int error = colorIndices(block, color0, color1, indices);
+			if (error >= bestError)
+				break;
+			bestError = error;
+			bestColor0 = color0;
+			bestColor1 = color1;
+			std::memcpy(bestIndices, indices, 16);
+
+			// low is the color1 end of the least squares fit, high the color0 end
+			float weights[16];
+			for (int i = 0; i < 16; i++)
+				weights[i] = 1.0f - weightOfIndex[indices[i]];
+			if (error == 0 || !leastSquares(block, 3, weights, low, high))
+				break;
+		}
+
+		out[0] = (unsigned char)bestColor0;
+		out[1] = (unsigned char)(bestColor0 >> 8);
+		out[2] = (unsigned char)bestColor1;
+		out[3] = (unsigned char)(bestColor1 >> 8);
+		unsigned int bits = 0;
+		for (int i = 0; i < 16; i++)
+			bits |= (unsigned int)bestIndices[i] << (i * 2);
+		for (int i = 0; i < 4; i++)
+			out[4 + i] = (unsigned char)(bits >> (i * 8));
+	}
+
+	// eight value mode between the block's largest and smallest alpha
+	static void encodeAlpha(const unsigned char* block, unsigned char* out)
+	{
+		int alpha0 = 0, alpha1 = 255;
+		for (int i = 0; i < 16; i++)
+		{
+			alpha0 = std::max(alpha0, (int)block[i * 4 + 3]);
+			alpha1 = std::min(alpha1, (int)block[i * 4 + 3]);
+		}
+		out[0] = (unsigned char)alpha0;
+		out[1] = (unsigned char)alpha1;
+
+		int palette[8];
+		alphaPalette(alpha0, alpha1, palette);
+		unsigned long long bits = 0;
+		for (int i = 0; i < 16 && alpha0 != alpha1; i++)
+		{
+			int best = 0;
+			for (int entry = 1; entry < 8; entry++)
+				if (std::abs(block[i * 4 + 3] - palette[entry]) < std::abs(block[i * 4 + 3] - palette[best]))
+					best = entry;
+			bits |= (unsigned long long)best << (i * 3);
+		}
+		for (int i = 0; i < 6; i++)
+			out[2 + i] = (unsigned char)(bits >> (i * 8));
+	}
+
+	static void alphaPalette(int alpha0, int alpha1, int* palette)
+	{
+		palette[0] = alpha0;
+		palette[1] = alpha1;
+		if (alpha0 > alpha1)
+		{
+			for (int i = 1; i < 7; i++)
+				palette[i + 1] = ((7 - i) * alpha0 + i * alpha1) / 7;
+		}
+		else
+		{
+			for (int i = 1; i < 5; i++)
+				palette[i + 1] = ((5 - i) * alpha0 + i * alpha1) / 5;
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+	}
+
+	// BC7 mode 6: try the four p-bit pairs for the fitted endpoints, keep the best, refine by least squares
+	// ------------------------------------------------------------------------
+	static void encodeMode6(const unsigned char* block, unsigned char* out)
+	{
+		float low[4], high[4];
+		fitAxis(block, 4, low, high);
+
+		int bestEndpoints[2][4] = {}, bestPBits[2] = {}, bestError = INT_MAX;
+		unsigned char bestIndices[16] = {};
+		for (int iteration = 0; iteration < 3; iteration++)
+		{
+			bool improved = false;
+			for (int pBits = 0; pBits < 4; pBits++)
+			{
+				int p[2] = { pBits & 1, pBits >> 1 }, endpoints[2][4], palette[16][4];
+				for (int c = 0; c < 4; c++)
+				{
+					endpoints[0][c] = std::min(std::max((int)((low[c] - p[0]) * 0.5f + 0.5f), 0), 127);
+					endpoints[1][c] = std::min(std::max((int)((high[c] - p[1]) * 0.5f + 0.5f), 0), 127);
+				}
+				mode6Palette(endpoints, p, palette);
+
+				unsigned char indices[16];
+				int error = 0;
+				for (int i = 0; i < 16 && error < bestError; i++)
+				{
+					int best = INT_MAX;
+					for (int entry = 0; entry < 16; entry++)
+					{
+						int distance = 0;
+						for (int c = 0; c < 4; c++)
+							distance += (block[i * 4 + c] - palette[entry][c]) * (block[i * 4 + c] - palette[entry][c]);
+						if (distance < best)
+						{
+							best = distance;
+							indices[i] = (unsigned char)entry;
+						}
+					}
+					error += best;
+				}
+				if (error < bestError)
+				{
+					bestError = error;
+					std::memcpy(bestEndpoints, endpoints, sizeof(endpoints));
+					bestPBits[0] = p[0];
+					bestPBits[1] = p[1];
+					std::memcpy(bestIndices, indices, 16);
+					improved = true;
+				}
+			}
+
+			float weights[16];
+			for (int i = 0; i < 16; i++)
+				weights[i] = WEIGHTS4[bestIndices[i]] / 64.0f;
+			if (!improved || bestError == 0 || !leastSquares(block, 4, weights, low, high))
+				break;
+		}
+
+		// the first index has an implied leading zero bit: swap the endpoints when it would need one
+		if (bestIndices[0] & 8)
+		{
+			for (int c = 0; c < 4; c++)
+				std::swap(bestEndpoints[0][c], bestEndpoints[1][c]);
+			std::swap(bestPBits[0], bestPBits[1]);
+			for (int i = 0; i < 16; i++)
+				bestIndices[i] = (unsigned char)(15 - bestIndices[i]);
+		}
+
+		std::memset(out, 0, 16);
+		int position = 0;
+		putBits(out, position, 1 << 6, 7);
+		for (int c = 0; c < 4; c++)
+		{
+			putBits(out, position, bestEndpoints[0][c], 7);
+			putBits(out, position, bestEndpoints[1][c], 7);
+		}
+		putBits(out, position, bestPBits[0], 1);
+		putBits(out, position, bestPBits[1], 1);
+		for (int i = 0; i < 16; i++)
+			putBits(out, position, bestIndices[i], i == 0 ? 3 : 4);
+	}
+
+	static void mode6Palette(const int endpoints[2][4], const int* pBits, int palette[16][4])
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			int e0 = endpoints[0][c] << 1 | pBits[0], e1 = endpoints[1][c] << 1 | pBits[1];
+			for (int entry = 0; entry < 16; entry++)
+				palette[entry][c] = ((64 - WEIGHTS4[entry]) * e0 + WEIGHTS4[entry] * e1 + 32) >> 6;
+		}
+	}
+
+	static void putBits(unsigned char* out, int& position, int value, int count)
+	{
+		for (int bit = 0; bit < count; bit++, position++)
+			out[position >> 3] |= (unsigned char)(((value >> bit) & 1) << (position & 7));
+	}
+
+	static int getBits(const unsigned char* in, int& position, int count)
+	{
+		int value = 0;
+		for (int bit = 0; bit < count; bit++, position++)
+			value |= ((in[position >> 3] >> (position & 7)) & 1) << bit;
+		return value;
+	}
+
+	// ------------------------------------------------------------------------
+	static void decodeColor(const unsigned char* in, unsigned char* block, bool threeColorMode)
+	{
+		unsigned short color0 = (unsigned short)(in[0] | in[1] << 8), color1 = (unsigned short)(in[2] | in[3] << 8);
+		int palette[4][3];
+		colorPalette(color0, color1, palette);
+		bool punchThrough = threeColorMode && color0 <= color1;
+		if (punchThrough)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+		unsigned int bits = in[4] | in[5] << 8 | in[6] << 16 | (unsigned int)in[7] << 24;
+		for (int i = 0; i < 16; i++)
+		{
+			int index = (bits >> (i * 2)) & 3;
+			for (int c = 0; c < 3; c++)
+				block[i * 4 + c] = (unsigned char)palette[index][c];
+			block[i * 4 + 3] = punchThrough && index == 3 ? 0 : 255;
+		}
+	}
+
+	static void decodeAlpha(const unsigned char* in, unsigned char* block)
+	{
+		int palette[8];
+		alphaPalette(in[0], in[1], palette);
+		unsigned long long bits = 0;
+		for (int i = 0; i < 6; i++)
+			bits |= (unsigned long long)in[2 + i] << (i * 8);
+		for (int i = 0; i < 16; i++)
+			block[i * 4 + 3] = (unsigned char)palette[(bits >> (i * 3)) & 7];
+	}
+
+	static void decodeMode6(const unsigned char* in, unsigned char* block)
+	{
+		int position = 7, endpoints[2][4], pBits[2], palette[16][4];
+		for (int c = 0; c < 4; c++)
+		{
+			endpoints[0][c] = getBits(in, position, 7);
+			endpoints[1][c] = getBits(in, position, 7);
+		}
+		pBits[0] = getBits(in, position, 1);
+		pBits[1] = getBits(in, position, 1);
+		mode6Palette(endpoints, pBits, palette);
+		for (int i = 0; i < 16; i++)
+		{
+			int index = getBits(in, position, i == 0 ? 3 : 4);
+			for (int c = 0; c < 4; c++)
+				block[i * 4 + c] = (unsigned char)palette[index][c];
+		}
+	}
+};
@@ -0,0 +1,349 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// block compressed texel formats, every one stores 4x4 texel blocks
+enum TextureBlockFormat
+{
+	TEXTURE_BLOCK_NONE,
+	TEXTURE_BC1,    // RGB + 1-bit alpha, 8 bytes per block (DXT1)
+	TEXTURE_BC2,    // RGB + explicit 4-bit alpha, 16 bytes (DXT3)
+	TEXTURE_BC3,    // RGB + interpolated alpha, 16 bytes (DXT5)
+	TEXTURE_BC4,    // one channel, 8 bytes (RGTC1)
+	TEXTURE_BC5,    // two channels, 16 bytes (RGTC2, normal maps)
+	TEXTURE_BC6H,   // HDR RGB as unsigned half floats, 16 bytes (BPTC float)
+	TEXTURE_BC7,    // RGB(A), 16 bytes (BPTC)
+	TEXTURE_BLOCK_FORMAT_COUNT
+};
+
+// one mip level inside CompressedImage::data
+struct CompressedLevel
+{
+	int width, height;
+	size_t offset, size;
+};
+
+// a block compressed 2D texture with its mip chain, level 0 first
+struct CompressedImage
+{
+	TextureBlockFormat format = TEXTURE_BLOCK_NONE;
+	bool srgb = false;
+	int width = 0, height = 0;
+	std::vector<CompressedLevel> levels;
+	std::vector<unsigned char> data;
+
+	// what the same levels take as RGBA8, to tell what the compression saves
+	size_t UncompressedSize() const
+	{
+		size_t size = 0;
+		for (const CompressedLevel& level : levels)
+			size += (size_t)level.width * level.height * 4;
+		return size;
+	}
+};
+
+// Reads and writes block compressed textures in DDS (legacy FourCC and DX10 headers) and KTX2 containers: single
+// 2D images with their mip levels, no arrays, cube maps or volumes, and in KTX2 no supercompression (no Basis
+// Universal or zstd). The texel data is handed to the GL as stored, rows are not flipped: images written by
+// --compress-textures (runTextureCompression() in main.cpp) are stored bottom row first like the flipped
+// stb_image path, so they come out the same way up. No GL calls here, the encoder uses this too.
+class CompressedTexture
+{
+public:
+	// largest width or height accepted from a file, GL_MAX_TEXTURE_SIZE of current desktop GPUs
+	static const int MAX_DIMENSION = 16384;
+
+	// levels of a full mip chain down to 1x1: floor(log2(max(width, height))) + 1
+	static int MaxLevelCount(int width, int height)
+	{
+		int levels = 1;
+		for (int size = std::max(width, height); size > 1; size >>= 1)
+			levels++;
+		return levels;
+	}
+
+	static int BlockBytes(TextureBlockFormat format)
+	{
+		return format == TEXTURE_BC1 || format == TEXTURE_BC4 ? 8 : 16;
+	}
+
+	static size_t LevelSize(TextureBlockFormat format, int width, int height)
+	{
+		return (size_t)((width + 3) / 4) * ((height + 3) / 4) * BlockBytes(format);
+	}
+
+	static const char* FormatName(TextureBlockFormat format)
+	{
+		static const char* names[] = { "none", "BC1", "BC2", "BC3", "BC4", "BC5", "BC6H", "BC7" };
+		return format < TEXTURE_BLOCK_FORMAT_COUNT ? names[format] : "?";
+	}
+
+	static bool IsContainerPath(const std::string& path)
+	{
+		return hasExtension(path, ".dds") || hasExtension(path, ".ktx2");
+	}
+
+	// read a .dds or .ktx2 file; false with the reason in error when it is missing, broken or not supported
+	// ------------------------------------------------------------------------
+	static bool Load(const std::string& path, CompressedImage& image, std::string& error)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			error = "can't open file";
+			return false;
+		}
+		std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		if (hasExtension(path, ".ktx2"))
+			return LoadKTX2(bytes, image, error);
+		return LoadDDS(bytes, image, error);
+	}
+
+	// ------------------------------------------------------------------------
+	static bool LoadDDS(const std::vector<unsigned char>& bytes, CompressedImage& image, std::string& error)
+	{
+		if (bytes.size() < 128 || std::memcmp(bytes.data(), "DDS ", 4) != 0 || read32(bytes, 4) != 124)
+		{
+			error = "not a DDS file";
+			return false;
+		}
+		uint32_t flags = read32(bytes, 8), pixelFormatFlags = read32(bytes, 80), caps2 = read32(bytes, 112);
+		uint32_t height = read32(bytes, 12), width = read32(bytes, 16);
+		uint32_t levelCount = flags & DDSD_MIPMAPCOUNT ? std::max(read32(bytes, 28), 1u) : 1;
+		if (!checkSize(width, height, levelCount, error))
+			return false;
+		if (!(pixelFormatFlags & DDPF_FOURCC))
+		{
+			error = "uncompressed DDS pixel formats are not supported";
+			return false;
+		}
+		if (caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+		{
+			error = "cube map and volume DDS files are not supported";
+			return false;
+		}
+
+		size_t offset = 128;
+		image.format = TEXTURE_BLOCK_NONE;
+		std::string fourCC((const char*)&bytes[84], 4);
+		if (fourCC == "DX10")
+		{
+			if (bytes.size() < 148 || read32(bytes, 128 + 12) > 1)
+			{
+				error = "texture arrays are not supported";
+				return false;
+			}
+			uint32_t dxgiFormat = read32(bytes, 128);
+			offset = 148;
+			for (const DxgiFormat& entry : DXGI_FORMATS)
+				if (entry.dxgi == dxgiFormat)
+				{
+					image.format = entry.format;
+					image.srgb = entry.srgb;
+				}
+		}
+		else
+		{
+			const char* codes[][2] = { { "DXT1", "" }, { "DXT3", "DXT2" }, { "DXT5", "DXT4" }, { "ATI1", "BC4U" }, { "ATI2", "BC5U" } };
+			for (int i = 0; i < 5; i++)
+				if (fourCC == codes[i][0] || fourCC == codes[i][1])
+					image.format = (TextureBlockFormat)(TEXTURE_BC1 + i);
+			image.srgb = false;
+		}
+		if (image.format == TEXTURE_BLOCK_NONE)
+		{
+			error = "unsupported DDS format " + fourCC;
+			return false;
+		}
+
+		// the levels follow each other, largest first
+		image.width = (int)width;
+		image.height = (int)height;
+		image.levels.clear();
+		size_t dataSize = 0;
+		for (int level = 0; level < (int)levelCount; level++)
+		{
+			int levelWidth = std::max(image.width >> level, 1), levelHeight = std::max(image.height >> level, 1);
+			size_t size = LevelSize(image.format, levelWidth, levelHeight);
+			image.levels.push_back(CompressedLevel{ levelWidth, levelHeight, dataSize, size });
+			dataSize += size;
+		}
+		if (dataSize > bytes.size() - offset)
+		{
+			error = "DDS file is truncated";
+			return false;
+		}
+		image.data.assign(bytes.begin() + offset, bytes.begin() + offset + dataSize);
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	static bool LoadKTX2(const std::vector<unsigned char>& bytes, CompressedImage& image, std::string& error)
+	{
+		static const unsigned char identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+		if (bytes.size() < 80 || std::memcmp(bytes.data(), identifier, 12) != 0)
+		{
+			error = "not a KTX2 file";
+			return false;
+		}
+		uint32_t vkFormat = read32(bytes, 12);
+		uint32_t width = read32(bytes, 20), height = read32(bytes, 24);
+		uint32_t depth = read32(bytes, 28), layers = read32(bytes, 32), faces = read32(bytes, 36);
+		uint32_t levelCount = std::max(read32(bytes, 40), 1u);
+		if (!checkSize(width, height, levelCount, error))
+			return false;
+		if (read32(bytes, 44) != 0)
+		{
+			error = "supercompressed KTX2 (Basis Universal, zstd) is not supported";
+			return false;
+		}
+		if (depth > 0 || layers > 0 || faces != 1)
+		{
+			error = "KTX2 arrays, cube maps and volumes are not supported";
+			return false;
+		}
+		image.format = TEXTURE_BLOCK_NONE;
+		for (const VulkanFormat& entry : VULKAN_FORMATS)
+			if (entry.vulkan == vkFormat)
+			{
+				image.format = entry.format;
+				image.srgb = entry.srgb;
+			}
+		if (image.format == TEXTURE_BLOCK_NONE)
+		{
+			error = "unsupported KTX2 vkFormat " + std::to_string(vkFormat);
+			return false;
+		}
+		if (80 + (size_t)levelCount * 24 > bytes.size())
+		{
+			error = "KTX2 file is truncated";
+			return false;
+		}
+
+		// the level index lists every level's place in the file (the data is stored smallest level first)
+		image.width = (int)width;
+		image.height = (int)height;
+		image.levels.clear();
+		image.data.clear();
+		for (int level = 0; level < (int)levelCount; level++)
+		{
+			uint64_t offset = read64(bytes, 80 + level * 24), size = read64(bytes, 80 + level * 24 + 8);
+			int levelWidth = std::max(image.width >> level, 1), levelHeight = std::max(image.height >> level, 1);
+			if (offset > bytes.size() || size > bytes.size() - offset || size != LevelSize(image.format, levelWidth, levelHeight))
+			{
+				error = "KTX2 level " + std::to_string(level) + " is truncated or has the wrong size";
+				return false;
+			}
+			image.levels.push_back(CompressedLevel{ levelWidth, levelHeight, image.data.size(), (size_t)size });
+			image.data.insert(image.data.end(), bytes.begin() + offset, bytes.begin() + offset + size);
+		}
+		return true;
+	}
+
+	// write a DDS file: DXT1/DXT3/DXT5/ATI1/ATI2 FourCC headers where they exist, a DX10 header for the rest
+	// ------------------------------------------------------------------------
+	static bool SaveDDS(const std::string& path, const CompressedImage& image)
+	{
+		bool dx10 = image.srgb || image.format >= TEXTURE_BC6H;
+		std::vector<unsigned char> header(dx10 ? 148 : 128, 0);
+		std::memcpy(header.data(), "DDS ", 4);
+		write32(header, 4, 124);
+		write32(header, 8, DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE | (image.levels.size() > 1 ? DDSD_MIPMAPCOUNT : 0));
+		write32(header, 12, image.height);
+		write32(header, 16, image.width);
+		write32(header, 20, (uint32_t)(image.levels.empty() ? 0 : image.levels[0].size));
+		write32(header, 28, (uint32_t)image.levels.size());
+		write32(header, 76, 32);
+		write32(header, 80, DDPF_FOURCC);
+		write32(header, 108, DDSCAPS_TEXTURE | (image.levels.size() > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0));
+		if (dx10)
+		{
+			std::memcpy(&header[84], "DX10", 4);
+			for (const DxgiFormat& entry : DXGI_FORMATS)
+				if (entry.format == image.format && entry.srgb == image.srgb)
+					write32(header, 128, entry.dxgi);
+			write32(header, 132, 3);  // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+			write32(header, 140, 1);  // array size
+		}
+		else
+		{
+			const char* codes[] = { "DXT1", "DXT3", "DXT5", "ATI1", "ATI2" };
+			std::memcpy(&header[84], codes[image.format - TEXTURE_BC1], 4);
+		}
+
+		std::ofstream file(path, std::ios::binary);
+		file.write((const char*)header.data(), header.size());
+		file.write((const char*)image.data.data(), image.data.size());
+		return (bool)file;
+	}
+
+private:
+	static const uint32_t DDSD_CAPS = 0x1, DDSD_HEIGHT = 0x2, DDSD_WIDTH = 0x4, DDSD_PIXELFORMAT = 0x1000;
+	static const uint32_t DDSD_MIPMAPCOUNT = 0x20000, DDSD_LINEARSIZE = 0x80000;
+	static const uint32_t DDPF_FOURCC = 0x4;
+	static const uint32_t DDSCAPS_COMPLEX = 0x8, DDSCAPS_TEXTURE = 0x1000, DDSCAPS_MIPMAP = 0x400000;
+	static const uint32_t DDSCAPS2_CUBEMAP = 0x200, DDSCAPS2_VOLUME = 0x200000;
+
+	struct DxgiFormat { uint32_t dxgi; TextureBlockFormat format; bool srgb; };
+	struct VulkanFormat { uint32_t vulkan; TextureBlockFormat format; bool srgb; };
+
+	static constexpr DxgiFormat DXGI_FORMATS[] = {
+		{ 71, TEXTURE_BC1, false }, { 72, TEXTURE_BC1, true }, { 74, TEXTURE_BC2, false }, { 75, TEXTURE_BC2, true },
+		{ 77, TEXTURE_BC3, false }, { 78, TEXTURE_BC3, true }, { 80, TEXTURE_BC4, false }, { 83, TEXTURE_BC5, false },
+		{ 95, TEXTURE_BC6H, false }, { 98, TEXTURE_BC7, false }, { 99, TEXTURE_BC7, true } };
+	static constexpr VulkanFormat VULKAN_FORMATS[] = {
+		{ 131, TEXTURE_BC1, false }, { 132, TEXTURE_BC1, true }, { 133, TEXTURE_BC1, false }, { 134, TEXTURE_BC1, true },
+		{ 135, TEXTURE_BC2, false }, { 136, TEXTURE_BC2, true }, { 137, TEXTURE_BC3, false }, { 138, TEXTURE_BC3, true },
+		{ 139, TEXTURE_BC4, false }, { 141, TEXTURE_BC5, false }, { 143, TEXTURE_BC6H, false }, { 145, TEXTURE_BC7, false },
+		{ 146, TEXTURE_BC7, true } };
+
+	// header sizes are checked before anything is computed from them
+	static bool checkSize(uint32_t width, uint32_t height, uint32_t levelCount, std::string& error)
+	{
+		if (width == 0 || height == 0 || width > (uint32_t)MAX_DIMENSION || height > (uint32_t)MAX_DIMENSION)
+		{
+			error = "bad size " + std::to_string(width) + "x" + std::to_string(height);
+			return false;
+		}
+		if (levelCount > (uint32_t)MaxLevelCount((int)width, (int)height))
+		{
+			error = std::to_string(levelCount) + " mip levels is more than a " + std::to_string(width) + "x" + std::to_string(height) + " image has";
+			return false;
+		}
+		return true;
+	}
+
+	static bool hasExtension(const std::string& path, const char* extension)
+	{
+		size_t length = std::strlen(extension);
+		if (path.size() < length)
+			return false;
+		for (size_t i = 0; i < length; i++)
+			if (std::tolower((unsigned char)path[path.size() - length + i]) != extension[i])
+				return false;
+		return true;
+	}
+
+	// both containers are little endian
+	static uint32_t read32(const std::vector<unsigned char>& bytes, size_t offset)
+	{
+		return (uint32_t)bytes[offset] | (uint32_t)bytes[offset + 1] << 8 | (uint32_t)bytes[offset + 2] << 16 | (uint32_t)bytes[offset + 3] << 24;
+	}
+
+	static uint64_t read64(const std::vector<unsigned char>& bytes, size_t offset)
+	{
+		return (uint64_t)read32(bytes, offset) | (uint64_t)read32(bytes, offset + 4) << 32;
+	}
+
+	static void write32(std::vector<unsigned char>& bytes, size_t offset, uint32_t value)
+	{
+		for (int i = 0; i < 4; i++)
+			bytes[offset + i] = (unsigned char)(value >> (i * 8));
+	}
+};
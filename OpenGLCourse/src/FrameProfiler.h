@@ -0,0 +1,306 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Frame profiler: CPU time per stage with a high resolution clock and GPU time per stage with
+// GL_TIME_ELAPSED queries. Queries live in a ring of QUERY_LATENCY frames and are only read back
+// once GL_QUERY_RESULT_AVAILABLE says so, the profiler never stalls the pipeline waiting on the GPU.
+// Only the last HISTORY_FRAMES frames are kept (a ring), so a long windowed session doesn't grow without bound;
+// the summary and the report cover those.
+class FrameProfiler
+{
+public:
+	static const int QUERY_LATENCY = 4;     // frames in flight before a query set is reused
+	static const int HISTORY_FRAMES = 3600; // frames kept for the report, a minute at 60 Hz
+	static_assert(QUERY_LATENCY <= HISTORY_FRAMES, "a frame must still be in the history when its queries are read");
+
+	// a disabled profiler turns every call into a no-op so the render loop can call it unconditionally
+	FrameProfiler(bool enabled, const std::vector<std::string>& stageNames)
+		: m_Enabled(enabled), m_StageNames(stageNames), m_StageCount((int)stageNames.size())
+	{
+		if (!m_Enabled)
+			return;
+		m_Queries.resize(QUERY_LATENCY * m_StageCount);
+		m_QueryIssued.resize(QUERY_LATENCY * m_StageCount, false);
+		m_QueryFrame.resize(QUERY_LATENCY, -1);
+		m_Frames.reserve(HISTORY_FRAMES);
+		glGenQueries((int)m_Queries.size(), m_Queries.data());
+		m_Origin = Clock::now();
+	}
+
+	~FrameProfiler()
+	{
+		if (m_Enabled)
+			glDeleteQueries((int)m_Queries.size(), m_Queries.data());
+	}
+
+	// frame boundaries
+	// ------------------------------------------------------------------------
+	void BeginFrame()
+	{
+		if (!m_Enabled)
+			return;
+		m_Slot = (int)(m_FrameCount % QUERY_LATENCY);
+		collect(m_Slot, false); // results of the frame that used this slot QUERY_LATENCY frames ago
+
+		// the oldest frame makes room once the history is full
+		if (m_Frames.size() < (size_t)HISTORY_FRAMES)
+			m_Frames.emplace_back();
+		Frame& frame = m_Frames[m_FrameCount % HISTORY_FRAMES];
+		frame.start = now();
+		frame.duration = 0.0;
+		frame.cpuStart.assign(m_StageCount, -1.0);
+		frame.cpuTime.assign(m_StageCount, 0.0);
+		frame.gpuTime.assign(m_StageCount, -1.0);
+		m_QueryFrame[m_Slot] = m_FrameCount++;
+	}
+
+	void EndFrame()
+	{
+		if (!m_Enabled)
+			return;
+		Frame& frame = current();
+		frame.duration = now() - frame.start;
+	}
+
+	// stage scopes, stages must not nest (only one GL_TIME_ELAPSED query can be active)
+	// ------------------------------------------------------------------------
+	void BeginStage(int stage)
+	{
+		if (!m_Enabled)
+			return;
+		int query = m_Slot * m_StageCount + stage;
+		glBeginQuery(GL_TIME_ELAPSED, m_Queries[query]);
+		m_QueryIssued[query] = true;
+		current().cpuStart[stage] = now();
+	}
+
+	void EndStage(int stage)
+	{
+		if (!m_Enabled)
+			return;
+		Frame& frame = current();
+		frame.cpuTime[stage] += now() - frame.cpuStart[stage];
+		glEndQuery(GL_TIME_ELAPSED);
+	}
+
+	// wait for the queries still in flight (only at shutdown), print percentiles and write the report
+	// ------------------------------------------------------------------------
+	void Finish(const std::string& outputPath)
+	{
+		if (!m_Enabled || m_Frames.empty())
+			return;
+		for (int slot = 0; slot < QUERY_LATENCY; slot++)
+			collect(slot, true);
+
+		printSummary();
+		if (outputPath.size() >= 4 && outputPath.compare(outputPath.size() - 4, 4, ".csv") == 0)
+			writeCSV(outputPath);
+		else
+			writeChromeTrace(outputPath);
+	}
+
+private:
+	typedef std::conditional<std::chrono::high_resolution_clock::is_steady,
+		std::chrono::high_resolution_clock, std::chrono::steady_clock>::type Clock;
+
+	struct Frame
+	{
+		double start = 0.0, duration = 0.0;   // microseconds since the profiler was created
+		std::vector<double> cpuStart;          // per stage, -1 when the stage didn't run this frame
+		std::vector<double> cpuTime;           // per stage, microseconds
+		std::vector<double> gpuTime;           // per stage, microseconds, -1 when unknown
+	};
+
+	struct Percentiles { double p50, p95, p99; };
+
+	Frame& current() { return m_Frames[(m_FrameCount - 1) % HISTORY_FRAMES]; }
+
+	// the kept frames oldest first: number of the first one, and the i-th of them
+	long long firstFrame() const { return m_FrameCount - (long long)m_Frames.size(); }
+	const Frame& frame(size_t i) const { return m_Frames[(firstFrame() + i) % HISTORY_FRAMES]; }
+
+	double now() const
+	{
+		return std::chrono::duration<double, std::micro>(Clock::now() - m_Origin).count();
+	}
+
+	// read back the query set of a ring slot; without wait the results are dropped if not ready yet
+	void collect(int slot, bool wait)
+	{
+		long long frameNumber = m_QueryFrame[slot];
+		if (frameNumber < 0)
+			return;
+		m_QueryFrame[slot] = -1;
+
+		Frame& frame = m_Frames[frameNumber % HISTORY_FRAMES];
+		for (int stage = 0; stage < m_StageCount; stage++)
+		{
+			int query = slot * m_StageCount + stage;
+			if (!m_QueryIssued[query])
+				continue;
+			m_QueryIssued[query] = false;
+
+			GLint available = 0;
+			if (!wait)
+				glGetQueryObjectiv(m_Queries[query], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (wait || available)
+			{
+				GLuint64 elapsed = 0;
+				glGetQueryObjectui64v(m_Queries[query], GL_QUERY_RESULT, &elapsed);
+				frame.gpuTime[stage] = elapsed / 1000.0;
+			}
+			else
+			{
+				m_DroppedQueries++;
+			}
+		}
+	}
+
+	static Percentiles percentiles(std::vector<double> values)
+	{
+		if (values.empty())
+			return { -1.0, -1.0, -1.0 };
+		std::sort(values.begin(), values.end());
+		auto rank = [&](double p) { return values[std::min(values.size() - 1, (size_t)(p * values.size()))]; };
+		return { rank(0.50), rank(0.95), rank(0.99) };
+	}
+
+	// per stage (plus the whole frame at index m_StageCount) CPU and GPU samples
+	std::vector<double> samples(int stage, bool gpu) const
+	{
+		std::vector<double> values;
+		for (size_t i = 0; i < m_Frames.size(); i++)
+		{
+			const Frame& frame = this->frame(i);
+			if (stage == m_StageCount)
+				values.push_back(frame.duration);
+			else if (gpu && frame.gpuTime[stage] >= 0.0)
+				values.push_back(frame.gpuTime[stage]);
+			else if (!gpu && frame.cpuStart[stage] >= 0.0)
+				values.push_back(frame.cpuTime[stage]);
+		}
+		return values;
+	}
+
+	std::string stageName(int stage) const { return stage == m_StageCount ? "frame" : m_StageNames[stage]; }
+
+	void printSummary() const
+	{
+		std::cout << "Frame profile (last " << m_Frames.size() << " of " << m_FrameCount << " frames, " << m_DroppedQueries << " GPU queries not ready in time), microseconds:" << std::endl;
+		std::cout << std::fixed << std::setprecision(1);
+		for (int stage = 0; stage <= m_StageCount; stage++)
+		{
+			Percentiles cpu = percentiles(samples(stage, false));
+			std::cout << "  " << std::setw(14) << std::left << stageName(stage) << std::right
+				<< " cpu p50 " << std::setw(9) << cpu.p50 << " p95 " << std::setw(9) << cpu.p95 << " p99 " << std::setw(9) << cpu.p99;
+			if (stage < m_StageCount)
+			{
+				Percentiles gpu = percentiles(samples(stage, true));
+				std::cout << " | gpu p50 " << std::setw(9) << gpu.p50 << " p95 " << std::setw(9) << gpu.p95 << " p99 " << std::setw(9) << gpu.p99;
+			}
+			std::cout << std::endl;
+		}
+		std::cout.unsetf(std::ios::floatfield);
+	}
+
+	// Chrome trace_event format (chrome://tracing, Perfetto): CPU stages on thread 1, GPU stages on thread 2
+	void writeChromeTrace(const std::string& path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+		{
+			std::cout << "ERROR::PROFILER::FAILED_TO_OPEN_FILE: " << path << std::endl;
+			return;
+		}
+
+		out << std::fixed << std::setprecision(3);
+		out << "{\"traceEvents\":[\n";
+		out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n";
+		out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+		for (size_t i = 0; i < m_Frames.size(); i++)
+		{
+			const Frame& frame = this->frame(i);
+			out << ",\n{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << frame.start
+				<< ",\"dur\":" << frame.duration << ",\"args\":{\"frame\":" << firstFrame() + (long long)i << "}}";
+			for (int stage = 0; stage < m_StageCount; stage++)
+			{
+				if (frame.cpuStart[stage] < 0.0)
+					continue;
+				out << ",\n{\"name\":\"" << m_StageNames[stage] << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+					<< frame.cpuStart[stage] << ",\"dur\":" << frame.cpuTime[stage] << "}";
+				// GPU timings have no timestamp of their own, they are placed at the CPU submit time of the stage
+				if (frame.gpuTime[stage] >= 0.0)
+					out << ",\n{\"name\":\"" << m_StageNames[stage] << "\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":"
+						<< frame.cpuStart[stage] << ",\"dur\":" << frame.gpuTime[stage] << "}";
+			}
+		}
+		out << "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"frames\":" << m_Frames.size() << ",\"percentiles_us\":{";
+		for (int stage = 0; stage <= m_StageCount; stage++)
+		{
+			Percentiles cpu = percentiles(samples(stage, false));
+			out << (stage ? "," : "") << "\n\"" << stageName(stage) << "\":{\"cpu\":{\"p50\":" << cpu.p50 << ",\"p95\":" << cpu.p95 << ",\"p99\":" << cpu.p99 << "}";
+			if (stage < m_StageCount)
+			{
+				Percentiles gpu = percentiles(samples(stage, true));
+				out << ",\"gpu\":{\"p50\":" << gpu.p50 << ",\"p95\":" << gpu.p95 << ",\"p99\":" << gpu.p99 << "}";
+			}
+			out << "}";
+		}
+		out << "\n}}}\n";
+		std::cout << "Frame trace written to " << path << std::endl;
+	}
+
+	// one row per frame, one cpu/gpu column pair per stage (microseconds, empty when not measured)
+	void writeCSV(const std::string& path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+		{
+			std::cout << "ERROR::PROFILER::FAILED_TO_OPEN_FILE: " << path << std::endl;
+			return;
+		}
+
+		out << "frame,frame_cpu_us";
+		for (const std::string& name : m_StageNames)
+			out << "," << name << "_cpu_us," << name << "_gpu_us";
+		out << "\n" << std::fixed << std::setprecision(3);
+		for (size_t i = 0; i < m_Frames.size(); i++)
+		{
+			const Frame& frame = this->frame(i);
+			out << firstFrame() + (long long)i << "," << frame.duration;
+			for (int stage = 0; stage < m_StageCount; stage++)
+			{
+				out << ",";
+				if (frame.cpuStart[stage] >= 0.0) out << frame.cpuTime[stage];
+				out << ",";
+				if (frame.gpuTime[stage] >= 0.0) out << frame.gpuTime[stage];
+			}
+			out << "\n";
+		}
+		std::cout << "Frame profile written to " << path << std::endl;
+	}
+
+private:
+	bool m_Enabled;
+	std::vector<std::string> m_StageNames;
+	int m_StageCount;
+
+	std::vector<GLuint> m_Queries;     // QUERY_LATENCY * stage count GL_TIME_ELAPSED query objects
+	std::vector<bool> m_QueryIssued;   // query was begun since its last read back
+	std::vector<long long> m_QueryFrame; // frame number recorded by each ring slot, -1 when collected
+	int m_Slot = 0;
+	int m_DroppedQueries = 0;
+
+	Clock::time_point m_Origin;
+	std::vector<Frame> m_Frames;       // ring of the last HISTORY_FRAMES frames, frame n at n % HISTORY_FRAMES
+	long long m_FrameCount = 0;        // frames begun so far
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <glad/glad.h>
+
+// Declarations of the extensions glad.c loads on top of the generated GL 4.6 set, in the form glad.h would have
+// them had it been generated with these extensions. Check the GLAD_GL_* flag before calling an entry point: in
+// GLAD_ON_DEMAND builds the pointers are never NULL, an unsupported function aborts on its first call.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// GL_ARB_parallel_shader_compile / GL_KHR_parallel_shader_compile: compile and link on driver threads, the
+// completion status can be polled without waiting for them
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_ARB
+#define GL_MAX_SHADER_COMPILER_THREADS_ARB 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_ARB
+#define GL_COMPLETION_STATUS_ARB 0x91B1
+#endif
+
+extern int GLAD_GL_ARB_parallel_shader_compile;
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSARBPROC)(GLuint count);
+extern PFNGLMAXSHADERCOMPILERTHREADSARBPROC glad_glMaxShaderCompilerThreadsARB;
+#define glMaxShaderCompilerThreadsARB glad_glMaxShaderCompilerThreadsARB
+
+extern int GLAD_GL_KHR_parallel_shader_compile;
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR
+
+// GL_EXT_texture_compression_s3tc (BC1 to BC3): formats only, no entry points. Not core in any GL version but
+// exposed by all desktop drivers.
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+extern int GLAD_GL_EXT_texture_compression_s3tc;
+
+// GL_ARB_texture_compression_bptc (BC6H and BC7): core since GL 4.2 with the same values, the extension brings
+// them to 3.3 contexts
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM_ARB
+#define GL_COMPRESSED_RGBA_BPTC_UNORM_ARB 0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_ARB
+#define GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_ARB 0x8E8F
+#endif
+
+extern int GLAD_GL_ARB_texture_compression_bptc;
+
+#ifdef __cplusplus
+}
+#endif
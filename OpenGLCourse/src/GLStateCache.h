@@ -0,0 +1,186 @@
+#pragma once
+#include <glad/glad.h>
+
+// GL calls made and skipped by the state cache
+struct GLStateStats
+{
+	int issued = 0;   // reached the driver
+	int elided = 0;   // skipped, the state was already set
+};
+
+// Shadow copy of the bind points and render states the renderer changes every frame (program, vertex array,
+// active texture unit, 2D texture per unit, blending, clear color). Every setter compares with the copy and only
+// calls GL when the value actually changes, so code can set the state it needs unconditionally.
+// Only correct while everything changes this state through the cache: after code that binds behind its back call
+// Invalidate(), and after deleting a program/vertex array/texture call the matching Forget*() because GL resets
+// or reuses those bindings.
+class GLStateCache
+{
+public:
+	static const int MAX_TEXTURE_UNITS = 32; // units tracked, higher units always reach the driver
+
+	// the cache of the current context (the app has one)
+	static GLStateCache& Get()
+	{
+		static GLStateCache cache;
+		return cache;
+	}
+
+	GLStateCache(const GLStateCache&) = delete;
+	GLStateCache& operator=(const GLStateCache&) = delete;
+
+	// bind points
+	// ------------------------------------------------------------------------
+	void UseProgram(unsigned int program)
+	{
+		if (changed(m_Program, program))
+			glUseProgram(program);
+	}
+
+	void BindVertexArray(unsigned int vertexArray)
+	{
+		if (changed(m_VertexArray, vertexArray))
+			glBindVertexArray(vertexArray);
+	}
+
+	void ActiveTexture(int unit)
+	{
+		if (changed(m_ActiveUnit, (unsigned int)unit))
+			glActiveTexture(GL_TEXTURE0 + unit);
+	}
+
+	// GL_TEXTURE_2D binding of a unit, also makes it the active unit even when the binding is elided, so
+	// glTexParameter*/glTexImage* calls after it always reach this texture (texture uploads use unit 0)
+	void BindTexture(int unit, unsigned int texture)
+	{
+		ActiveTexture(unit);
+		if (unit >= MAX_TEXTURE_UNITS)
+		{
+			glBindTexture(GL_TEXTURE_2D, texture);
+			m_Frame.issued++;
+			return;
+		}
+		if (m_Textures[unit] == texture)
+		{
+			m_Frame.elided++;
+			return;
+		}
+		changed(m_Textures[unit], texture);
+		glBindTexture(GL_TEXTURE_2D, texture);
+	}
+
+	// render states
+	// ------------------------------------------------------------------------
+	void SetBlend(bool enabled)
+	{
+		if (!changed(m_Blend, enabled ? 1u : 0u))
+			return;
+		if (enabled)
+			glEnable(GL_BLEND);
+		else
+			glDisable(GL_BLEND);
+	}
+
+	void BlendFunc(GLenum source, GLenum destination)
+	{
+		// one call either way, count it once
+		if (m_BlendSource == source && m_BlendDestination == destination)
+		{
+			m_Frame.elided++;
+			return;
+		}
+		m_BlendSource = source;
+		m_BlendDestination = destination;
+		m_Frame.issued++;
+		glBlendFunc(source, destination);
+	}
+
+	void ClearColor(float r, float g, float b, float a)
+	{
+		if (m_ClearColorKnown && m_ClearColor[0] == r && m_ClearColor[1] == g && m_ClearColor[2] == b && m_ClearColor[3] == a)
+		{
+			m_Frame.elided++;
+			return;
+		}
+		m_ClearColor[0] = r; m_ClearColor[1] = g; m_ClearColor[2] = b; m_ClearColor[3] = a;
+		m_ClearColorKnown = true;
+		m_Frame.issued++;
+		glClearColor(r, g, b, a);
+	}
+
+	// keeping the shadow copy in sync
+	// ------------------------------------------------------------------------
+	// forget everything, the next call of every setter reaches GL
+	void Invalidate()
+	{
+		m_Program = UNKNOWN;
+		m_VertexArray = UNKNOWN;
+		m_ActiveUnit = UNKNOWN;
+		for (unsigned int& texture : m_Textures)
+			texture = UNKNOWN;
+		m_Blend = UNKNOWN;
+		m_BlendSource = m_BlendDestination = UNKNOWN;
+		m_ClearColorKnown = false;
+	}
+
+	// call after deleting the object, its name may be handed out again for a new one
+	void ForgetProgram(unsigned int program)
+	{
+		if (m_Program == program)
+			m_Program = UNKNOWN;
+	}
+
+	void ForgetVertexArray(unsigned int vertexArray)
+	{
+		if (m_VertexArray == vertexArray)
+			m_VertexArray = UNKNOWN;
+	}
+
+	void ForgetTexture(unsigned int texture)
+	{
+		for (unsigned int& bound : m_Textures)
+			if (bound == texture)
+				bound = UNKNOWN;
+	}
+
+	// counters
+	// ------------------------------------------------------------------------
+	// close the frame: its counters become GetFrameStats() and are added to GetTotalStats()
+	void EndFrame()
+	{
+		m_LastFrame = m_Frame;
+		m_Total.issued += m_Frame.issued;
+		m_Total.elided += m_Frame.elided;
+		m_Frame = GLStateStats();
+	}
+
+	const GLStateStats& GetFrameStats() const { return m_LastFrame; }
+	const GLStateStats& GetTotalStats() const { return m_Total; }
+
+private:
+	static const unsigned int UNKNOWN = 0xFFFFFFFFu; // never a valid GL name or enum, the first set always reaches GL
+
+	GLStateCache() { Invalidate(); }
+
+	// store the value and count the call, true when GL has to be called
+	bool changed(unsigned int& shadow, unsigned int value)
+	{
+		if (shadow == value)
+		{
+			m_Frame.elided++;
+			return false;
+		}
+		shadow = value;
+		m_Frame.issued++;
+		return true;
+	}
+
+private:
+	unsigned int m_Program, m_VertexArray, m_ActiveUnit;
+	unsigned int m_Textures[MAX_TEXTURE_UNITS];
+	unsigned int m_Blend, m_BlendSource, m_BlendDestination;
+	float m_ClearColor[4] = {};
+	bool m_ClearColorKnown = false;
+
+	GLStateStats m_Frame, m_LastFrame, m_Total;
+};
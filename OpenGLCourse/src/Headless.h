@@ -0,0 +1,265 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Headless rendering: a surfaceless EGL context (Mesa llvmpipe works without GPU or display server)
+// plus an offscreen framebuffer the render loop draws into instead of the window back buffer.
+#if defined(__has_include)
+#if __has_include(<EGL/egl.h>)
+#define HEADLESS_SUPPORTED 1
+#endif
+#endif
+
+#ifdef HEADLESS_SUPPORTED
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+class HeadlessContext
+{
+public:
+	// creates an OpenGL 3.3 core context with no surface and makes it current on this thread
+	bool Create(int major, int minor)
+	{
+		// prefer Mesa's surfaceless platform, it doesn't need X11/Wayland or a DRM device
+		auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay)
+			m_Display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		if (m_Display == EGL_NO_DISPLAY)
+			m_Display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		if (m_Display == EGL_NO_DISPLAY || !eglInitialize(m_Display, NULL, NULL))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_DISPLAY_NOT_AVAILABLE" << std::endl;
+			return false;
+		}
+
+		if (!eglBindAPI(EGL_OPENGL_API))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_OPENGL_API_NOT_SUPPORTED" << std::endl;
+			return false;
+		}
+
+		// we never draw to an EGL surface, any OpenGL capable config will do (or none at all with EGL_KHR_no_config_context)
+		EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+		EGLConfig config = EGL_NO_CONFIG_KHR;
+		EGLint numConfigs = 0;
+		if (!eglChooseConfig(m_Display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0)
+			config = EGL_NO_CONFIG_KHR;
+
+		EGLint contextAttribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION, major,
+			EGL_CONTEXT_MINOR_VERSION, minor,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		m_Context = eglCreateContext(m_Display, config, EGL_NO_CONTEXT, contextAttribs);
+		if (m_Context == EGL_NO_CONTEXT)
+		{
+			std::cout << "ERROR::HEADLESS::EGL_CONTEXT_CREATION_FAILED: 0x" << std::hex << eglGetError() << std::dec << std::endl;
+			return false;
+		}
+
+		if (!eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_Context))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_MAKE_CURRENT_FAILED (EGL_KHR_surfaceless_context missing?)" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	~HeadlessContext()
+	{
+		if (m_Display == EGL_NO_DISPLAY)
+			return;
+		eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (m_Context != EGL_NO_CONTEXT)
+			eglDestroyContext(m_Display, m_Context);
+		eglTerminate(m_Display);
+	}
+
+	// loader for gladLoadGLLoader
+	static void* GetProcAddress(const char* name) { return (void*)eglGetProcAddress(name); }
+
+private:
+	EGLDisplay m_Display = EGL_NO_DISPLAY;
+	EGLContext m_Context = EGL_NO_CONTEXT;
+};
+#endif // HEADLESS_SUPPORTED
+
+// Offscreen framebuffer (color + depth/stencil renderbuffers) used as the default render target in headless mode
+class OffscreenTarget
+{
+public:
+	OffscreenTarget(int width, int height) : m_Width(width), m_Height(height)
+	{
+		glGenFramebuffers(1, &m_FBO);
+		glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+
+		glGenRenderbuffers(1, &m_Color);
+		glBindRenderbuffer(GL_RENDERBUFFER, m_Color);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_Color);
+
+		glGenRenderbuffers(1, &m_DepthStencil);
+		glBindRenderbuffer(GL_RENDERBUFFER, m_DepthStencil);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthStencil);
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			std::cout << "ERROR::FRAMEBUFFER::NOT_COMPLETE" << std::endl;
+
+		glViewport(0, 0, width, height);
+	}
+
+	~OffscreenTarget()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glDeleteRenderbuffers(1, &m_Color);
+		glDeleteRenderbuffers(1, &m_DepthStencil);
+		glDeleteFramebuffers(1, &m_FBO);
+	}
+
+	// read back the color attachment as tightly packed RGBA rows, top row first
+	std::vector<unsigned char> ReadPixels() const
+	{
+		std::vector<unsigned char> pixels((size_t)m_Width * m_Height * 4);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, m_FBO);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glReadPixels(0, 0, m_Width, m_Height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+		// OpenGL's origin is the bottom-left corner, image files start at the top
+		const size_t rowSize = (size_t)m_Width * 4;
+		std::vector<unsigned char> row(rowSize);
+		for (int y = 0; y < m_Height / 2; y++)
+		{
+			unsigned char* top = pixels.data() + y * rowSize;
+			unsigned char* bottom = pixels.data() + (m_Height - 1 - y) * rowSize;
+			std::copy(top, top + rowSize, row.begin());
+			std::copy(bottom, bottom + rowSize, top);
+			std::copy(row.begin(), row.end(), bottom);
+		}
+		return pixels;
+	}
+
+	int Width() const { return m_Width; }
+	int Height() const { return m_Height; }
+
+private:
+	int m_Width, m_Height;
+	unsigned int m_FBO = 0, m_Color = 0, m_DepthStencil = 0;
+};
+
+// Minimal PNG encoder (8-bit RGB or RGBA, zlib "stored" blocks) so frame dumps don't need an image library; every
+// row uses the given filter type (0 None, 1 Sub, 2 Up, 3 Average, 4 Paeth)
+// ------------------------------------------------------------------------
+inline std::vector<unsigned char> EncodePNG(int width, int height, int channels, const unsigned char* pixels, int filter = 0)
+{
+	static uint32_t crcTable[256];
+	if (crcTable[1] == 0)
+	{
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			crcTable[n] = c;
+		}
+	}
+
+	auto put32 = [](std::vector<unsigned char>& out, uint32_t v) {
+		out.push_back((unsigned char)(v >> 24)); out.push_back((unsigned char)(v >> 16));
+		out.push_back((unsigned char)(v >> 8));  out.push_back((unsigned char)v);
+	};
+	auto chunk = [&](std::vector<unsigned char>& out, const char* type, const std::vector<unsigned char>& data) {
+		put32(out, (uint32_t)data.size());
+		size_t start = out.size();
+		out.insert(out.end(), type, type + 4);
+		out.insert(out.end(), data.begin(), data.end());
+		uint32_t crc = 0xFFFFFFFFu;
+		for (size_t i = start; i < out.size(); i++)
+			crc = crcTable[(crc ^ out[i]) & 0xFF] ^ (crc >> 8);
+		put32(out, crc ^ 0xFFFFFFFFu);
+	};
+
+	// filtered scanlines, each prefixed with its filter type
+	const size_t rowSize = (size_t)width * channels;
+	std::vector<unsigned char> raw;
+	raw.reserve((rowSize + 1) * height);
+	for (int y = 0; y < height; y++)
+	{
+		const unsigned char* row = pixels + y * rowSize;
+		const unsigned char* above = y > 0 ? row - rowSize : NULL;
+		raw.push_back((unsigned char)filter);
+		for (size_t i = 0; i < rowSize; i++)
+		{
+			int left = i >= (size_t)channels ? row[i - channels] : 0;
+			int up = above ? above[i] : 0;
+			int upLeft = above && i >= (size_t)channels ? above[i - channels] : 0;
+			int predictor = 0;
+			if (filter == 1)
+				predictor = left;
+			else if (filter == 2)
+				predictor = up;
+			else if (filter == 3)
+				predictor = (left + up) / 2;
+			else if (filter == 4)
+			{
+				int estimate = left + up - upLeft;
+				int toLeft = std::abs(estimate - left), toUp = std::abs(estimate - up), toUpLeft = std::abs(estimate - upLeft);
+				predictor = toLeft <= toUp && toLeft <= toUpLeft ? left : toUp <= toUpLeft ? up : upLeft;
+			}
+			raw.push_back((unsigned char)(row[i] - predictor));
+		}
+	}
+
+	// zlib stream made of uncompressed deflate blocks (max 65535 bytes each)
+	std::vector<unsigned char> idat = { 0x78, 0x01 };
+	uint32_t a = 1, b = 0;
+	for (size_t pos = 0; pos < raw.size(); )
+	{
+		size_t len = std::min<size_t>(65535, raw.size() - pos);
+		bool last = pos + len == raw.size();
+		idat.push_back(last ? 1 : 0);
+		idat.push_back((unsigned char)len); idat.push_back((unsigned char)(len >> 8));
+		idat.push_back((unsigned char)~len); idat.push_back((unsigned char)(~len >> 8));
+		for (size_t i = pos; i < pos + len; i++)
+		{
+			idat.push_back(raw[i]);
+			a = (a + raw[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		pos += len;
+	}
+	put32(idat, (b << 16) | a);
+
+	std::vector<unsigned char> header;
+	put32(header, (uint32_t)width);
+	put32(header, (uint32_t)height);
+	header.insert(header.end(), { 8, (unsigned char)(channels == 4 ? 6 : 2), 0, 0, 0 }); // 8 bit, RGBA or RGB, deflate, adaptive filter, no interlace
+
+	std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	chunk(png, "IHDR", header);
+	chunk(png, "IDAT", idat);
+	chunk(png, "IEND", {});
+	return png;
+}
+
+// frame dump: the RGBA pixels as a PNG file
+// ------------------------------------------------------------------------
+inline bool WritePNG(const char* path, int width, int height, const unsigned char* rgba)
+{
+	std::vector<unsigned char> png = EncodePNG(width, height, 4, rgba);
+	FILE* file = std::fopen(path, "wb");
+	if (!file)
+	{
+		std::cout << "ERROR::PNG::FAILED_TO_OPEN_FILE: " << path << std::endl;
+		return false;
+	}
+	bool ok = std::fwrite(png.data(), 1, png.size(), file) == png.size();
+	std::fclose(file);
+	return ok;
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "GLStateCache.h"
+#include "Shader.h"
+
+// per instance attributes of vshader_instanced.glsl
+struct InstanceData
+{
+	float transform[12];  // rows of an affine 3x4 transform (object -> clip space), row major
+	uint32_t color;       // RGBA8 tint, multiplied into the vertex color
+
+	// translation, rotation around z (radians) and uniform scale
+	static InstanceData Make(float x, float y, float z, float scale, float angle, const vector4& color)
+	{
+		float c = std::cos(angle) * scale, s = std::sin(angle) * scale;
+		auto channel = [](float value) { return (uint32_t)(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f); };
+		return InstanceData{
+			{ c,   -s,   0.0f,  x,
+			  s,    c,   0.0f,  y,
+			  0.0f, 0.0f, scale, z },
+			channel(color.x) | channel(color.y) << 8 | channel(color.z) << 16 | channel(color.w) << 24
+		};
+	}
+};
+
+// A mesh in the vshader.glsl vertex layout (position, color, texture coordinate) drawn many times with one
+// glDrawElementsInstanced: transforms and tints of all copies live in an instance buffer whose attributes
+// advance once per instance (glVertexAttribDivisor). Use it with vshader_instanced.glsl.
+class InstancedMesh
+{
+public:
+	static const int INSTANCE_ATTRIBUTE = 3; // first per instance location, after the three vertex attributes
+
+	// vertices: 8 floats each (position xyz, color rgb, texture coordinate uv); needs a current GL context
+	InstancedMesh(const float* vertices, int vertexCount, const unsigned int* indices, int indexCount) : m_IndexCount(indexCount)
+	{
+		glGenVertexArrays(1, &m_VAO);
+		glGenBuffers(1, &m_VBO);
+		glGenBuffers(1, &m_EBO);
+		glGenBuffers(1, &m_InstanceVBO);
+		GLStateCache& state = GLStateCache::Get();
+		state.BindVertexArray(m_VAO);
+
+		// per vertex data, same layout as the quad in main.cpp
+		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+		glBufferData(GL_ARRAY_BUFFER, vertexCount * 8 * sizeof(float), vertices, GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(unsigned int), indices, GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+		glEnableVertexAttribArray(2);
+
+		// per instance data: three transform rows and the tint, each advancing once per instance
+		glBindBuffer(GL_ARRAY_BUFFER, m_InstanceVBO);
+		for (int row = 0; row < 3; row++)
+		{
+			glVertexAttribPointer(INSTANCE_ATTRIBUTE + row, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, transform) + row * 4 * sizeof(float)));
+			glVertexAttribDivisor(INSTANCE_ATTRIBUTE + row, 1);
+		}
+		glVertexAttribPointer(INSTANCE_ATTRIBUTE + 3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(InstanceData), (void*)offsetof(InstanceData, color));
+		glVertexAttribDivisor(INSTANCE_ATTRIBUTE + 3, 1);
+		setInstanceArrays(true);
+		state.BindVertexArray(0);
+	}
+
+	~InstancedMesh()
+	{
+		glDeleteVertexArrays(1, &m_VAO);
+		GLStateCache::Get().ForgetVertexArray(m_VAO);
+		glDeleteBuffers(1, &m_VBO);
+		glDeleteBuffers(1, &m_EBO);
+		glDeleteBuffers(1, &m_InstanceVBO);
+	}
+
+	InstancedMesh(const InstancedMesh&) = delete;
+	InstancedMesh& operator=(const InstancedMesh&) = delete;
+
+	// replace the instances drawn by Draw(), only needed when they change
+	// ------------------------------------------------------------------------
+	void SetInstances(const InstanceData* instances, int count)
+	{
+		m_Instances.assign(instances, instances + count);
+		glBindBuffer(GL_ARRAY_BUFFER, m_InstanceVBO);
+		// a new data store every time, draws of the previous frame may still read the old one
+		glBufferData(GL_ARRAY_BUFFER, count * sizeof(InstanceData), instances, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	int GetInstanceCount() const { return (int)m_Instances.size(); }
+
+	// every instance in one draw call, the shader has to be bound
+	// ------------------------------------------------------------------------
+	void Draw() const
+	{
+		if (m_Instances.empty())
+			return;
+		GLStateCache::Get().BindVertexArray(m_VAO);
+		glDrawElementsInstanced(GL_TRIANGLES, m_IndexCount, GL_UNSIGNED_INT, 0, (GLsizei)m_Instances.size());
+	}
+
+	// one glDrawElements per instance like before instancing, its attributes set as constant vertex attributes;
+	// only kept to compare both paths (--instancing-bench)
+	// ------------------------------------------------------------------------
+	void DrawSeparately()
+	{
+		GLStateCache::Get().BindVertexArray(m_VAO);
+		setInstanceArrays(false);
+		for (const InstanceData& instance : m_Instances)
+		{
+			for (int row = 0; row < 3; row++)
+				glVertexAttrib4fv(INSTANCE_ATTRIBUTE + row, instance.transform + row * 4);
+			glVertexAttrib4Nub(INSTANCE_ATTRIBUTE + 3, instance.color & 0xFF, (instance.color >> 8) & 0xFF, (instance.color >> 16) & 0xFF, instance.color >> 24);
+			glDrawElements(GL_TRIANGLES, m_IndexCount, GL_UNSIGNED_INT, 0);
+		}
+		setInstanceArrays(true);
+	}
+
+private:
+	// with the arrays disabled the shader reads the current constant attribute values instead
+	void setInstanceArrays(bool enabled)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			if (enabled)
+				glEnableVertexAttribArray(INSTANCE_ATTRIBUTE + i);
+			else
+				glDisableVertexAttribArray(INSTANCE_ATTRIBUTE + i);
+		}
+	}
+
+private:
+	unsigned int m_VAO = 0, m_VBO = 0, m_EBO = 0, m_InstanceVBO = 0;
+	int m_IndexCount;
+	std::vector<InstanceData> m_Instances; // CPU copy, read by DrawSeparately()
+};
@@ -0,0 +1,171 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Thread pool for CPU side frame work (scene update, culling, building command lists). Each thread owns a deque
+// of tasks: it takes its own newest task first (still in cache) and, when it runs dry, steals the oldest task of
+// another thread, so uneven chunks balance out without a central queue everybody contends on. Worker threads
+// never touch the GL context; whatever they produce is handed to GL by the thread that called ParallelFor().
+class JobSystem
+{
+public:
+	// body(begin, end, thread): one chunk of the range, thread in [0, GetThreadCount()) names the running
+	// thread (0 is the caller) so the body can write to per thread storage without locking
+	typedef std::function<void(int begin, int end, int thread)> RangeJob;
+
+	// threadCount includes the calling thread, 0 uses every core
+	explicit JobSystem(int threadCount = 0)
+	{
+		if (threadCount <= 0)
+			threadCount = (int)std::thread::hardware_concurrency();
+		if (threadCount <= 0)
+			threadCount = 1;
+		for (int i = 0; i < threadCount; i++)
+			m_Queues.emplace_back(new TaskQueue());
+		for (int i = 1; i < threadCount; i++)
+			m_Workers.emplace_back(&JobSystem::workerLoop, this, i);
+	}
+
+	~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Quit = true;
+		}
+		m_WorkAvailable.notify_all();
+		for (std::thread& worker : m_Workers)
+			worker.join();
+	}
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	int GetThreadCount() const { return (int)m_Queues.size(); }
+
+	// run body over [0, count) in chunks of at most grain items and return once every chunk ran; the calling
+	// thread works on the chunks too. Not reentrant: bodies must not call ParallelFor() themselves.
+	// ------------------------------------------------------------------------
+	void ParallelFor(int count, int grain, const RangeJob& body)
+	{
+		if (count <= 0)
+			return;
+		if (grain < 1)
+			grain = 1;
+		int chunks = (count + grain - 1) / grain;
+		if (chunks == 1 || m_Queues.size() == 1)
+		{
+			body(0, count, 0);
+			return;
+		}
+
+		// deal the chunks out round robin, stealing evens out whatever the split gets wrong
+		std::atomic<int> remaining(chunks);
+		for (int chunk = 0; chunk < chunks; chunk++)
+		{
+			int begin = chunk * grain;
+			int end = begin + grain < count ? begin + grain : count;
+			TaskQueue& queue = *m_Queues[chunk % m_Queues.size()];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(Task{ &body, begin, end, &remaining });
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Queued += chunks;
+		}
+		m_WorkAvailable.notify_all();
+
+		// help until no task is left to take, then wait for the chunks still running on workers
+		Task task;
+		while (takeTask(0, task))
+			run(task, 0);
+		while (remaining.load(std::memory_order_acquire) > 0)
+			std::this_thread::yield();
+	}
+
+private:
+	struct Task
+	{
+		const RangeJob* body;
+		int begin, end;
+		std::atomic<int>* remaining; // chunks of the ParallelFor() not finished yet
+	};
+
+	struct TaskQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	// own newest task first, then the oldest task of the other threads
+	bool takeTask(int thread, Task& task)
+	{
+		{
+			TaskQueue& own = *m_Queues[thread];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if (!own.tasks.empty())
+			{
+				task = own.tasks.back();
+				own.tasks.pop_back();
+				taken();
+				return true;
+			}
+		}
+		int threads = (int)m_Queues.size();
+		for (int i = 1; i < threads; i++)
+		{
+			TaskQueue& victim = *m_Queues[(thread + i) % threads];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (!victim.tasks.empty())
+			{
+				task = victim.tasks.front();
+				victim.tasks.pop_front();
+				taken();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void taken()
+	{
+		m_Queued.fetch_sub(1, std::memory_order_relaxed); // only increments have to wake anybody
+	}
+
+	static void run(const Task& task, int thread)
+	{
+		(*task.body)(task.begin, task.end, thread);
+		task.remaining->fetch_sub(1, std::memory_order_release);
+	}
+
+	void workerLoop(int thread)
+	{
+		for (;;)
+		{
+			Task task;
+			if (takeTask(thread, task))
+			{
+				run(task, thread);
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_WorkAvailable.wait(lock, [this] { return m_Quit || m_Queued > 0; });
+			if (m_Quit)
+				return;
+		}
+	}
+
+private:
+	std::vector<std::unique_ptr<TaskQueue>> m_Queues;  // one per thread, 0 belongs to the caller of ParallelFor()
+	std::vector<std::thread> m_Workers;
+
+	std::mutex m_SleepMutex;                // held while m_Queued grows and m_Quit is set, so sleeping workers can't miss it
+	std::condition_variable m_WorkAvailable;
+	std::atomic<int> m_Queued{ 0 };         // tasks pushed and not taken yet
+	bool m_Quit = false;
+};
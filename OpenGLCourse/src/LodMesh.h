@@ -0,0 +1,123 @@
+#pragma once
+#include <glad/glad.h>
+#include <cmath>
+#include <vector>
+#include "GLStateCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "RenderQueue.h"
+#include "VertexFormat.h"
+
+// one level of detail: a range of the shared element buffer
+struct MeshLod
+{
+	int firstIndex = 0;
+	int indexCount = 0;
+	float error = 0.0f;     // largest simplification error against LOD 0, in mesh units
+};
+
+// A mesh with a chain of simplified index buffers over one vertex buffer: LOD 0 is the mesh as given, every
+// further LOD keeps about reduction of the previous one's triangles (MeshSimplifier, always simplified from LOD 0
+// so the errors are against the full mesh). All LODs go into one element buffer, so one vertex array serves them
+// and a LOD is only a different firstIndex/indexCount of the draw. SelectLod() picks the coarsest LOD whose error,
+// projected to the screen, stays under a pixel threshold.
+class LodMesh
+{
+public:
+	static const int MAX_LODS = 8;
+
+	// vertices: vertexCount vertices in format, positions first as 3 floats; needs a current GL context
+	LodMesh(const std::vector<unsigned int>& indices, const void* vertices, size_t vertexCount, const VertexFormat& format,
+		float reduction = 0.5f, int minTriangles = 64)
+	{
+		// vertex cache, overdraw and vertex fetch order come from LOD 0, the coarser LODs reuse its vertices
+		std::vector<unsigned char> vertexData((const unsigned char*)vertices, (const unsigned char*)vertices + vertexCount * format.GetStride());
+		std::vector<unsigned int> fullIndices = indices;
+		m_VertexCount = MeshOptimizer::Optimize(fullIndices, vertexData.data(), vertexCount, format.GetStride());
+
+		std::vector<unsigned int> allIndices, lodIndices = fullIndices;
+		float lodError = 0.0f;
+		for (;;)
+		{
+			MeshLod lod;
+			lod.firstIndex = (int)allIndices.size();
+			lod.indexCount = (int)lodIndices.size();
+			lod.error = lodError;
+			allIndices.insert(allIndices.end(), lodIndices.begin(), lodIndices.end());
+			m_Lods.push_back(lod);
+
+			// the next one, unless it would be too small or the locked vertices keep the simplifier from getting there
+			size_t target = (size_t)(lodIndices.size() * reduction) / 3 * 3;
+			if ((int)m_Lods.size() == MAX_LODS || (int)target / 3 < minTriangles)
+				break;
+			std::vector<unsigned int> simplified = MeshSimplifier::Simplify(fullIndices, vertexData.data(), format.GetStride(), m_VertexCount, target, 1e30f, &lodError);
+			if (simplified.size() > lodIndices.size() * 9 / 10)
+				break;
+			lodIndices = MeshOptimizer::OptimizeVertexCache(simplified, m_VertexCount);
+		}
+
+		std::vector<unsigned char> indexData;
+		m_IndexType = MeshOptimizer::PackIndices(allIndices, m_VertexCount, indexData);
+		glGenVertexArrays(1, &m_VAO);
+		glGenBuffers(1, &m_VBO);
+		glGenBuffers(1, &m_EBO);
+		GLStateCache& state = GLStateCache::Get();
+		state.BindVertexArray(m_VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+		glBufferData(GL_ARRAY_BUFFER, m_VertexCount * format.GetStride(), vertexData.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+		format.Apply();
+		state.BindVertexArray(0);
+	}
+
+	~LodMesh()
+	{
+		glDeleteVertexArrays(1, &m_VAO);
+		GLStateCache::Get().ForgetVertexArray(m_VAO);
+		glDeleteBuffers(1, &m_VBO);
+		glDeleteBuffers(1, &m_EBO);
+	}
+
+	LodMesh(const LodMesh&) = delete;
+	LodMesh& operator=(const LodMesh&) = delete;
+
+	// pixels one mesh unit covers at distance 1 for a perspective projection (vertical field of view in radians)
+	static float PixelsPerUnit(float viewportHeight, float verticalFov)
+	{
+		return viewportHeight / (2.0f * std::tan(verticalFov * 0.5f));
+	}
+
+	// coarsest LOD whose error, scaled with the mesh and seen from distance, is at most pixelThreshold pixels
+	// ------------------------------------------------------------------------
+	int SelectLod(float distance, float pixelsPerUnit, float scale = 1.0f, float pixelThreshold = 1.0f) const
+	{
+		if (distance <= 0.0f)
+			return 0;
+		for (int lod = (int)m_Lods.size() - 1; lod > 0; lod--)
+			if (m_Lods[lod].error * scale * pixelsPerUnit / distance <= pixelThreshold)
+				return lod;
+		return 0;
+	}
+
+	// point a draw at one LOD (shader, textures and uniforms are up to the caller)
+	void SetCommand(RenderCommand& command, int lod) const
+	{
+		command.vertexArray = m_VAO;
+		command.firstIndex = m_Lods[lod].firstIndex;
+		command.indexCount = m_Lods[lod].indexCount;
+		command.indexType = m_IndexType;
+	}
+
+	int GetLodCount() const { return (int)m_Lods.size(); }
+	const MeshLod& GetLod(int lod) const { return m_Lods[lod]; }
+	unsigned int GetVertexArray() const { return m_VAO; }
+	GLenum GetIndexType() const { return m_IndexType; }
+	size_t GetVertexCount() const { return m_VertexCount; }
+
+private:
+	unsigned int m_VAO = 0, m_VBO = 0, m_EBO = 0;
+	GLenum m_IndexType = GL_UNSIGNED_INT;
+	size_t m_VertexCount = 0;       // after unreferenced vertices were dropped
+	std::vector<MeshLod> m_Lods;
+};
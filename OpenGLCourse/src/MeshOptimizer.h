@@ -0,0 +1,343 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// post-transform vertex cache behaviour of an index buffer, from MeshOptimizer::AnalyzeVertexCache()
+struct VertexCacheStats
+{
+	int triangles = 0;
+	int vertices = 0;       // distinct vertices referenced
+	int misses = 0;         // vertex shader invocations of the simulated FIFO cache
+	float acmr = 0.0f;      // average cache miss ratio: misses per triangle, 0.5 ideal for large grids, 3 worst
+	float atvr = 0.0f;      // average transformed vertex ratio: misses per vertex, 1 ideal
+};
+
+// CPU mesh optimizer, run on the index (and vertex) data before it goes to glBufferData. In pipeline order:
+//   OptimizeVertexCache  Tipsify (Sander et al. 2007): triangles reordered to fan around vertices still in the
+//                        post-transform cache, fewer vertex shader invocations
+//   OptimizeOverdraw     the cache ordered triangles cut into clusters at cache flushes and where the cluster
+//                        reached its ACMR (times threshold), clusters facing away from the mesh centre drawn first
+//                        so they occlude the rest; costs at most threshold in ACMR
+//   OptimizeVertexFetch  vertices renumbered and stored in the order the indices first use them, so vertex fetch
+//                        streams through memory; unreferenced vertices are dropped
+//   PackIndices          16-bit indices when every vertex fits
+// The overdraw pass reads positions as the first three floats of each vertex. AnalyzeVertexCache() simulates a
+// FIFO cache so the passes can be measured without a GPU.
+class MeshOptimizer
+{
+public:
+	static const int DEFAULT_CACHE_SIZE = 16;
+	static constexpr float DEFAULT_OVERDRAW_THRESHOLD = 1.05f;
+
+	// the whole pipeline on a float vertex array (positions first); returns the new vertex count, 0 on bad indices
+	// ------------------------------------------------------------------------
+	static size_t Optimize(std::vector<unsigned int>& indices, void* vertices, size_t vertexCount, size_t vertexSize,
+		float overdrawThreshold = DEFAULT_OVERDRAW_THRESHOLD, int cacheSize = DEFAULT_CACHE_SIZE)
+	{
+		if (!validate(indices, vertexCount))
+			return 0;
+		indices = OptimizeVertexCache(indices, vertexCount, cacheSize);
+		OptimizeOverdraw(indices, vertices, vertexSize, vertexCount, overdrawThreshold, cacheSize);
+		return OptimizeVertexFetch(indices, vertices, vertexCount, vertexSize);
+	}
+
+	// FIFO cache simulation of the triangle list
+	// ------------------------------------------------------------------------
+	static VertexCacheStats AnalyzeVertexCache(const std::vector<unsigned int>& indices, size_t vertexCount, int cacheSize = DEFAULT_CACHE_SIZE)
+	{
+		VertexCacheStats stats;
+		if (!validate(indices, vertexCount))
+			return stats;
+		std::vector<unsigned int> timestamps(vertexCount, 0);
+		std::vector<char> used(vertexCount, 0);
+		unsigned int time = cacheSize + 1;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			stats.misses += updateCache(&indices[i], cacheSize, timestamps, time);
+			for (int corner = 0; corner < 3; corner++)
+			{
+				stats.vertices += used[indices[i + corner]] ? 0 : 1;
+				used[indices[i + corner]] = 1;
+			}
+		}
+		stats.triangles = (int)(indices.size() / 3);
+		stats.acmr = stats.triangles ? (float)stats.misses / stats.triangles : 0.0f;
+		stats.atvr = stats.vertices ? (float)stats.misses / stats.vertices : 0.0f;
+		return stats;
+	}
+
+	// Tipsify: emit every triangle around a fanning vertex, then continue with the emitted vertex that will still
+	// be cached after its remaining triangles are emitted (the most recent one), or a dead end when none is
+	// ------------------------------------------------------------------------
+	static std::vector<unsigned int> OptimizeVertexCache(const std::vector<unsigned int>& indices, size_t vertexCount, int cacheSize = DEFAULT_CACHE_SIZE)
+	{
+		if (!validate(indices, vertexCount))
+			return indices;
+		size_t triangleCount = indices.size() / 3;
+
+		// triangles of each vertex, and how many of them are still to be emitted
+		std::vector<unsigned int> live(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			live[indices[i]]++;
+		std::vector<unsigned int> adjacencyOffsets(vertexCount + 1, 0);
+		for (size_t v = 0; v < vertexCount; v++)
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + live[v];
+		std::vector<unsigned int> adjacency(triangleCount * 3);
+		std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			adjacency[fill[indices[i]]++] = (unsigned int)(i / 3);
+
+		std::vector<unsigned int> timestamps(vertexCount, 0);
+		std::vector<char> emitted(triangleCount, 0);
+		std::vector<unsigned int> deadEnds, candidates, output;
+		output.reserve(triangleCount * 3);
+		unsigned int time = cacheSize + 1;
+		size_t cursor = 0;
+
+		long fan = nextDeadEnd(live, deadEnds, cursor);
+		while (fan >= 0)
+		{
+			candidates.clear();
+			for (unsigned int a = adjacencyOffsets[fan]; a < adjacencyOffsets[fan + 1]; a++)
+			{
+				unsigned int triangle = adjacency[a];
+				if (emitted[triangle])
+					continue;
+				for (int corner = 0; corner < 3; corner++)
+				{
+					unsigned int v = indices[triangle * 3 + corner];
+					output.push_back(v);
+					deadEnds.push_back(v);
+					candidates.push_back(v);
+					live[v]--;
+					if (time - timestamps[v] > (unsigned int)cacheSize)
+						timestamps[v] = time++;
+				}
+				emitted[triangle] = 1;
+			}
+
+			// the candidate that stays in the cache (2 entries per live triangle) for the longest
+			long next = -1;
+			int bestPriority = -1;
+			for (unsigned int v : candidates)
+			{
+				if (live[v] == 0)
+					continue;
+				int priority = 0;
+				if (time - timestamps[v] + 2 * live[v] <= (unsigned int)cacheSize)
+					priority = (int)(time - timestamps[v]);
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					next = v;
+				}
+			}
+			fan = next >= 0 ? next : nextDeadEnd(live, deadEnds, cursor);
+		}
+		// a trailing partial triangle is kept as it was
+		output.insert(output.end(), indices.begin() + triangleCount * 3, indices.end());
+		return output;
+	}
+
+	// reorder the clusters of cache optimized indices so the outward facing ones are drawn first
+	// ------------------------------------------------------------------------
+	static void OptimizeOverdraw(std::vector<unsigned int>& indices, const void* vertices, size_t vertexSize, size_t vertexCount,
+		float threshold = DEFAULT_OVERDRAW_THRESHOLD, int cacheSize = DEFAULT_CACHE_SIZE)
+	{
+		if (!validate(indices, vertexCount) || indices.size() < 6)
+			return;
+		size_t triangleCount = indices.size() / 3;
+		std::vector<unsigned int> timestamps(vertexCount, 0);
+		unsigned int time = cacheSize + 1;
+
+		// hard boundaries: all three vertices missed, the tipsify order jumped to a new patch
+		std::vector<size_t> patches;
+		for (size_t t = 0; t < triangleCount; t++)
+			if (updateCache(&indices[t * 3], cacheSize, timestamps, time) == 3 || t == 0)
+				patches.push_back(t);
+		patches.push_back(triangleCount);
+
+		// soft boundaries: inside a patch, start a new cluster (with a flushed cache) once the running ACMR is down
+		// to threshold times the patch's, the extra misses of every restart stay below that factor
+		std::vector<size_t> clusters;
+		for (size_t p = 0; p + 1 < patches.size(); p++)
+		{
+			size_t begin = patches[p], end = patches[p + 1];
+			time += cacheSize + 1;  // flush
+			int patchMisses = 0;
+			for (size_t t = begin; t < end; t++)
+				patchMisses += updateCache(&indices[t * 3], cacheSize, timestamps, time);
+			float target = threshold * patchMisses / (float)(end - begin);
+
+			clusters.push_back(begin);
+			time += cacheSize + 1;
+			int misses = 0;
+			size_t count = 0;
+			for (size_t t = begin; t < end; t++)
+			{
+				misses += updateCache(&indices[t * 3], cacheSize, timestamps, time);
+				count++;
+				if (misses <= target * count && t + 1 < end)
+				{
+					clusters.push_back(t + 1);
+					time += cacheSize + 1;
+					misses = 0;
+					count = 0;
+				}
+			}
+			// the last cluster rarely reaches the target, it goes with the previous one
+			if (count > 0 && misses > target * count && clusters.back() != begin)
+				clusters.pop_back();
+		}
+		clusters.push_back(triangleCount);
+
+		// sort key: area weighted cluster centroid relative to the mesh centroid, along the cluster's normal
+		const unsigned char* base = (const unsigned char*)vertices;
+		auto position = [&](unsigned int v, int axis) {
+			float value;
+			std::memcpy(&value, base + v * vertexSize + axis * sizeof(float), sizeof(float));
+			return value;
+		};
+		float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+		for (size_t v = 0; v < vertexCount; v++)
+			for (int axis = 0; axis < 3; axis++)
+				meshCentroid[axis] += position((unsigned int)v, axis) / vertexCount;
+
+		size_t clusterCount = clusters.size() - 1;
+		std::vector<float> keys(clusterCount);
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			float centroid[3] = { 0.0f, 0.0f, 0.0f }, normal[3] = { 0.0f, 0.0f, 0.0f }, area = 0.0f;
+			for (size_t t = clusters[c]; t < clusters[c + 1]; t++)
+			{
+				float p[3][3];
+				for (int corner = 0; corner < 3; corner++)
+					for (int axis = 0; axis < 3; axis++)
+						p[corner][axis] = position(indices[t * 3 + corner], axis);
+				float e1[3] = { p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2] };
+				float e2[3] = { p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2] };
+				float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+				float triangleArea = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+				for (int axis = 0; axis < 3; axis++)
+				{
+					centroid[axis] += (p[0][axis] + p[1][axis] + p[2][axis]) / 3.0f * triangleArea;
+					normal[axis] += n[axis];
+				}
+				area += triangleArea;
+			}
+			float normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+			float key = 0.0f;
+			for (int axis = 0; axis < 3 && area > 0.0f && normalLength > 0.0f; axis++)
+				key += (centroid[axis] / area - meshCentroid[axis]) * normal[axis] / normalLength;
+			keys[c] = key;
+		}
+
+		std::vector<size_t> order(clusterCount);
+		for (size_t c = 0; c < clusterCount; c++)
+			order[c] = c;
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return keys[a] > keys[b]; });
+
+		std::vector<unsigned int> sorted;
+		sorted.reserve(indices.size());
+		for (size_t c : order)
+			sorted.insert(sorted.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+		sorted.insert(sorted.end(), indices.begin() + triangleCount * 3, indices.end());
+		indices.swap(sorted);
+	}
+
+	// renumber the vertices in order of first use and move their data to match; returns the new vertex count
+	// ------------------------------------------------------------------------
+	static size_t OptimizeVertexFetch(std::vector<unsigned int>& indices, void* vertices, size_t vertexCount, size_t vertexSize)
+	{
+		if (!validate(indices, vertexCount))
+			return 0;
+		std::vector<unsigned int> remap(vertexCount, UNUSED);
+		std::vector<unsigned char> reordered(vertexCount * vertexSize);
+		unsigned int next = 0;
+		for (unsigned int& index : indices)
+		{
+			if (remap[index] == UNUSED)
+			{
+				std::memcpy(&reordered[next * vertexSize], (const unsigned char*)vertices + index * vertexSize, vertexSize);
+				remap[index] = next++;
+			}
+			index = remap[index];
+		}
+		std::memcpy(vertices, reordered.data(), next * vertexSize);
+		return next;
+	}
+
+	// the indices in the smallest type that holds them, ready for glBufferData; returns the type for glDrawElements
+	// ------------------------------------------------------------------------
+	static GLenum PackIndices(const std::vector<unsigned int>& indices, size_t vertexCount, std::vector<unsigned char>& data)
+	{
+		if (vertexCount <= 65536)
+		{
+			data.resize(indices.size() * sizeof(uint16_t));
+			for (size_t i = 0; i < indices.size(); i++)
+			{
+				uint16_t index = (uint16_t)indices[i];
+				std::memcpy(&data[i * sizeof(uint16_t)], &index, sizeof(uint16_t));
+			}
+			return GL_UNSIGNED_SHORT;
+		}
+		data.resize(indices.size() * sizeof(unsigned int));
+		std::memcpy(data.data(), indices.data(), data.size());
+		return GL_UNSIGNED_INT;
+	}
+
+	static size_t IndexSize(GLenum type) { return type == GL_UNSIGNED_SHORT ? 2 : (type == GL_UNSIGNED_BYTE ? 1 : 4); }
+
+private:
+	static constexpr unsigned int UNUSED = 0xFFFFFFFF;
+
+	// FIFO cache with timestamps: a vertex is cached while fewer than cacheSize misses happened since its own
+	static int updateCache(const unsigned int* triangle, int cacheSize, std::vector<unsigned int>& timestamps, unsigned int& time)
+	{
+		int misses = 0;
+		for (int corner = 0; corner < 3; corner++)
+		{
+			unsigned int v = triangle[corner];
+			if (time - timestamps[v] > (unsigned int)cacheSize)
+			{
+				timestamps[v] = time++;
+				misses++;
+			}
+		}
+		return misses;
+	}
+
+	// most recent emitted vertex with triangles left, else the next such vertex in index order, -1 when done
+	static long nextDeadEnd(const std::vector<unsigned int>& live, std::vector<unsigned int>& deadEnds, size_t& cursor)
+	{
+		while (!deadEnds.empty())
+		{
+			unsigned int v = deadEnds.back();
+			deadEnds.pop_back();
+			if (live[v] > 0)
+				return v;
+		}
+		for (; cursor < live.size(); cursor++)
+			if (live[cursor] > 0)
+				return (long)cursor;
+		return -1;
+	}
+
+	static bool validate(const std::vector<unsigned int>& indices, size_t vertexCount)
+	{
+		for (unsigned int index : indices)
+		{
+			if (index >= vertexCount)
+			{
+				std::cout << "ERROR::MESH_OPTIMIZER::INDEX_OUT_OF_RANGE: " << index << " of " << vertexCount << " vertices" << std::endl;
+				return false;
+			}
+		}
+		return true;
+	}
+};
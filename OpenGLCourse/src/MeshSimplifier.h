@@ -0,0 +1,245 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+// Quadric error metric simplification (Garland and Heckbert 1997) by half edge collapses: a vertex is merged into a
+// neighbour that already exists, so the result indexes the same vertex buffer as the input and every LOD of a mesh
+// can share it. Each vertex carries the area weighted quadric of the planes around it, a collapse costs the
+// quadric error of the kept vertex, and the collapses go cheapest first in passes until the triangle target or
+// the error limit is reached. Seam vertices (several vertices at one position, e.g. texture seams and poles)
+// and open border vertices are never removed, so attribute seams and holes keep their shape; collapses that
+// would flip a triangle are skipped. Positions are the first three floats of each vertex.
+class MeshSimplifier
+{
+public:
+	// indices of a simplified mesh with at most targetIndexCount indices (more when the error limit or the locked
+	// vertices stop it first); error gets the largest collapse error made, a distance in mesh units
+	// ------------------------------------------------------------------------
+	static std::vector<unsigned int> Simplify(const std::vector<unsigned int>& indices, const void* vertices, size_t vertexSize, size_t vertexCount,
+		size_t targetIndexCount, float maxError = 1e30f, float* error = NULL)
+	{
+		if (error)
+			*error = 0.0f;
+		std::vector<unsigned int> result(indices.begin(), indices.begin() + indices.size() / 3 * 3);
+		for (unsigned int index : result)
+		{
+			if (index >= vertexCount)
+			{
+				std::cout << "ERROR::MESH_SIMPLIFIER::INDEX_OUT_OF_RANGE: " << index << " of " << vertexCount << " vertices" << std::endl;
+				return result;
+			}
+		}
+
+		std::vector<Vector3> positions(vertexCount);
+		for (size_t v = 0; v < vertexCount; v++)
+			std::memcpy(&positions[v], (const unsigned char*)vertices + v * vertexSize, sizeof(Vector3));
+		std::vector<char> locked = lockedVertices(result, positions);
+
+		std::vector<Quadric> quadrics(vertexCount);
+		for (size_t i = 0; i < result.size(); i += 3)
+		{
+			Quadric plane = Quadric::FromTriangle(positions[result[i]], positions[result[i + 1]], positions[result[i + 2]]);
+			for (int corner = 0; corner < 3; corner++)
+				quadrics[result[i + corner]].Add(plane);
+		}
+
+		double maxCost = (double)maxError * maxError, worstCost = 0.0;
+		std::vector<unsigned int> adjacencyOffsets, adjacency;
+		std::vector<Collapse> collapses;
+		std::vector<char> touched(vertexCount);
+		while (result.size() > targetIndexCount)
+		{
+			buildAdjacency(result, vertexCount, adjacencyOffsets, adjacency);
+
+			// cheapest collapse of every removable vertex
+			collapses.clear();
+			for (unsigned int u = 0; u < vertexCount; u++)
+			{
+				if (locked[u] || adjacencyOffsets[u] == adjacencyOffsets[u + 1])
+					continue;
+				Collapse best = { u, u, 0.0 };
+				for (unsigned int a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1]; a++)
+				{
+					for (int corner = 0; corner < 3; corner++)
+					{
+						unsigned int v = result[adjacency[a] * 3 + corner];
+						if (v == u)
+							continue;
+						Quadric merged = quadrics[u];
+						merged.Add(quadrics[v]);
+						double cost = merged.Error(positions[v]);
+						if (best.from == best.to || cost < best.cost)
+							best = { u, v, cost };
+					}
+				}
+				if (best.from != best.to && best.cost <= maxCost)
+					collapses.push_back(best);
+			}
+			if (collapses.empty())
+				break;
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+			// apply them cheapest first; a vertex takes part in one collapse per pass so the adjacency stays valid
+			std::fill(touched.begin(), touched.end(), 0);
+			size_t triangles = result.size() / 3, target = targetIndexCount / 3;
+			int applied = 0;
+			for (const Collapse& collapse : collapses)
+			{
+				if (triangles <= target)
+					break;
+				if (touched[collapse.from] || touched[collapse.to] || flips(collapse, result, positions, adjacencyOffsets, adjacency))
+					continue;
+				for (unsigned int a = adjacencyOffsets[collapse.from]; a < adjacencyOffsets[collapse.from + 1]; a++)
+				{
+					unsigned int* triangle = &result[adjacency[a] * 3];
+					bool degenerate = triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to;
+					for (int corner = 0; corner < 3; corner++)
+						if (triangle[corner] == collapse.from)
+							triangle[corner] = collapse.to;
+					triangles -= degenerate ? 1 : 0;
+				}
+				quadrics[collapse.to].Add(quadrics[collapse.from]);
+				touched[collapse.from] = touched[collapse.to] = 1;
+				worstCost = std::max(worstCost, collapse.cost);
+				applied++;
+			}
+
+			// drop the triangles the collapses made degenerate
+			size_t kept = 0;
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				if (result[i] == result[i + 1] || result[i + 1] == result[i + 2] || result[i] == result[i + 2])
+					continue;
+				result[kept++] = result[i];
+				result[kept++] = result[i + 1];
+				result[kept++] = result[i + 2];
+			}
+			result.resize(kept);
+			if (applied == 0)
+				break;
+		}
+		if (error)
+			*error = (float)std::sqrt(worstCost);
+		return result;
+	}
+
+private:
+	struct Vector3 { float x, y, z; };
+
+	struct Collapse
+	{
+		unsigned int from, to;
+		double cost;
+	};
+
+	// symmetric 4x4 plane quadric, divided by its weight (the planes' area) when evaluated so the error is a
+	// squared distance whatever the triangle sizes
+	struct Quadric
+	{
+		double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0, weight = 0;
+
+		static Quadric FromTriangle(const Vector3& p0, const Vector3& p1, const Vector3& p2)
+		{
+			double e1[3] = { p1.x - p0.x, p1.y - p0.y, p1.z - p0.z }, e2[3] = { p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+			double n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			Quadric q;
+			if (length == 0.0)
+				return q;
+			double a = n[0] / length, b = n[1] / length, c = n[2] / length, d = -(a * p0.x + b * p0.y + c * p0.z);
+			double area = length * 0.5;
+			q.a2 = a * a * area; q.ab = a * b * area; q.ac = a * c * area; q.ad = a * d * area;
+			q.b2 = b * b * area; q.bc = b * c * area; q.bd = b * d * area;
+			q.c2 = c * c * area; q.cd = c * d * area; q.d2 = d * d * area;
+			q.weight = area;
+			return q;
+		}
+
+		void Add(const Quadric& q)
+		{
+			a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad; b2 += q.b2; bc += q.bc; bd += q.bd;
+			c2 += q.c2; cd += q.cd; d2 += q.d2; weight += q.weight;
+		}
+
+		double Error(const Vector3& p) const
+		{
+			double x = p.x, y = p.y, z = p.z;
+			double error = a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z) + d2;
+			return weight > 0.0 ? std::fabs(error) / weight : 0.0;
+		}
+	};
+
+	// vertices sharing their position with another one, and vertices on edges used by a single triangle
+	static std::vector<char> lockedVertices(const std::vector<unsigned int>& indices, const std::vector<Vector3>& positions)
+	{
+		std::vector<char> locked(positions.size(), 0);
+		std::vector<unsigned int> order(positions.size());
+		for (unsigned int v = 0; v < positions.size(); v++)
+			order[v] = v;
+		auto less = [&](unsigned int a, unsigned int b) { return std::memcmp(&positions[a], &positions[b], sizeof(Vector3)) < 0; };
+		std::sort(order.begin(), order.end(), less);
+		for (size_t i = 1; i < order.size(); i++)
+			if (!less(order[i - 1], order[i]))
+				locked[order[i - 1]] = locked[order[i]] = 1;
+
+		// an edge is a border when its opposite half edge does not exist
+		std::unordered_map<uint64_t, int> halfEdges;
+		for (size_t i = 0; i < indices.size(); i += 3)
+			for (int corner = 0; corner < 3; corner++)
+				halfEdges[(uint64_t)indices[i + corner] << 32 | indices[i + (corner + 1) % 3]]++;
+		for (const auto& edge : halfEdges)
+		{
+			unsigned int from = (unsigned int)(edge.first >> 32), to = (unsigned int)edge.first;
+			if (halfEdges.find((uint64_t)to << 32 | from) == halfEdges.end())
+				locked[from] = locked[to] = 1;
+		}
+		return locked;
+	}
+
+	static void buildAdjacency(const std::vector<unsigned int>& indices, size_t vertexCount, std::vector<unsigned int>& offsets, std::vector<unsigned int>& adjacency)
+	{
+		offsets.assign(vertexCount + 1, 0);
+		for (unsigned int index : indices)
+			offsets[index + 1]++;
+		for (size_t v = 0; v < vertexCount; v++)
+			offsets[v + 1] += offsets[v];
+		adjacency.resize(indices.size());
+		std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); i++)
+			adjacency[fill[indices[i]]++] = (unsigned int)(i / 3);
+	}
+
+	// would moving collapse.from onto collapse.to turn a surviving triangle around (or make it degenerate)?
+	static bool flips(const Collapse& collapse, const std::vector<unsigned int>& indices, const std::vector<Vector3>& positions,
+		const std::vector<unsigned int>& offsets, const std::vector<unsigned int>& adjacency)
+	{
+		for (unsigned int a = offsets[collapse.from]; a < offsets[collapse.from + 1]; a++)
+		{
+			const unsigned int* triangle = &indices[adjacency[a] * 3];
+			if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+				continue;  // removed by the collapse
+			Vector3 before[3], after[3];
+			for (int corner = 0; corner < 3; corner++)
+			{
+				before[corner] = positions[triangle[corner]];
+				after[corner] = triangle[corner] == collapse.from ? positions[collapse.to] : before[corner];
+			}
+			Vector3 n0 = normal(before), n1 = normal(after);
+			double dot = (double)n0.x * n1.x + (double)n0.y * n1.y + (double)n0.z * n1.z;
+			if (dot <= 0.0)
+				return true;
+		}
+		return false;
+	}
+
+	static Vector3 normal(const Vector3* p)
+	{
+		Vector3 e1 = { p[1].x - p[0].x, p[1].y - p[0].y, p[1].z - p[0].z }, e2 = { p[2].x - p[0].x, p[2].y - p[0].y, p[2].z - p[0].z };
+		return { e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x };
+	}
+};
@@ -0,0 +1,186 @@
+#pragma once
+#include <glad/glad.h>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Util.h"
+
+struct ProgramCacheStats
+{
+	int hits = 0;          // programs created from a cached binary
+	int misses = 0;        // no usable cache file, compiled from source
+	int rejected = 0;      // cache file found but the driver refused the binary (counted as a miss too)
+	double loadMs = 0.0;     // time to read and load the hit binaries
+	double compileMs = 0.0;  // compile + link time recorded when those binaries were built
+};
+
+// On-disk cache of linked program binaries (glGetProgramBinary/glProgramBinary). An entry is keyed by a hash
+// of the shader sources, the preprocessor defines and the GL_RENDERER/GL_VERSION strings, so a driver update
+// or a different GPU simply misses. Needs GL 4.1 or ARB_get_program_binary; otherwise every lookup misses.
+class ProgramCache
+{
+public:
+	// must be created with a current GL context
+	explicit ProgramCache(const std::string& directory) : m_Directory(directory)
+	{
+		GLint formats = 0;
+		if (glGetProgramBinary && glProgramBinary && glProgramParameteri)
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		m_Supported = formats > 0;
+
+		const char* renderer = (const char*)glGetString(GL_RENDERER);
+		const char* version = (const char*)glGetString(GL_VERSION);
+		m_DriverKey = std::string(renderer ? renderer : "") + '\n' + (version ? version : "");
+
+		std::error_code error;
+		if (m_Supported && !std::filesystem::create_directories(m_Directory, error) && error)
+			std::cout << "ERROR::PROGRAM_CACHE::FAILED_TO_CREATE_DIRECTORY: " << m_Directory << std::endl;
+	}
+
+	bool IsSupported() const { return m_Supported; }
+
+	// 64-bit FNV-1a over the sources, the defines and the driver strings
+	// ------------------------------------------------------------------------
+	uint64_t Key(const std::vector<std::string>& sources, const std::string& defines) const
+	{
+		Fnv1a64 hash;
+		for (const std::string& source : sources)
+			hash.Add(source);
+		return hash.Add(defines).Add(m_DriverKey).Get();
+	}
+
+	// create a program from the cached binary, returns 0 on a miss (missing, corrupt or rejected by the driver)
+	// ------------------------------------------------------------------------
+	unsigned int Load(uint64_t key)
+	{
+		if (!m_Supported)
+		{
+			m_Stats.misses++;
+			return 0;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		std::ifstream file(path(key), std::ios::binary);
+		Header header;
+		std::vector<char> binary;
+		std::error_code error;
+		uintmax_t fileSize = std::filesystem::file_size(path(key), error);
+		if (!error && file && file.read((char*)&header, sizeof(header)) && header.magic == MAGIC && header.key == key &&
+			header.length > 0 && header.length == fileSize - sizeof(header))
+		{
+			binary.resize(header.length);
+			if (!file.read(binary.data(), binary.size()))
+				binary.clear();
+		}
+		if (binary.empty())
+		{
+			m_Stats.misses++;
+			return 0;
+		}
+
+		unsigned int programID = glCreateProgram();
+		glProgramBinary(programID, header.format, binary.data(), (GLsizei)binary.size());
+		GLint success = 0;
+		glGetProgramiv(programID, GL_LINK_STATUS, &success);
+		if (!success)
+		{
+			// typically a driver update that kept the version string, recompile and overwrite the entry
+			glDeleteProgram(programID);
+			m_Stats.rejected++;
+			m_Stats.misses++;
+			return 0;
+		}
+
+		m_Stats.hits++;
+		m_Stats.loadMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		m_Stats.compileMs += header.compileMs;
+		return programID;
+	}
+
+	// call on a new program before glLinkProgram so the driver keeps a retrievable binary
+	void PrepareForLink(unsigned int programID) const
+	{
+		if (m_Supported)
+			glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	// save a successfully linked program; compileMs is what a later hit saves
+	// ------------------------------------------------------------------------
+	void Store(uint64_t key, unsigned int programID, double compileMs) const
+	{
+		if (!m_Supported)
+			return;
+
+		GLint length = 0;
+		glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+		std::vector<char> binary(length);
+		Header header = { MAGIC, 0, key, compileMs, 0, 0 };
+		glGetProgramBinary(programID, length, &length, &header.format, binary.data());
+		header.length = (uint32_t)length;
+
+		// write a temporary file and rename it, a crash mid-write must not leave a truncated entry behind
+		std::string finalPath = path(key), tempPath = finalPath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file || !file.write((const char*)&header, sizeof(header)) || !file.write(binary.data(), length))
+			{
+				std::cout << "ERROR::PROGRAM_CACHE::FAILED_TO_WRITE: " << tempPath << std::endl;
+				return;
+			}
+		}
+		std::error_code error;
+		std::filesystem::rename(tempPath, finalPath, error);
+		if (error)
+			std::cout << "ERROR::PROGRAM_CACHE::FAILED_TO_WRITE: " << finalPath << std::endl;
+	}
+
+	const ProgramCacheStats& GetStats() const { return m_Stats; }
+
+	void PrintStats() const
+	{
+		if (!m_Supported)
+		{
+			std::cout << "Program cache: not supported by this context (no program binary formats)" << std::endl;
+			return;
+		}
+		std::cout << "Program cache: " << m_Stats.hits << " hits, " << m_Stats.misses << " misses (" << m_Stats.rejected
+			<< " rejected binaries), hits loaded in " << m_Stats.loadMs << " ms against " << m_Stats.compileMs << " ms to compile and link them" << std::endl;
+	}
+
+private:
+	static const uint32_t MAGIC = 0x32504C47; // "GLP2"
+
+	// written to disk as is: every member is naturally aligned and the size is a multiple of 8, so there are no
+	// padding bytes with indeterminate values in the files
+	struct Header
+	{
+		uint32_t magic;
+		GLenum format;      // binaryFormat returned by glGetProgramBinary
+		uint64_t key;
+		double compileMs;   // compile + link time of the source build
+		uint32_t length;    // bytes of binary following the header
+		uint32_t reserved;  // 0
+	};
+	static_assert(sizeof(Header) == 32, "ProgramCache::Header must not contain padding");
+
+	std::string path(uint64_t key) const
+	{
+		std::ostringstream name;
+		name << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+		return (std::filesystem::path(m_Directory) / name.str()).string();
+	}
+
+private:
+	std::string m_Directory;
+	std::string m_DriverKey;
+	bool m_Supported = false;
+	ProgramCacheStats m_Stats;
+};
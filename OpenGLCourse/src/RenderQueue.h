@@ -0,0 +1,274 @@
+#pragma once
+#include <glad/glad.h>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "GLStateCache.h"
+#include "Shader.h"
+#include "Util.h"
+
+// order in which Execute() issues the recorded draws
+enum RenderQueueOrder
+{
+	RENDER_QUEUE_SUBMISSION,  // as recorded, for comparison
+	RENDER_QUEUE_SORTED       // by sort key: layer, then program, textures, vertex array and depth
+};
+
+// how draws inside one layer are ordered
+enum RenderLayerOrder
+{
+	LAYER_ORDER_STATE,         // fewest state changes, depth front to back last (opaque geometry)
+	LAYER_ORDER_BACK_TO_FRONT  // depth first, far to near (blended geometry), state only breaks ties
+};
+
+// one indexed draw (GL_TRIANGLES from the vertex array's element buffer)
+struct RenderCommand
+{
+	static const int MAX_TEXTURES = 4;
+
+	const Shader* shader = NULL;               // NULL draws with the program already bound (no per draw uniform then)
+	unsigned int vertexArray = 0;
+	unsigned int textures[MAX_TEXTURES] = {};  // bound to units 0..textureCount-1
+	int textureCount = 0;
+	int indexCount = 0;
+	int firstIndex = 0;
+	GLenum indexType = GL_UNSIGNED_INT;        // or GL_UNSIGNED_SHORT for element buffers of 16-bit indices
+	UniformHandle uniform;                     // optional per draw vec4 uniform (e.g. transform or tint)
+	vector4 uniformValue = { 0.0f, 0.0f, 0.0f, 0.0f };
+};
+
+// counters of the last Execute()
+struct RenderQueueStats
+{
+	int draws = 0;
+	int programChanges = 0;
+	int textureChanges = 0;      // texture units whose binding changed
+	int vertexArrayChanges = 0;
+	double sortMs = 0.0;
+	double executeMs = 0.0;      // CPU time issuing the draws
+};
+
+// Draws recorded by one thread: fill it with keys from RenderQueue::MakeKey (safe to call from any thread) and
+// hand it to RenderQueue::Append() on the GL thread. The commands are read in place by Execute(), so the list
+// must stay unchanged until then.
+class RenderCommandList
+{
+public:
+	void Add(uint64_t key, const RenderCommand& command)
+	{
+		m_Keys.push_back(key);
+		m_Commands.push_back(command);
+	}
+
+	void Clear()
+	{
+		m_Keys.clear();
+		m_Commands.clear();
+	}
+
+	int GetCount() const { return (int)m_Commands.size(); }
+
+private:
+	friend class RenderQueue;
+	std::vector<uint64_t> m_Keys;
+	std::vector<RenderCommand> m_Commands;
+};
+
+// Deferred draw queue: Submit() records a draw as a 64 bit sort key plus the index of its payload, Execute()
+// radix sorts the keys and issues the draws in key order through the GLStateCache, so draws sharing a program,
+// textures and vertex array run back to back and the state in between is only set once.
+// Key layout, most significant first:
+//   layer 4 | program 10 | texture set 14 | vertex array 12 | depth 24   (LAYER_ORDER_STATE)
+//   layer 4 | inverted depth 24 | program 10 | texture set 14 | vertex array 12   (LAYER_ORDER_BACK_TO_FRONT)
+// The state fields hold the low bits of the GL names (small integers in practice) and a hash of the texture
+// names, so keys can be made on any thread without shared tables; two objects sharing a field value only costs
+// sorting quality, never correctness.
+class RenderQueue
+{
+public:
+	static const int MAX_LAYERS = 16;
+	static const int MAX_LISTS = 256;            // command lists per Execute(), including the queue's own
+	static const int MAX_LIST_COMMANDS = 1 << 24;
+
+	RenderQueue()
+	{
+		for (RenderLayerOrder& order : m_LayerOrders)
+			order = LAYER_ORDER_STATE;
+		m_Lists.push_back(&m_Own);
+	}
+
+	RenderQueue(const RenderQueue&) = delete;
+	RenderQueue& operator=(const RenderQueue&) = delete;
+
+	// set before recording, MakeKey() reads it from other threads
+	void SetLayerOrder(int layer, RenderLayerOrder order) { m_LayerOrders[layer & (MAX_LAYERS - 1)] = order; }
+
+	// sort key of a draw; depth in [0, 1], 0 nearest
+	// ------------------------------------------------------------------------
+	uint64_t MakeKey(const RenderCommand& command, int layer = 0, float depth = 0.0f) const
+	{
+		layer &= MAX_LAYERS - 1;
+		uint64_t program = (command.shader ? command.shader->GetID() : 0u) & PROGRAM_MASK;
+		uint64_t textures = textureSetHash(command) & TEXTURE_SET_MASK;
+		uint64_t vertexArray = command.vertexArray & VERTEX_ARRAY_MASK;
+		uint64_t state = program << 26 | textures << 12 | vertexArray; // 36 bits
+		depth = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+		uint64_t depthBits = (uint64_t)(depth * DEPTH_MASK);
+
+		uint64_t key = (uint64_t)layer << 60;
+		if (m_LayerOrders[layer] == LAYER_ORDER_BACK_TO_FRONT)
+			key |= (DEPTH_MASK - depthBits) << 36 | state;
+		else
+			key |= state << 24 | depthBits;
+		return key;
+	}
+
+	// record a draw
+	// ------------------------------------------------------------------------
+	void Submit(const RenderCommand& command, int layer = 0, float depth = 0.0f)
+	{
+		if (m_Own.GetCount() >= MAX_LIST_COMMANDS)
+		{
+			std::cout << "ERROR::RENDER_QUEUE::TOO_MANY_COMMANDS" << std::endl;
+			return;
+		}
+		m_Keys.push_back(MakeKey(command, layer, depth));
+		m_Indices.push_back((uint32_t)m_Own.m_Commands.size());
+		m_Own.m_Commands.push_back(command);
+	}
+
+	// merge the draws of a list recorded on another thread, its commands are read in place by Execute()
+	// ------------------------------------------------------------------------
+	void Append(const RenderCommandList& list)
+	{
+		if (list.m_Commands.empty())
+			return;
+		if (m_Lists.size() >= MAX_LISTS || list.m_Commands.size() > MAX_LIST_COMMANDS)
+		{
+			std::cout << "ERROR::RENDER_QUEUE::TOO_MANY_COMMANDS" << std::endl;
+			return;
+		}
+		uint32_t listBits = (uint32_t)m_Lists.size() << 24;
+		m_Lists.push_back(&list);
+		m_Keys.insert(m_Keys.end(), list.m_Keys.begin(), list.m_Keys.end());
+		size_t first = m_Indices.size();
+		m_Indices.resize(first + list.m_Commands.size());
+		for (size_t i = 0; i < list.m_Commands.size(); i++)
+			m_Indices[first + i] = listBits | (uint32_t)i;
+	}
+
+	int GetCommandCount() const { return (int)m_Keys.size(); }
+
+	// issue every recorded draw and empty the queue
+	// ------------------------------------------------------------------------
+	void Execute(RenderQueueOrder order = RENDER_QUEUE_SORTED)
+	{
+		m_Stats = RenderQueueStats();
+		auto start = std::chrono::steady_clock::now();
+		if (order == RENDER_QUEUE_SORTED)
+			radixSort();
+		auto sorted = std::chrono::steady_clock::now();
+		m_Stats.sortMs = std::chrono::duration<double, std::milli>(sorted - start).count();
+
+		GLStateCache& state = GLStateCache::Get();
+		const RenderCommand* previous = NULL;
+		for (uint32_t index : m_Indices)
+		{
+			const RenderCommand& command = m_Lists[index >> 24]->m_Commands[index & (MAX_LIST_COMMANDS - 1)];
+			if (command.shader && (!previous || previous->shader != command.shader))
+			{
+				command.shader->Bind();
+				m_Stats.programChanges++;
+			}
+			for (int unit = 0; unit < command.textureCount; unit++)
+			{
+				if (!previous || unit >= previous->textureCount || previous->textures[unit] != command.textures[unit])
+				{
+					state.BindTexture(unit, command.textures[unit]);
+					m_Stats.textureChanges++;
+				}
+			}
+			if (!previous || previous->vertexArray != command.vertexArray)
+			{
+				state.BindVertexArray(command.vertexArray);
+				m_Stats.vertexArrayChanges++;
+			}
+			if (command.shader && command.uniform.IsValid())
+				command.shader->Set(command.uniform, command.uniformValue);
+			size_t indexSize = command.indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+			glDrawElements(GL_TRIANGLES, command.indexCount, command.indexType, (void*)(command.firstIndex * indexSize));
+			previous = &command;
+		}
+		m_Stats.draws = (int)m_Indices.size();
+		m_Stats.executeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sorted).count();
+
+		m_Keys.clear();
+		m_Indices.clear();
+		m_Own.Clear();
+		m_Lists.resize(1);
+	}
+
+	const RenderQueueStats& GetStats() const { return m_Stats; }
+
+private:
+	static const uint64_t PROGRAM_MASK = (1u << 10) - 1;
+	static const uint64_t TEXTURE_SET_MASK = (1u << 14) - 1;
+	static const uint64_t VERTEX_ARRAY_MASK = (1u << 12) - 1;
+	static const uint64_t DEPTH_MASK = (1u << 24) - 1;
+
+	// FNV-1a over the bytes of the names, folded to the field width; a collision only interleaves two sets in the sort order
+	static uint64_t textureSetHash(const RenderCommand& command)
+	{
+		uint64_t hash = Fnv1a64().Add(command.textures, command.textureCount * sizeof(command.textures[0])).Get();
+		return hash ^ hash >> 14 ^ hash >> 28 ^ hash >> 42;
+	}
+
+	// stable LSD radix sort of the keys (8 bit digits) carrying the payload indices along;
+	// digits that are equal in every key are skipped, so unused key bits cost nothing
+	void radixSort()
+	{
+		size_t count = m_Keys.size();
+		if (count < 2)
+			return;
+		uint32_t histograms[8][256] = {};
+		for (uint64_t key : m_Keys)
+			for (int digit = 0; digit < 8; digit++)
+				histograms[digit][(key >> (digit * 8)) & 0xFF]++;
+
+		m_SortKeys.resize(count);
+		m_SortIndices.resize(count);
+		for (int digit = 0; digit < 8; digit++)
+		{
+			uint32_t* histogram = histograms[digit];
+			if (histogram[(m_Keys[0] >> (digit * 8)) & 0xFF] == count)
+				continue;
+			uint32_t offsets[256];
+			uint32_t sum = 0;
+			for (int bucket = 0; bucket < 256; bucket++)
+			{
+				offsets[bucket] = sum;
+				sum += histogram[bucket];
+			}
+			for (size_t i = 0; i < count; i++)
+			{
+				uint32_t position = offsets[(m_Keys[i] >> (digit * 8)) & 0xFF]++;
+				m_SortKeys[position] = m_Keys[i];
+				m_SortIndices[position] = m_Indices[i];
+			}
+			m_Keys.swap(m_SortKeys);
+			m_Indices.swap(m_SortIndices);
+		}
+	}
+
+private:
+	RenderLayerOrder m_LayerOrders[MAX_LAYERS];
+
+	std::vector<uint64_t> m_Keys;                    // recorded and appended since the last Execute()
+	std::vector<uint32_t> m_Indices;                 // payload of each key: list number << 24 | command index
+	RenderCommandList m_Own;                         // commands of Submit(), list 0
+	std::vector<const RenderCommandList*> m_Lists;
+	std::vector<uint64_t> m_SortKeys;        // radix sort scratch
+	std::vector<uint32_t> m_SortIndices;
+	RenderQueueStats m_Stats;
+};
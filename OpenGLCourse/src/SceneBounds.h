@@ -0,0 +1,559 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "JobSystem.h"
+
+// bounds tests run on 4 objects per instruction with SSE2 (every x86-64 compiler) and on 8 when the CPU has AVX;
+// like the AVX2 kernels of stb_image, the AVX path is compiled with a per-function target attribute and picked at
+// run time (SceneBounds::SimdWidth()), so the build doesn't need -mavx. One object at a time elsewhere.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCENE_BOUNDS_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) && _MSC_VER >= 1600  // VS2010, first with AVX intrinsics and _xgetbv
+#define SCENE_BOUNDS_AVX
+#define SCENE_BOUNDS_AVX_FUNC
+#include <immintrin.h>
+#include <intrin.h>
+#elif !defined(_MSC_VER) && (defined(__clang__) || __GNUC__ >= 5)
+#define SCENE_BOUNDS_AVX
+#define SCENE_BOUNDS_AVX_FUNC __attribute__((target("avx")))
+#include <immintrin.h>
+#include <cpuid.h>
+#endif
+#endif
+
+// the six planes of a view volume, normals pointing inwards
+struct Frustum
+{
+	float planes[6][4] = {};   // a, b, c, d of left, right, bottom, top, near, far: inside where a x + b y + c z + d >= 0
+
+	// planes of a column major (world to clip) matrix, as glUniformMatrix4fv takes it (Gribb and Hartmann)
+	static Frustum FromMatrix(const float* matrix)
+	{
+		Frustum frustum;
+		for (int plane = 0; plane < 6; plane++)
+		{
+			int axis = plane / 2;
+			float sign = plane % 2 == 0 ? 1.0f : -1.0f;
+			float* p = frustum.planes[plane];
+			for (int column = 0; column < 4; column++)
+				p[column] = matrix[column * 4 + 3] + sign * matrix[column * 4 + axis];
+			float length = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+			for (int i = 0; i < 4 && length > 0.0f; i++)
+				p[i] /= length;
+		}
+		return frustum;
+	}
+
+	// camera at the origin looking down -z, like the projection of vshader_lod.glsl
+	static Frustum Perspective(float verticalFov, float aspect, float nearPlane, float farPlane)
+	{
+		float focal = 1.0f / std::tan(verticalFov * 0.5f);
+		float matrix[16] = {
+			focal / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, focal, 0.0f, 0.0f,
+			0.0f, 0.0f, (farPlane + nearPlane) / (nearPlane - farPlane), -1.0f,
+			0.0f, 0.0f, 2.0f * farPlane * nearPlane / (nearPlane - farPlane), 0.0f };
+		return FromMatrix(matrix);
+	}
+};
+
+// counters of the last Cull*() call
+struct CullStats
+{
+	int objects = 0;            // in the store
+	int visible = 0;
+	int nodesVisited = 0;       // BVH nodes tested against the frustum
+	int objectsTested = 0;      // objects whose own bounds were tested, the rest was decided by their node
+};
+
+// Store of the scene objects' world space bounds, an AABB (center, half extents) and a bounding sphere each, in
+// structure of arrays layout so the frustum tests load a coordinate of 4/8 objects at once. Objects are visible
+// when neither their sphere nor their box is fully behind a frustum plane.
+// BuildBvh() sorts the store into a bounding volume hierarchy (median splits, LEAF_SIZE objects per leaf) that
+// Cull() descends: a node outside a plane rejects its whole subtree, a node inside a plane drops that plane
+// for its children, and a node inside all of them accepts its subtree without testing it. With a JobSystem the
+// subtrees below TASK_OBJECTS are culled on the worker threads. Ids from Add() stay valid when the BVH reorders.
+class SceneBounds
+{
+public:
+	static const int LEAF_SIZE = 64;
+	static const int TASK_OBJECTS = 16384;  // largest subtree (objects) of one worker task
+
+	// add an object, returns its id
+	// ------------------------------------------------------------------------
+	int Add(float x, float y, float z, float extentX, float extentY, float extentZ, float radius)
+	{
+		int id = (int)m_Ids.size();
+		m_Slots.push_back(id);
+		m_Ids.push_back(id);
+		m_CenterX.push_back(x); m_CenterY.push_back(y); m_CenterZ.push_back(z);
+		m_ExtentX.push_back(extentX); m_ExtentY.push_back(extentY); m_ExtentZ.push_back(extentZ);
+		m_Radius.push_back(radius);
+		m_BvhCurrent = false;
+		return id;
+	}
+
+	// move an object; the BVH is out of date until RefitBvh()
+	void Set(int id, float x, float y, float z, float extentX, float extentY, float extentZ, float radius)
+	{
+		int slot = m_Slots[id];
+		m_CenterX[slot] = x; m_CenterY[slot] = y; m_CenterZ[slot] = z;
+		m_ExtentX[slot] = extentX; m_ExtentY[slot] = extentY; m_ExtentZ[slot] = extentZ;
+		m_Radius[slot] = radius;
+		m_BvhCurrent = false;
+	}
+
+	// objects per frustum test instruction on this CPU: 8 with AVX, 4 with SSE2, else 1
+	// ------------------------------------------------------------------------
+	static int SimdWidth()
+	{
+		static const int width = detectSimdWidth();
+		return width;
+	}
+
+	int GetCount() const { return (int)m_Ids.size(); }
+	bool HasBvh() const { return m_BvhCurrent; }
+	const CullStats& GetStats() const { return m_Stats; }
+
+	// build the hierarchy over the current objects (reorders the store)
+	// ------------------------------------------------------------------------
+	void BuildBvh()
+	{
+		m_Nodes.clear();
+		std::vector<int> order(m_Ids.size());
+		for (size_t slot = 0; slot < order.size(); slot++)
+			order[slot] = (int)slot;
+		if (!order.empty())
+			buildNode(order, 0, (int)order.size());
+
+		// store the objects in leaf order, so every node covers one contiguous range
+		std::vector<float>* arrays[] = { &m_CenterX, &m_CenterY, &m_CenterZ, &m_ExtentX, &m_ExtentY, &m_ExtentZ, &m_Radius };
+		for (std::vector<float>* values : arrays)
+		{
+			std::vector<float> sorted(values->size());
+			for (size_t slot = 0; slot < order.size(); slot++)
+				sorted[slot] = (*values)[order[slot]];
+			values->swap(sorted);
+		}
+		std::vector<int> ids(m_Ids.size());
+		for (size_t slot = 0; slot < order.size(); slot++)
+		{
+			ids[slot] = m_Ids[order[slot]];
+			m_Slots[ids[slot]] = (int)slot;
+		}
+		m_Ids.swap(ids);
+		refitNodes();
+		m_BvhCurrent = true;
+	}
+
+	// after Set(): new node bounds for the same tree, much cheaper than a rebuild while the objects stay close
+	// to where they were built (rebuilds when objects were added)
+	// ------------------------------------------------------------------------
+	void RefitBvh()
+	{
+		if (m_Nodes.empty() || m_Nodes[0].count != GetCount())
+		{
+			BuildBvh();
+			return;
+		}
+		refitNodes();
+		m_BvhCurrent = true;
+	}
+
+	// ids of the objects intersecting the frustum, through the BVH when it is current (in no particular order)
+	// ------------------------------------------------------------------------
+	void Cull(const Frustum& frustum, std::vector<int>& visible, JobSystem* jobs = NULL) const
+	{
+		if (!m_BvhCurrent)
+		{
+			CullLinear(frustum, visible, jobs);
+			return;
+		}
+		visible.clear();
+		m_Stats = CullStats();
+		m_Stats.objects = GetCount();
+		if (m_Nodes.empty())
+			return;
+
+		// serial descent to the subtrees small enough for one task, then the tasks on every thread
+		std::vector<NodeTask> tasks;
+		std::vector<NodeTask> stack;
+		stack.push_back(NodeTask{ 0, ALL_PLANES });
+		int threshold = jobs && jobs->GetThreadCount() > 1 ? TASK_OBJECTS : 0x7FFFFFFF;
+		while (!stack.empty())
+		{
+			NodeTask task = stack.back();
+			stack.pop_back();
+			const BvhNode& node = m_Nodes[task.node];
+			if (node.count <= threshold)
+			{
+				tasks.push_back(task);
+				continue;
+			}
+			m_Stats.nodesVisited++;
+			int result = testNode(frustum, node, task.planeMask);
+			if (result == OUTSIDE)
+				continue;
+			if (result == INSIDE)
+			{
+				tasks.push_back(NodeTask{ task.node, 0 });
+				continue;
+			}
+			stack.push_back(NodeTask{ node.right, task.planeMask });
+			stack.push_back(NodeTask{ task.node + 1, task.planeMask });
+		}
+
+		prepareThreads(jobs);
+		auto body = [&](int begin, int end, int thread) {
+			for (int i = begin; i < end; i++)
+				cullNode(frustum, tasks[i].node, tasks[i].planeMask, m_ThreadVisible[thread], m_ThreadStats[thread]);
+		};
+		if (jobs)
+			jobs->ParallelFor((int)tasks.size(), 1, body);
+		else
+			body(0, (int)tasks.size(), 0);
+		gatherThreads(visible);
+	}
+
+	// every object tested, SIMD, no hierarchy
+	// ------------------------------------------------------------------------
+	void CullLinear(const Frustum& frustum, std::vector<int>& visible, JobSystem* jobs = NULL) const
+	{
+		visible.clear();
+		m_Stats = CullStats();
+		m_Stats.objects = GetCount();
+		prepareThreads(jobs);
+		auto body = [&](int begin, int end, int thread) {
+			testRange(frustum, ALL_PLANES, begin, end, m_ThreadVisible[thread]);
+			m_ThreadStats[thread].objectsTested += end - begin;
+		};
+		if (jobs)
+			jobs->ParallelFor(GetCount(), TASK_OBJECTS, body);
+		else
+			body(0, GetCount(), 0);
+		gatherThreads(visible);
+	}
+
+	// one object at a time, plain C++; the reference the other paths are measured against
+	// ------------------------------------------------------------------------
+	void CullScalar(const Frustum& frustum, std::vector<int>& visible) const
+	{
+		visible.clear();
+		m_Stats = CullStats();
+		m_Stats.objects = GetCount();
+		for (int slot = 0; slot < GetCount(); slot++)
+		{
+			bool inside = true;
+			for (int p = 0; p < 6 && inside; p++)
+			{
+				const float* plane = frustum.planes[p];
+				float distance = plane[0] * m_CenterX[slot] + plane[1] * m_CenterY[slot] + plane[2] * m_CenterZ[slot] + plane[3];
+				float boxRadius = std::fabs(plane[0]) * m_ExtentX[slot] + std::fabs(plane[1]) * m_ExtentY[slot] + std::fabs(plane[2]) * m_ExtentZ[slot];
+				inside = distance + m_Radius[slot] >= 0.0f && distance + boxRadius >= 0.0f;
+			}
+			if (inside)
+				visible.push_back(m_Ids[slot]);
+		}
+		m_Stats.objectsTested = GetCount();
+		m_Stats.visible = (int)visible.size();
+	}
+
+private:
+	static const int ALL_PLANES = 0x3F;
+	enum NodeResult { OUTSIDE, INTERSECTING, INSIDE };
+
+	// preorder: the left child follows its parent, right is the index of the right child (-1 in leaves)
+	struct BvhNode
+	{
+		float center[3], extent[3];
+		int first, count;   // objects of the subtree, a contiguous range of the store
+		int right;
+	};
+
+	struct NodeTask
+	{
+		int node;
+		int planeMask;      // planes the node is not known to be inside of
+	};
+
+	int buildNode(std::vector<int>& order, int first, int count)
+	{
+		int index = (int)m_Nodes.size();
+		m_Nodes.push_back(BvhNode{ { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, first, count, -1 });
+		if (count <= LEAF_SIZE)
+			return index;
+
+		// split at the median of the longest axis of the centers' bounds
+		float low[3] = { 1e30f, 1e30f, 1e30f }, high[3] = { -1e30f, -1e30f, -1e30f };
+		const std::vector<float>* centers[3] = { &m_CenterX, &m_CenterY, &m_CenterZ };
+		for (int i = first; i < first + count; i++)
+		{
+			for (int axis = 0; axis < 3; axis++)
+			{
+				low[axis] = std::min(low[axis], (*centers[axis])[order[i]]);
+				high[axis] = std::max(high[axis], (*centers[axis])[order[i]]);
+			}
+		}
+		int axis = 0;
+		for (int a = 1; a < 3; a++)
+			if (high[a] - low[a] > high[axis] - low[axis])
+				axis = a;
+		const std::vector<float>& center = *centers[axis];
+		int middle = first + count / 2;
+		std::nth_element(order.begin() + first, order.begin() + middle, order.begin() + first + count,
+			[&center](int a, int b) { return center[a] < center[b]; });
+
+		buildNode(order, first, middle - first);
+		int right = buildNode(order, middle, first + count - middle);
+		m_Nodes[index].right = right;
+		return index;
+	}
+
+	// node bounds bottom up (children always come after their parent)
+	void refitNodes()
+	{
+		for (int index = (int)m_Nodes.size() - 1; index >= 0; index--)
+		{
+			BvhNode& node = m_Nodes[index];
+			float low[3] = { 1e30f, 1e30f, 1e30f }, high[3] = { -1e30f, -1e30f, -1e30f };
+			if (node.right < 0)
+			{
+				for (int slot = node.first; slot < node.first + node.count; slot++)
+				{
+					float center[3] = { m_CenterX[slot], m_CenterY[slot], m_CenterZ[slot] }, extent[3] = { m_ExtentX[slot], m_ExtentY[slot], m_ExtentZ[slot] };
+					for (int axis = 0; axis < 3; axis++)
+					{
+						low[axis] = std::min(low[axis], center[axis] - extent[axis]);
+						high[axis] = std::max(high[axis], center[axis] + extent[axis]);
+					}
+				}
+			}
+			else
+			{
+				for (const BvhNode* child : { &m_Nodes[index + 1], &m_Nodes[node.right] })
+				{
+					for (int axis = 0; axis < 3; axis++)
+					{
+						low[axis] = std::min(low[axis], child->center[axis] - child->extent[axis]);
+						high[axis] = std::max(high[axis], child->center[axis] + child->extent[axis]);
+					}
+				}
+			}
+			for (int axis = 0; axis < 3; axis++)
+			{
+				node.center[axis] = (low[axis] + high[axis]) * 0.5f;
+				node.extent[axis] = (high[axis] - low[axis]) * 0.5f;
+			}
+		}
+	}
+
+	// node box against the planes of planeMask; planes the box is fully inside of are removed from the mask
+	static NodeResult testNode(const Frustum& frustum, const BvhNode& node, int& planeMask)
+	{
+		for (int p = 0; p < 6; p++)
+		{
+			if (!(planeMask & (1 << p)))
+				continue;
+			const float* plane = frustum.planes[p];
+			float distance = plane[0] * node.center[0] + plane[1] * node.center[1] + plane[2] * node.center[2] + plane[3];
+			float radius = std::fabs(plane[0]) * node.extent[0] + std::fabs(plane[1]) * node.extent[1] + std::fabs(plane[2]) * node.extent[2];
+			if (distance + radius < 0.0f)
+				return OUTSIDE;
+			if (distance - radius >= 0.0f)
+				planeMask &= ~(1 << p);
+		}
+		return planeMask == 0 ? INSIDE : INTERSECTING;
+	}
+
+	void cullNode(const Frustum& frustum, int index, int planeMask, std::vector<int>& visible, CullStats& stats) const
+	{
+		const BvhNode& node = m_Nodes[index];
+		if (planeMask != 0)
+		{
+			stats.nodesVisited++;
+			if (testNode(frustum, node, planeMask) == OUTSIDE)
+				return;
+		}
+		if (planeMask == 0)
+		{
+			visible.insert(visible.end(), m_Ids.begin() + node.first, m_Ids.begin() + node.first + node.count);
+			return;
+		}
+		if (node.right < 0)
+		{
+			testRange(frustum, planeMask, node.first, node.first + node.count, visible);
+			stats.objectsTested += node.count;
+			return;
+		}
+		cullNode(frustum, index + 1, planeMask, visible, stats);
+		cullNode(frustum, node.right, planeMask, visible, stats);
+	}
+
+	// sphere and box of the objects in [begin, end) against the planes of planeMask, SimdWidth() objects at a time
+	void testRange(const Frustum& frustum, int planeMask, int begin, int end, std::vector<int>& visible) const
+	{
+		float planes[6][7];  // a, b, c, d, |a|, |b|, |c| of the planes to test
+		int planeCount = 0;
+		for (int p = 0; p < 6; p++)
+		{
+			if (!(planeMask & (1 << p)))
+				continue;
+			const float* plane = frustum.planes[p];
+			float* packed = planes[planeCount++];
+			for (int i = 0; i < 4; i++)
+				packed[i] = plane[i];
+			for (int i = 0; i < 3; i++)
+				packed[4 + i] = std::fabs(plane[i]);
+		}
+
+		int slot = begin;
+#ifdef SCENE_BOUNDS_AVX
+		if (SimdWidth() == 8)
+			slot = testRangeAvx(planes, planeCount, slot, end, visible);
+#endif
+#ifdef SCENE_BOUNDS_SSE2
+		slot = testRangeSse2(planes, planeCount, slot, end, visible);
+#endif
+		// what is left over (everything without SIMD)
+		for (; slot < end; slot++)
+		{
+			bool inside = true;
+			for (int p = 0; p < planeCount && inside; p++)
+			{
+				const float* plane = planes[p];
+				float distance = plane[0] * m_CenterX[slot] + plane[1] * m_CenterY[slot] + plane[2] * m_CenterZ[slot] + plane[3];
+				float boxRadius = plane[4] * m_ExtentX[slot] + plane[5] * m_ExtentY[slot] + plane[6] * m_ExtentZ[slot];
+				inside = distance + m_Radius[slot] >= 0.0f && distance + boxRadius >= 0.0f;
+			}
+			if (inside)
+				visible.push_back(m_Ids[slot]);
+		}
+	}
+
+#ifdef SCENE_BOUNDS_AVX
+	// 8 objects at a time from begin, returns the first slot not tested (planes: a, b, c, d, |a|, |b|, |c|)
+	SCENE_BOUNDS_AVX_FUNC int testRangeAvx(const float (*planes)[7], int planeCount, int begin, int end, std::vector<int>& visible) const
+	{
+		int slot = begin;
+		const __m256 zero = _mm256_setzero_ps();
+		for (; slot + 8 <= end; slot += 8)
+		{
+			__m256 x = _mm256_loadu_ps(&m_CenterX[slot]), y = _mm256_loadu_ps(&m_CenterY[slot]), z = _mm256_loadu_ps(&m_CenterZ[slot]);
+			__m256 ex = _mm256_loadu_ps(&m_ExtentX[slot]), ey = _mm256_loadu_ps(&m_ExtentY[slot]), ez = _mm256_loadu_ps(&m_ExtentZ[slot]);
+			__m256 radius = _mm256_loadu_ps(&m_Radius[slot]);
+			__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (int p = 0; p < planeCount; p++)
+			{
+				const float* plane = planes[p];
+				__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane[0]), x), _mm256_mul_ps(_mm256_set1_ps(plane[1]), y)),
+					_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane[2]), z), _mm256_set1_ps(plane[3])));
+				__m256 boxRadius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane[4]), ex), _mm256_mul_ps(_mm256_set1_ps(plane[5]), ey)),
+					_mm256_mul_ps(_mm256_set1_ps(plane[6]), ez));
+				inside = _mm256_and_ps(inside, _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GE_OQ),
+					_mm256_cmp_ps(_mm256_add_ps(distance, boxRadius), zero, _CMP_GE_OQ)));
+			}
+			appendLanes(_mm256_movemask_ps(inside), slot, visible);
+		}
+		return slot;
+	}
+#endif
+
+#ifdef SCENE_BOUNDS_SSE2
+	// same, 4 objects at a time
+	int testRangeSse2(const float (*planes)[7], int planeCount, int begin, int end, std::vector<int>& visible) const
+	{
+		int slot = begin;
+		const __m128 zero = _mm_setzero_ps();
+		for (; slot + 4 <= end; slot += 4)
+		{
+			__m128 x = _mm_loadu_ps(&m_CenterX[slot]), y = _mm_loadu_ps(&m_CenterY[slot]), z = _mm_loadu_ps(&m_CenterZ[slot]);
+			__m128 ex = _mm_loadu_ps(&m_ExtentX[slot]), ey = _mm_loadu_ps(&m_ExtentY[slot]), ez = _mm_loadu_ps(&m_ExtentZ[slot]);
+			__m128 radius = _mm_loadu_ps(&m_Radius[slot]);
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (int p = 0; p < planeCount; p++)
+			{
+				const float* plane = planes[p];
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[0]), x), _mm_mul_ps(_mm_set1_ps(plane[1]), y)),
+					_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[2]), z), _mm_set1_ps(plane[3])));
+				__m128 boxRadius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[4]), ex), _mm_mul_ps(_mm_set1_ps(plane[5]), ey)),
+					_mm_mul_ps(_mm_set1_ps(plane[6]), ez));
+				inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(distance, radius), zero), _mm_cmpge_ps(_mm_add_ps(distance, boxRadius), zero)));
+			}
+			appendLanes(_mm_movemask_ps(inside), slot, visible);
+		}
+		return slot;
+	}
+#endif
+
+	// AVX needs the OS to save the upper halves of the ymm registers (CPUID.1:ECX bit 27 OSXSAVE, bit 28 AVX, then
+	// XCR0 bits 1-2 set)
+	static int detectSimdWidth()
+	{
+#if defined(SCENE_BOUNDS_AVX) && defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+		if ((info[2] & (3 << 27)) == (3 << 27) && (_xgetbv(0) & 6) == 6)
+			return 8;
+#elif defined(SCENE_BOUNDS_AVX)
+		unsigned int eax, ebx, ecx, edx;
+		if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (3u << 27)) == (3u << 27))
+		{
+			__asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0)); // xgetbv
+			if ((eax & 6) == 6)
+				return 8;
+		}
+#endif
+#ifdef SCENE_BOUNDS_SSE2
+		return 4;
+#else
+		return 1;
+#endif
+	}
+
+	// ids of the lanes set in a movemask result
+	void appendLanes(int mask, int slot, std::vector<int>& visible) const
+	{
+		for (int lane = 0; mask != 0; lane++, mask >>= 1)
+			if (mask & 1)
+				visible.push_back(m_Ids[slot + lane]);
+	}
+
+	void prepareThreads(JobSystem* jobs) const
+	{
+		size_t threads = jobs ? (size_t)jobs->GetThreadCount() : 1;
+		if (m_ThreadVisible.size() < threads)
+			m_ThreadVisible.resize(threads);
+		m_ThreadStats.assign(threads, CullStats());
+		for (std::vector<int>& list : m_ThreadVisible)
+			list.clear();
+	}
+
+	void gatherThreads(std::vector<int>& visible) const
+	{
+		for (size_t thread = 0; thread < m_ThreadStats.size(); thread++)
+		{
+			visible.insert(visible.end(), m_ThreadVisible[thread].begin(), m_ThreadVisible[thread].end());
+			m_Stats.nodesVisited += m_ThreadStats[thread].nodesVisited;
+			m_Stats.objectsTested += m_ThreadStats[thread].objectsTested;
+		}
+		m_Stats.visible = (int)visible.size();
+	}
+
+private:
+	// structure of arrays, indexed by slot (the position in the store, BVH leaf order once built)
+	std::vector<float> m_CenterX, m_CenterY, m_CenterZ;
+	std::vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+	std::vector<float> m_Radius;
+	std::vector<int> m_Ids;        // slot -> id
+	std::vector<int> m_Slots;      // id -> slot
+
+	std::vector<BvhNode> m_Nodes;
+	bool m_BvhCurrent = false;
+
+	// per thread results of the last cull
+	mutable std::vector<std::vector<int>> m_ThreadVisible;
+	mutable std::vector<CullStats> m_ThreadStats;
+	mutable CullStats m_Stats;
+};
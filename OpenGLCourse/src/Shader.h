@@ -4,104 +4,411 @@
 #include <iostream>
 #include <fstream> // files
 #include <sstream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include "GLExtensions.h"
+#include "GLStateCache.h"
+#include "ProgramCache.h"
+#include "ShaderPreprocessor.h"
+#include "UniformBuffer.h"
 
 struct vector4
 {
 	float x, y, z, w;
 };
 
+// handle to an entry of the Shader uniform table, look it up once with GetUniform() and reuse it every frame
+struct UniformHandle
+{
+	int index = -1;
+	bool IsValid() const { return index >= 0; }
+};
+
+// when the Shader constructor compiles and links
+enum ShaderBuildMode
+{
+	SHADER_BUILD_BLOCKING,  // before the constructor returns
+	SHADER_BUILD_DEFERRED   // started by the constructor, finished by PollBuild() (see ShaderBatch)
+};
+
+// result of Shader::PollBuild()
+enum ShaderBuildStatus
+{
+	SHADER_BUILD_IDLE,      // no build pending
+	SHADER_BUILD_PENDING,   // the driver is still compiling/linking, the old program (if any) stays in use
+	SHADER_BUILD_DONE,      // the new program replaced the old one
+	SHADER_BUILD_FAILED     // compile or link error (printed), the old program (if any) stays in use
+};
+
 class Shader
 {
 
 public:
 	// constructor generates the shader on the fly
-	// constructor reads and builds the shader
-	Shader(const char* vertexPath, const char* fragmentPath) : m_ID(0)
+	// constructor reads and builds the shader (or takes the linked program from the binary cache if one is given);
+	// a deferred build leaves GetID() at 0 until PollBuild() returns SHADER_BUILD_DONE
+	Shader(const char* vertexPath, const char* fragmentPath, ProgramCache* cache = NULL, ShaderBuildMode mode = SHADER_BUILD_BLOCKING)
+		: Shader(vertexPath, fragmentPath, ShaderDefines(), cache, mode)
+	{
+	}
+
+	// one permutation of the shader: the sources are run through the ShaderPreprocessor with these defines
+	Shader(const char* vertexPath, const char* fragmentPath, const ShaderDefines& defines, ProgramCache* cache = NULL, ShaderBuildMode mode = SHADER_BUILD_BLOCKING)
+		: m_ID(0), m_VertexPath(vertexPath), m_FragmentPath(fragmentPath), m_Defines(defines), m_Cache(cache)
 	{
 		// 1. retrieve the vertex/fragment source code from filePath
 		std::string vertexSource, fragmentSource;
-		std::ifstream vShaderFile, fShaderFile;
-		// ensure ifstream objects can throw exceptions:
-		vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-		fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-		try
+		readSources(vertexSource, fragmentSource);
+		build(vertexSource, fragmentSource, mode);
+	}
+
+	// a permutation whose sources the caller already ran through the ShaderPreprocessor with these defines, files
+	// being every file that read (see ShaderPermutationCache); the paths are only read again by BeginReload()
+	Shader(const char* vertexPath, const char* fragmentPath, const ShaderDefines& defines, const std::string& vertexSource,
+		const std::string& fragmentSource, const std::vector<std::string>& files, ProgramCache* cache = NULL, ShaderBuildMode mode = SHADER_BUILD_BLOCKING)
+		: m_ID(0), m_VertexPath(vertexPath), m_FragmentPath(fragmentPath), m_Defines(defines), m_Dependencies(files), m_Cache(cache)
+	{
+		build(vertexSource, fragmentSource, mode);
+	}
+
+	~Shader()
+	{
+		cancelBuild();
+		glDeleteProgram(m_ID);
+		GLStateCache::Get().ForgetProgram(m_ID);
+	}
+
+	// activate the shader (skipped when it is already the current program)
+	// ------------------
+	void Bind() const
+	{
+		GLStateCache::Get().UseProgram(m_ID);
+	}
+
+	unsigned int GetID() const { return m_ID; }
+	const std::string& GetVertexPath() const { return m_VertexPath; }
+	const std::string& GetFragmentPath() const { return m_FragmentPath; }
+	const ShaderDefines& GetDefines() const { return m_Defines; }
+	// every file the last build read: both stage files and their includes
+	const std::vector<std::string>& GetDependencies() const { return m_Dependencies; }
+
+	// uniform table lookup, resolve the handle once and keep it (returns an invalid handle if the uniform is not active);
+	// handles stay valid across reloads, a uniform the reloaded program doesn't use any more just ignores its setters
+	// ------------------------------------------------------------------------
+	UniformHandle GetUniform(const std::string& name) const
+	{
+		auto it = findUniform(name);
+		if (it == m_UniformOrder.end() || m_UniformNames[*it] != name)
+			return UniformHandle{};
+		return UniformHandle{ *it };
+	}
+
+	// handle based uniform functions (hot path: no string work and no GL query)
+	// ------------------------------------------------------------------------
+	void Set(UniformHandle handle, int value) const
+	{
+		glUniform1i(location(handle), value);
+	}
+
+	void Set(UniformHandle handle, float value) const
+	{
+		glUniform1f(location(handle), value);
+	}
+
+	void Set(UniformHandle handle, float x, float y) const
+	{
+		glUniform2f(location(handle), x, y);
+	}
+
+	void Set(UniformHandle handle, const vector4& value) const
+	{
+		glUniform4f(location(handle), value.x, value.y, value.z, value.w);
+	}
+
+	// int arrays, e.g. the texture units of a sampler array
+	void Set(UniformHandle handle, const int* values, int count) const
+	{
+		glUniform1iv(location(handle), count, values);
+	}
+
+	// connect a uniform block to a binding point (GLSL 330 has no layout(binding = N) for blocks); expectedSize is the
+	// sizeof of the C++ struct uploaded into it, a block larger than that gets reported. Returns false if the block
+	// is not active.
+	// ------------------------------------------------------------------------
+	bool BindBlock(const std::string& name, UniformBlockBinding binding, size_t expectedSize = 0) const
+	{
+		auto it = std::lower_bound(m_BlockNames.begin(), m_BlockNames.end(), name);
+		if (it == m_BlockNames.end() || *it != name)
+			return false;
+		size_t block = it - m_BlockNames.begin();
+		if (expectedSize && m_BlockSizes[block] > expectedSize)
+			std::cout << "ERROR::SHADER::UNIFORM_BLOCK_SIZE_MISMATCH: " << name << " is " << m_BlockSizes[block] << " bytes, the buffer struct " << expectedSize << std::endl;
+		glUniformBlockBinding(m_ID, m_BlockIndices[block], binding);
+		return true;
+	}
+
+	// hot reload: rebuild the program from the source files without blocking the frame, the current program stays
+	// in use until PollBuild() swaps in the new one (uniform values and block bindings are carried over)
+	// ------------------------------------------------------------------------
+	bool BeginReload()
+	{
+		std::string vertexSource, fragmentSource;
+		if (!readSources(vertexSource, fragmentSource))
+			return false;
+		startBuild(vertexSource, fragmentSource, m_Cache ? m_Cache->Key({ vertexSource, fragmentSource }, m_Defines.ToString()) : 0);
+		return true;
+	}
+
+	// call once per frame while a build is pending; with GL_KHR_parallel_shader_compile it never waits for the driver
+	// ------------------------------------------------------------------------
+	ShaderBuildStatus PollBuild()
+	{
+		if (!m_Build.program)
+			return SHADER_BUILD_IDLE;
+		if (parallelCompileSupported())
 		{
-			//open files
-			vShaderFile.open(vertexPath);
-			fShaderFile.open(fragmentPath);
-			std::stringstream vShaderStream, fShaderStream;
-			// read file's buffer contents into streams
-			vShaderStream << vShaderFile.rdbuf();
-			fShaderStream << fShaderFile.rdbuf();
-			// close file handlers
-			vShaderFile.close();
-			fShaderFile.close();
-			// convert stream into string
-			vertexSource = vShaderStream.str();
-			fragmentSource = fShaderStream.str();
+			int done = 0;
+			glGetProgramiv(m_Build.program, GL_COMPLETION_STATUS_KHR, &done);
+			if (!done)
+				return SHADER_BUILD_PENDING;
 		}
-		catch (const std::ifstream::failure& error)
+
+		bool built = checkErrors(m_Build.vertexID, GL_COMPILE_STATUS);
+		built = checkErrors(m_Build.fragmentID, GL_COMPILE_STATUS) && built;
+		built = built && checkErrors(m_Build.program, GL_LINK_STATUS);
+		unsigned int program = m_Build.program;
+		m_Build.program = 0;
+		glDeleteShader(m_Build.vertexID);
+		glDeleteShader(m_Build.fragmentID);
+		if (!built)
 		{
-			std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << error.what() << std::endl;
+			glDeleteProgram(program);
+			return SHADER_BUILD_FAILED;
 		}
-		// 2. Compile shaders
+
+		if (m_ID)
+		{
+			copyProgramState(m_ID, program);
+			glDeleteProgram(m_ID);
+			GLStateCache::Get().ForgetProgram(m_ID);
+		}
+		m_ID = program;
+		reflectUniforms();
+		cacheBlocks();
+		m_BuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Build.start).count();
+		if (m_Cache)
+			m_Cache->Store(m_Build.cacheKey, m_ID, m_BuildMs);
+		return SHADER_BUILD_DONE;
+	}
+
+	bool IsBuildPending() const { return m_Build.program != 0; }
+
+	// start of the build to SHADER_BUILD_DONE of the last deferred build or reload
+	double GetBuildMs() const { return m_BuildMs; }
+
+	// GL_KHR_parallel_shader_compile or the ARB version: compile/link status can be polled without blocking
+	static bool parallelCompileSupported()
+	{
+		return GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+	}
+
+	// utility uniform functions
+   // ------------------------------------------------------------------------
+	void SetInt(const std::string& name, int value)
+	{
+		Set(GetUniform(name), value);
+	}
+
+	void SetFloat4(const std::string& name, const vector4& value)
+	{
+		Set(GetUniform(name), value);
+	}
+
+private:
+	// steps 2. to 4. of the constructors
+	// ------------------------------------------------------------------------
+	void build(const std::string& vertexSource, const std::string& fragmentSource, ShaderBuildMode mode)
+	{
+		// 2. Reuse the program binary of a previous run when sources and driver are unchanged
+		uint64_t cacheKey = 0;
+		if (m_Cache)
+		{
+			cacheKey = m_Cache->Key({ vertexSource, fragmentSource }, m_Defines.ToString());
+			m_ID = m_Cache->Load(cacheKey);
+		}
+		if (!m_ID && mode == SHADER_BUILD_DEFERRED)
+		{
+			startBuild(vertexSource, fragmentSource, cacheKey);
+			return;
+		}
+		if (!m_ID)
+		{
+			auto compileStart = std::chrono::steady_clock::now();
+
+			// 3. Compile shaders and link the program
+			unsigned int vertexID, fragmentID;
+			unsigned int programID = startProgram(vertexSource, fragmentSource, vertexID, fragmentID);
+			checkErrors(vertexID, GL_COMPILE_STATUS);
+			checkErrors(fragmentID, GL_COMPILE_STATUS);
+			bool linked = checkErrors(programID, GL_LINK_STATUS);
+
+			// Delete the shaders as they're linked into our program now and no longer necessary
+			glDeleteShader(vertexID);
+			glDeleteShader(fragmentID);
+
+			m_ID = programID;  // Save ID 
+
+			if (m_Cache && linked)
+				m_Cache->Store(cacheKey, m_ID, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compileStart).count());
+		}
+
+		// 4. Reflect the active uniforms and uniform blocks once so the setters never have to query the driver
+		reflectUniforms();
+		cacheBlocks();
+	}
+
+	// preprocess both source files, false (and the error printed) if a file can't be read
+	// ------------------------------------------------------------------------
+	bool readSources(std::string& vertexSource, std::string& fragmentSource)
+	{
+		std::vector<std::string> files;
+		bool ok = ShaderPreprocessor::Process(m_VertexPath, m_Defines, vertexSource, files);
+		ok = ShaderPreprocessor::Process(m_FragmentPath, m_Defines, fragmentSource, files) && ok;
+		// keep watching the old files when the new ones are incomplete
+		if (ok || m_Dependencies.empty())
+			m_Dependencies = files;
+		return ok;
+	}
+
+	// create both shaders and the program and start compiling and linking; with parallel shader compile the driver
+	// may still be working on them when this returns, the status queries of checkErrors() wait for it
+	// ------------------------------------------------------------------------
+	unsigned int startProgram(const std::string& vertexSource, const std::string& fragmentSource, unsigned int& vertexID, unsigned int& fragmentID)
+	{
 		const char* vShaderSource = vertexSource.c_str();
 		const char* fShaderSource = fragmentSource.c_str();
 		// Compile Vertex Shader
-		unsigned int vertexID = glCreateShader(GL_VERTEX_SHADER);
+		vertexID = glCreateShader(GL_VERTEX_SHADER);
 		glShaderSource(vertexID, 1, &vShaderSource, NULL);
 		glCompileShader(vertexID);
-		checkErrors(vertexID, GL_COMPILE_STATUS);
 
 		// Compile Fragment Shader
-		unsigned int fragmentID = glCreateShader(GL_FRAGMENT_SHADER);
+		fragmentID = glCreateShader(GL_FRAGMENT_SHADER);
 		glShaderSource(fragmentID, 1, &fShaderSource, NULL);
 		glCompileShader(fragmentID);
-		checkErrors(fragmentID, GL_COMPILE_STATUS);
 
-		//3. Link Shader Program
+		// Link Shader Program
 		unsigned int programID = glCreateProgram();
 		glAttachShader(programID, vertexID);
 		glAttachShader(programID, fragmentID);
+		if (m_Cache)
+			m_Cache->PrepareForLink(programID);
 		glLinkProgram(programID);
-		checkErrors(programID, GL_LINK_STATUS);
-
-		// Delete the shaders as they're linked into our program now and no longer necessary
-		glDeleteShader(vertexID);
-		glDeleteShader(fragmentID);
-
-		m_ID = programID;  // Save ID 
+		return programID;
 	}
 
-	~Shader() { glDeleteProgram(m_ID); }
+	// compile and link into m_Build, replacing a build still pending
+	void startBuild(const std::string& vertexSource, const std::string& fragmentSource, uint64_t cacheKey)
+	{
+		cancelBuild();
+		m_Build.start = std::chrono::steady_clock::now();
+		m_Build.cacheKey = cacheKey;
+		m_Build.program = startProgram(vertexSource, fragmentSource, m_Build.vertexID, m_Build.fragmentID);
+	}
 
-	// activate the shader
-	// ------------------
-	void Bind() const
+	void cancelBuild()
 	{
-		glUseProgram(m_ID);
+		if (!m_Build.program)
+			return;
+		glDeleteShader(m_Build.vertexID);
+		glDeleteShader(m_Build.fragmentID);
+		glDeleteProgram(m_Build.program);
+		m_Build.program = 0;
 	}
 
-	// utility uniform functions
-   // ------------------------------------------------------------------------
-	void SetInt(const std::string& name, int value)
+	// give the reloaded program the uniform values (sampler units and everything else set once at startup) and
+	// uniform block bindings of the program it replaces
+	// ------------------------------------------------------------------------
+	void copyProgramState(unsigned int from, unsigned int to)
 	{
-		int location = glGetUniformLocation(m_ID, name.c_str());
-		glUniform1i(location, value);
+		GLStateCache::Get().UseProgram(to);
+		int count = 0, maxLength = 0;
+		glGetProgramiv(to, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(to, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+		std::vector<char> nameBuffer(maxLength > 0 ? maxLength : 1);
+		for (int i = 0; i < count; i++)
+		{
+			int length = 0, size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(to, i, maxLength, &length, &size, &type, nameBuffer.data());
+			std::string name(nameBuffer.data(), length);
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				name.erase(name.size() - 3);
+			for (int element = 0; element < size; element++)
+			{
+				std::string elementName = size > 1 ? name + "[" + std::to_string(element) + "]" : name;
+				int source = glGetUniformLocation(from, elementName.c_str());
+				int target = glGetUniformLocation(to, elementName.c_str());
+				if (source >= 0 && target >= 0)
+					copyUniform(from, source, target, type);
+			}
+		}
+
+		glGetProgramiv(from, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+		glGetProgramiv(from, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+		nameBuffer.resize(maxLength > 0 ? maxLength : 1);
+		for (int i = 0; i < count; i++)
+		{
+			int length = 0, binding = 0;
+			glGetActiveUniformBlockName(from, i, maxLength, &length, nameBuffer.data());
+			glGetActiveUniformBlockiv(from, i, GL_UNIFORM_BLOCK_BINDING, &binding);
+			unsigned int block = glGetUniformBlockIndex(to, nameBuffer.data());
+			if (block != GL_INVALID_INDEX)
+				glUniformBlockBinding(to, block, binding);
+		}
 	}
 
-	void SetFloat4(const std::string& name, const vector4& value)
+	// one uniform value from a program into the current program
+	static void copyUniform(unsigned int from, int source, int target, GLenum type)
 	{
-		int location = glGetUniformLocation(m_ID, name.c_str());
-		glUniform4f(location, value.x, value.y, value.z, value.w);
+		float floats[16];
+		int ints[4];
+		unsigned int uints[4];
+		switch (type)
+		{
+		case GL_FLOAT:        glGetUniformfv(from, source, floats); glUniform1fv(target, 1, floats); break;
+		case GL_FLOAT_VEC2:   glGetUniformfv(from, source, floats); glUniform2fv(target, 1, floats); break;
+		case GL_FLOAT_VEC3:   glGetUniformfv(from, source, floats); glUniform3fv(target, 1, floats); break;
+		case GL_FLOAT_VEC4:   glGetUniformfv(from, source, floats); glUniform4fv(target, 1, floats); break;
+		case GL_FLOAT_MAT2:   glGetUniformfv(from, source, floats); glUniformMatrix2fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT3:   glGetUniformfv(from, source, floats); glUniformMatrix3fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT4:   glGetUniformfv(from, source, floats); glUniformMatrix4fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT2x3: glGetUniformfv(from, source, floats); glUniformMatrix2x3fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT2x4: glGetUniformfv(from, source, floats); glUniformMatrix2x4fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT3x2: glGetUniformfv(from, source, floats); glUniformMatrix3x2fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT3x4: glGetUniformfv(from, source, floats); glUniformMatrix3x4fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT4x2: glGetUniformfv(from, source, floats); glUniformMatrix4x2fv(target, 1, GL_FALSE, floats); break;
+		case GL_FLOAT_MAT4x3: glGetUniformfv(from, source, floats); glUniformMatrix4x3fv(target, 1, GL_FALSE, floats); break;
+		case GL_INT_VEC2:
+		case GL_BOOL_VEC2:    glGetUniformiv(from, source, ints); glUniform2iv(target, 1, ints); break;
+		case GL_INT_VEC3:
+		case GL_BOOL_VEC3:    glGetUniformiv(from, source, ints); glUniform3iv(target, 1, ints); break;
+		case GL_INT_VEC4:
+		case GL_BOOL_VEC4:    glGetUniformiv(from, source, ints); glUniform4iv(target, 1, ints); break;
+		case GL_UNSIGNED_INT:      glGetUniformuiv(from, source, uints); glUniform1uiv(target, 1, uints); break;
+		case GL_UNSIGNED_INT_VEC2: glGetUniformuiv(from, source, uints); glUniform2uiv(target, 1, uints); break;
+		case GL_UNSIGNED_INT_VEC3: glGetUniformuiv(from, source, uints); glUniform3uiv(target, 1, uints); break;
+		case GL_UNSIGNED_INT_VEC4: glGetUniformuiv(from, source, uints); glUniform4uiv(target, 1, uints); break;
+		default:              glGetUniformiv(from, source, ints); glUniform1iv(target, 1, ints); break; // int, bool and every sampler type
+		}
 	}
 
-private:
-	// utility function for checking shader compilation/linking errors.
+	// utility function for checking shader compilation/linking errors, returns true on success.
 	// ------------------------------------------------------------------------
-	void checkErrors(unsigned int ID, int statusType)
+	bool checkErrors(unsigned int ID, int statusType)
 	{
-		int success;
+		int success = 0;
 		char infoLog[1024];
 
 		if (statusType == GL_COMPILE_STATUS)
@@ -126,8 +433,111 @@ private:
 		{ 
 			std::cout << "ERROR::STATUS_NOT_SUPPORTED " << std::endl;
 		}
+		return success != 0;
+	}
+
+	// location of a handle, -1 (ignored by glUniform*) when the uniform is not active
+	int location(UniformHandle handle) const
+	{
+		return handle.IsValid() ? m_UniformLocations[handle.index] : -1;
+	}
+
+	// position of name in m_UniformOrder (the table sorted by name)
+	std::vector<int>::const_iterator findUniform(const std::string& name) const
+	{
+		return std::lower_bound(m_UniformOrder.begin(), m_UniformOrder.end(), name,
+			[this](int index, const std::string& value) { return m_UniformNames[index] < value; });
+	}
+
+	// query every active uniform of the linked program and store its location in the flat uniform table; entries are
+	// only ever appended, so handles keep pointing at the same name after a reload (location -1 when it's gone)
+	// ------------------------------------------------------------------------
+	void reflectUniforms()
+	{
+		std::fill(m_UniformLocations.begin(), m_UniformLocations.end(), -1);
+
+		int count = 0, maxLength = 0;
+		glGetProgramiv(m_ID, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(m_ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		std::vector<char> nameBuffer(maxLength > 0 ? maxLength : 1);
+		for (int i = 0; i < count; i++)
+		{
+			int length = 0, size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(m_ID, i, maxLength, &length, &size, &type, nameBuffer.data());
+			std::string name(nameBuffer.data(), length);
+			// arrays are reported as "name[0]", store them by their base name
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				name.erase(name.size() - 3);
+			int location = glGetUniformLocation(m_ID, name.c_str());
+			if (location < 0) // uniforms inside blocks have no location
+				continue;
+
+			auto it = findUniform(name);
+			if (it != m_UniformOrder.end() && m_UniformNames[*it] == name)
+			{
+				m_UniformLocations[*it] = location;
+				continue;
+			}
+			m_UniformOrder.insert(it, (int)m_UniformNames.size());
+			m_UniformNames.push_back(name);
+			m_UniformLocations.push_back(location);
+		}
+	}
+
+	// same for the active uniform blocks: names sorted, with their block index and data size
+	// ------------------------------------------------------------------------
+	void cacheBlocks()
+	{
+		m_BlockNames.clear();
+		m_BlockIndices.clear();
+		m_BlockSizes.clear();
+
+		int count = 0, maxLength = 0;
+		glGetProgramiv(m_ID, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+		glGetProgramiv(m_ID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+
+		std::vector<std::pair<std::string, unsigned int>> blocks;
+		std::vector<char> nameBuffer(maxLength > 0 ? maxLength : 1);
+		for (int i = 0; i < count; i++)
+		{
+			int length = 0;
+			glGetActiveUniformBlockName(m_ID, i, maxLength, &length, nameBuffer.data());
+			blocks.emplace_back(std::string(nameBuffer.data(), length), (unsigned int)i);
+		}
+
+		std::sort(blocks.begin(), blocks.end());
+		for (const auto& block : blocks)
+		{
+			int size = 0;
+			glGetActiveUniformBlockiv(m_ID, block.second, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+			m_BlockNames.push_back(block.first);
+			m_BlockIndices.push_back(block.second);
+			m_BlockSizes.push_back((size_t)size);
+		}
 	}
 
 private:
 	unsigned int m_ID; // the program ID (Shader Program ID)
+	std::string m_VertexPath, m_FragmentPath;
+	ShaderDefines m_Defines;
+	std::vector<std::string> m_Dependencies;
+	ProgramCache* m_Cache;                   // NULL without a binary cache
+	std::vector<std::string> m_UniformNames; // uniform names seen so far, indexed by UniformHandle::index
+	std::vector<int> m_UniformLocations;     // locations indexed by UniformHandle::index, -1 when not active
+	std::vector<int> m_UniformOrder;         // table indices sorted by name, only used to resolve handles
+	std::vector<std::string> m_BlockNames;   // sorted active uniform block names
+	std::vector<unsigned int> m_BlockIndices;
+	std::vector<size_t> m_BlockSizes;        // GL_UNIFORM_BLOCK_DATA_SIZE
+
+	struct BuildJob
+	{
+		unsigned int program = 0;            // 0 when no build is pending
+		unsigned int vertexID = 0, fragmentID = 0;
+		uint64_t cacheKey = 0;
+		std::chrono::steady_clock::time_point start;
+	};
+	BuildJob m_Build;                        // deferred build or reload in progress
+	double m_BuildMs = 0.0;
 };
\ No newline at end of file
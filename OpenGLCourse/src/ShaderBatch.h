@@ -0,0 +1,117 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "GLExtensions.h"
+#include "ProgramCache.h"
+#include "Shader.h"
+#include "Util.h"
+
+struct ShaderBatchStats
+{
+	int programs = 0;           // Add() calls
+	int cacheHits = 0;          // ready right away from the ProgramCache
+	int built = 0;              // compiled and linked
+	int failed = 0;             // compile or link errors (printed)
+	double submitMs = 0.0;      // time spent in Add(), handing the sources to the driver
+	double totalMs = 0.0;       // first Add() to the last program finished
+	double maxPollMs = 0.0;     // longest single Poll(), the worst stall a loading frame saw
+};
+
+// Builds many programs at once. Add() hands every compile and link to the driver right away and Poll() collects
+// the results, so with GL_KHR_parallel_shader_compile the driver's compiler threads work through the whole batch
+// while the caller keeps rendering (e.g. a loading screen) and only checks the status of finished programs.
+// Without the extension the driver compiles when the status is first queried; Poll() then finishes programs until
+// its time budget is used up, at least one per call, so frames keep coming, just further apart.
+class ShaderBatch
+{
+public:
+	static constexpr double DEFAULT_POLL_BUDGET_MS = 4.0;
+
+	// must be created with a current GL context
+	explicit ShaderBatch(ProgramCache* cache = NULL) : m_Cache(cache)
+	{
+		// the default thread count is up to the driver (some use none until asked), 0xFFFFFFFF lets it use all it wants
+		if (GLAD_GL_KHR_parallel_shader_compile)
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+		else if (GLAD_GL_ARB_parallel_shader_compile)
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+	}
+
+	ShaderBatch(const ShaderBatch&) = delete;
+	ShaderBatch& operator=(const ShaderBatch&) = delete;
+
+	// start building a program; the shader is owned by the batch and has GetID() 0 until Poll() finished it
+	// ------------------------------------------------------------------------
+	Shader* Add(const char* vertexPath, const char* fragmentPath, const ShaderDefines& defines = ShaderDefines())
+	{
+		double start = NowMs();
+		if (m_Shaders.empty())
+			m_Start = start;
+		m_Shaders.emplace_back(new Shader(vertexPath, fragmentPath, defines, m_Cache, SHADER_BUILD_DEFERRED));
+		Shader* shader = m_Shaders.back().get();
+		if (shader->IsBuildPending())
+			m_Pending.push_back(shader);
+		else
+			m_Stats.cacheHits++;
+		m_Stats.programs++;
+		m_Stats.submitMs += NowMs() - start;
+		if (m_Pending.empty())
+			m_Stats.totalMs = NowMs() - m_Start;
+		return shader;
+	}
+
+	// collect the programs the driver has finished, returns true once none is pending (budget < 0: wait for all)
+	// ------------------------------------------------------------------------
+	bool Poll(double budgetMs = DEFAULT_POLL_BUDGET_MS)
+	{
+		if (m_Pending.empty())
+			return true;
+		double start = NowMs();
+		bool blocking = !Shader::parallelCompileSupported();
+		size_t kept = 0;
+		for (size_t i = 0; i < m_Pending.size(); i++)
+		{
+			// without the extension every status query compiles, stop once the budget is used up
+			if (blocking && i > 0 && budgetMs >= 0.0 && NowMs() - start >= budgetMs)
+			{
+				m_Pending[kept++] = m_Pending[i];
+				continue;
+			}
+			ShaderBuildStatus status = m_Pending[i]->PollBuild();
+			if (status == SHADER_BUILD_PENDING)
+				m_Pending[kept++] = m_Pending[i];
+			else if (status == SHADER_BUILD_DONE)
+				m_Stats.built++;
+			else
+				m_Stats.failed++;
+		}
+		m_Pending.resize(kept);
+
+		double end = NowMs();
+		m_Stats.maxPollMs = std::max(m_Stats.maxPollMs, end - start);
+		if (m_Pending.empty())
+			m_Stats.totalMs = end - m_Start;
+		return m_Pending.empty();
+	}
+
+	// block until every program is finished
+	// ------------------------------------------------------------------------
+	void Finish()
+	{
+		while (!Poll(-1.0))
+			std::this_thread::yield();
+	}
+
+	int GetPendingCount() const { return (int)m_Pending.size(); }
+	const ShaderBatchStats& GetStats() const { return m_Stats; }
+
+private:
+	ProgramCache* m_Cache;                          // NULL without a binary cache
+	std::vector<std::unique_ptr<Shader>> m_Shaders;
+	std::vector<Shader*> m_Pending;                 // builds not collected yet, in submission order
+	double m_Start = 0.0;
+	ShaderBatchStats m_Stats;
+};
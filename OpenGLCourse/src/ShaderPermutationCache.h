@@ -0,0 +1,101 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ProgramCache.h"
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+#include "Util.h"
+
+struct ShaderPermutationStats
+{
+	int requests = 0;           // Get() calls
+	int hits = 0;               // served by a program built earlier in this process
+	int programs = 0;           // permutations built (misses)
+	size_t sourceBytes = 0;     // preprocessed GLSL handed to the driver for the built programs
+	size_t binaryBytes = 0;     // GL_PROGRAM_BINARY_LENGTH of the built programs, the driver side size of the code
+};
+
+// Process wide cache of shader permutations: Get() preprocesses the stage files with the requested defines and
+// returns the program already built from the same (sources, define set) if there is one, so every
+// permutation is compiled once per process however many materials ask for it. Programs are owned by the cache
+// and live as long as it does. Call Get() at load time and keep the pointer, it reads and hashes the files.
+class ShaderPermutationCache
+{
+public:
+	// programCache: optional on-disk binary cache the built programs go through
+	explicit ShaderPermutationCache(ProgramCache* programCache = NULL) : m_ProgramCache(programCache) {}
+
+	ShaderPermutationCache(const ShaderPermutationCache&) = delete;
+	ShaderPermutationCache& operator=(const ShaderPermutationCache&) = delete;
+
+	// the program of this permutation, built on the first request; NULL if a stage file or an include can't be read
+	// ------------------------------------------------------------------------
+	Shader* Get(const char* vertexPath, const char* fragmentPath, const ShaderDefines& defines = ShaderDefines())
+	{
+		m_Stats.requests++;
+		std::string vertexSource, fragmentSource;
+		std::vector<std::string> files;
+		bool ok = ShaderPreprocessor::Process(vertexPath, defines, vertexSource, files);
+		ok = ShaderPreprocessor::Process(fragmentPath, defines, fragmentSource, files) && ok;
+		if (!ok) // the preprocessor printed the error
+			return NULL;
+
+		// a hit has to match the whole sources and defines, not only the hash
+		std::string defineString = defines.ToString();
+		std::vector<Permutation>& bucket = m_Permutations[hash(vertexSource, fragmentSource, defineString)];
+		for (const Permutation& permutation : bucket)
+		{
+			if (permutation.vertexSource == vertexSource && permutation.fragmentSource == fragmentSource && permutation.defines == defineString)
+			{
+				m_Stats.hits++;
+				return permutation.shader.get();
+			}
+		}
+
+		// built from the sources just read, each file is preprocessed once per request
+		Shader* shader = new Shader(vertexPath, fragmentPath, defines, vertexSource, fragmentSource, files, m_ProgramCache);
+		bucket.push_back(Permutation{ vertexSource, fragmentSource, defineString, std::unique_ptr<Shader>(shader) });
+		m_Stats.programs++;
+		m_Stats.sourceBytes += vertexSource.size() + fragmentSource.size();
+		int binaryLength = 0;
+		glGetProgramiv(shader->GetID(), GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+		m_Stats.binaryBytes += binaryLength > 0 ? (size_t)binaryLength : 0;
+		return shader;
+	}
+
+	const ShaderPermutationStats& GetStats() const { return m_Stats; }
+
+	void PrintStats() const
+	{
+		double hitRate = m_Stats.requests ? 100.0 * m_Stats.hits / m_Stats.requests : 0.0;
+		FixedFormat outputFormat(std::cout, 1);
+		std::cout << "Shader permutations: " << m_Stats.programs << " built, " << m_Stats.hits << " of "
+			<< m_Stats.requests << " requests hit (" << hitRate << "%), " << m_Stats.sourceBytes / 1024.0 << " KiB source, "
+			<< m_Stats.binaryBytes / 1024.0 << " KiB program binaries" << std::endl;
+	}
+
+private:
+	// 64-bit FNV-1a over both preprocessed stages and the define set
+	static uint64_t hash(const std::string& vertexSource, const std::string& fragmentSource, const std::string& defines)
+	{
+		return Fnv1a64().Add(vertexSource).Add(fragmentSource).Add(defines).Get();
+	}
+
+	// what a program was built from, compared on every hit
+	struct Permutation
+	{
+		std::string vertexSource, fragmentSource;  // preprocessed
+		std::string defines;                       // ShaderDefines::ToString()
+		std::unique_ptr<Shader> shader;
+	};
+
+private:
+	ProgramCache* m_ProgramCache;  // NULL without a binary cache
+	std::unordered_map<uint64_t, std::vector<Permutation>> m_Permutations;  // by hash(), more than one entry only on a collision
+	ShaderPermutationStats m_Stats;
+};
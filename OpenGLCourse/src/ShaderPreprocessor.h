@@ -0,0 +1,144 @@
+#pragma once
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// #define set of one shader permutation, kept sorted by name so the same set always gives the same key
+class ShaderDefines
+{
+public:
+	ShaderDefines() {}
+
+	ShaderDefines(std::initializer_list<std::pair<std::string, std::string>> values)
+	{
+		for (const auto& value : values)
+			Set(value.first, value.second);
+	}
+
+	// add or replace a define
+	ShaderDefines& Set(const std::string& name, const std::string& value = "1")
+	{
+		auto it = std::lower_bound(m_Values.begin(), m_Values.end(), name,
+			[](const std::pair<std::string, std::string>& entry, const std::string& key) { return entry.first < key; });
+		if (it != m_Values.end() && it->first == name)
+			it->second = value;
+		else
+			m_Values.insert(it, { name, value });
+		return *this;
+	}
+
+	bool IsEmpty() const { return m_Values.empty(); }
+
+	// canonical "NAME=VALUE;..." form, part of the program cache keys
+	std::string ToString() const
+	{
+		std::string text;
+		for (const auto& value : m_Values)
+			text += value.first + "=" + value.second + ";";
+		return text;
+	}
+
+	// the #define lines inserted after #version
+	std::string ToGLSL() const
+	{
+		std::string text;
+		for (const auto& value : m_Values)
+			text += "#define " + value.first + " " + value.second + "\n";
+		return text;
+	}
+
+private:
+	std::vector<std::pair<std::string, std::string>> m_Values;
+};
+
+// GLSL source preprocessing done before the driver sees a shader: the permutation's #define lines go right after
+// #version and every #include "file" (resolved relative to the including file) is replaced by that file's text.
+// A file is included at most once per shader, so include files need no guards and cycles end by themselves.
+// #line directives keep compiler errors pointing at the right line: the error's source string number counts the
+// files of that shader in the order they were first included (0 is the shader file itself).
+class ShaderPreprocessor
+{
+public:
+	static const int MAX_INCLUDE_DEPTH = 16;
+
+	// expand path into output and append every file read to files; false (and the error printed) if one is missing
+	// ------------------------------------------------------------------------
+	static bool Process(const std::string& path, const ShaderDefines& defines, std::string& output, std::vector<std::string>& files)
+	{
+		output.clear();
+		std::vector<std::string> included;
+		return processFile(std::filesystem::path(path).lexically_normal().string(), "", defines, 0, output, included, files);
+	}
+
+private:
+	static bool processFile(const std::string& path, const std::string& includedFrom, const ShaderDefines& defines, int depth,
+		std::string& output, std::vector<std::string>& included, std::vector<std::string>& files)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			if (includedFrom.empty())
+				std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << path << std::endl;
+			else
+				std::cout << "ERROR::SHADER::INCLUDE_NOT_FOUND: " << path << " (included from " << includedFrom << ")" << std::endl;
+			return false;
+		}
+		int sourceNumber = (int)included.size();
+		included.push_back(path);
+		if (std::find(files.begin(), files.end(), path) == files.end())
+			files.push_back(path);
+
+		bool ok = true, versionSeen = false;
+		size_t begin = output.size();
+		std::string line;
+		for (int lineNumber = 1; std::getline(file, line); lineNumber++)
+		{
+			size_t start = line.find_first_not_of(" \t");
+			std::string directive = start == std::string::npos ? "" : line.substr(start);
+
+			if (depth == 0 && directive.compare(0, 8, "#version") == 0)
+			{
+				output += line + "\n" + defines.ToGLSL();
+				output += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceNumber) + "\n";
+				versionSeen = true;
+				continue;
+			}
+			if (directive.compare(0, 8, "#include") != 0)
+			{
+				output += line + "\n";
+				continue;
+			}
+
+			size_t open = directive.find_first_of("\"<", 8);
+			size_t close = open == std::string::npos ? open : directive.find_first_of("\">", open + 1);
+			if (close == std::string::npos)
+			{
+				std::cout << "ERROR::SHADER::BAD_INCLUDE: " << path << ":" << lineNumber << ": " << line << std::endl;
+				ok = false;
+				continue;
+			}
+			std::string includePath = (std::filesystem::path(path).parent_path() / directive.substr(open + 1, close - open - 1)).lexically_normal().string();
+			if (depth + 1 >= MAX_INCLUDE_DEPTH)
+			{
+				std::cout << "ERROR::SHADER::INCLUDE_TOO_DEEP: " << includePath << " (included from " << path << ")" << std::endl;
+				ok = false;
+				continue;
+			}
+			if (std::find(included.begin(), included.end(), includePath) == included.end())
+			{
+				output += "#line 1 " + std::to_string(included.size()) + "\n";
+				ok = processFile(includePath, path, defines, depth + 1, output, included, files) && ok;
+			}
+			output += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceNumber) + "\n";
+		}
+		// no #version (GLSL 1.10): the defines go first
+		if (depth == 0 && !versionSeen && !defines.IsEmpty())
+			output.insert(begin, defines.ToGLSL() + "#line 1 0\n");
+		return ok;
+	}
+};
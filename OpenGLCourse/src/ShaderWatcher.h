@@ -0,0 +1,293 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Shader.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Shader hot reload: a background thread watches the directories of the registered shaders (inotify on Linux,
+// modification times elsewhere) and queues every changed file. Update(), called once per frame on the GL thread,
+// starts a non blocking rebuild of each shader using a changed file and swaps the new program in once the driver
+// has linked it; a shader that doesn't compile keeps running its old program.
+class ShaderWatcher
+{
+public:
+	static const int WAKE_UP_MS = 100;  // how often the thread checks whether it should quit (and polls mtimes)
+
+	ShaderWatcher() {}
+
+	~ShaderWatcher() { Stop(); }
+
+	ShaderWatcher(const ShaderWatcher&) = delete;
+	ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+	// register a shader (its stage files and everything they include), call before Start(); the shader must
+	// outlive the watcher
+	// ------------------------------------------------------------------------
+	void Watch(Shader& shader)
+	{
+		m_Shaders.push_back(WatchedShader{ &shader, {}, false });
+		for (const std::string& path : shader.GetDependencies())
+			addFile(path);
+	}
+
+	// start the watcher thread
+	// ------------------------------------------------------------------------
+	void Start()
+	{
+		if (m_Thread.joinable() || m_Files.empty())
+			return;
+		m_Quit = false;
+#ifdef __linux__
+		m_Inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_Inotify < 0)
+		{
+			std::cout << "ERROR::SHADER_WATCHER::INOTIFY_INIT_FAILED" << std::endl;
+			return;
+		}
+		for (const std::string& directory : directories())
+		{
+			int watch = inotify_add_watch(m_Inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+			if (watch < 0)
+				std::cout << "ERROR::SHADER_WATCHER::CANNOT_WATCH: " << directory << std::endl;
+			else
+				m_Watches.push_back(WatchedDirectory{ watch, directory });
+		}
+		m_Thread = std::thread(&ShaderWatcher::inotifyLoop, this);
+#else
+		for (WatchedFile& file : m_Files)
+			file.modified = modificationTime(file.path);
+		m_Thread = std::thread(&ShaderWatcher::pollLoop, this);
+#endif
+	}
+
+	void Stop()
+	{
+		if (!m_Thread.joinable())
+			return;
+		m_Quit = true;
+		m_Thread.join();
+#ifdef __linux__
+		close(m_Inotify);
+		m_Inotify = -1;
+		m_Watches.clear();
+#endif
+	}
+
+	// once per frame on the GL thread: start reloads for changed files and finish the ones the driver is done with
+	// ------------------------------------------------------------------------
+	void Update()
+	{
+		std::vector<Change> changes;
+		{
+			std::lock_guard<std::mutex> lock(m_ChangesMutex);
+			changes.swap(m_Changes);
+		}
+		for (const Change& change : changes)
+		{
+			for (WatchedShader& watched : m_Shaders)
+			{
+				const std::vector<std::string>& dependencies = watched.shader->GetDependencies();
+				if (std::find(dependencies.begin(), dependencies.end(), change.path) == dependencies.end())
+					continue;
+				// a save during a pending reload restarts it with the newer source, the latency counts from the first event
+				if (!watched.pending)
+					watched.detected = change.detected;
+				// a source that can't be read starts nothing, but a build started by an earlier event still needs polling
+				bool started = watched.shader->BeginReload();
+				watched.pending = started || watched.shader->IsBuildPending();
+				if (started)
+					watchNewDependencies(*watched.shader);
+			}
+		}
+
+		for (WatchedShader& watched : m_Shaders)
+		{
+			if (!watched.pending)
+				continue;
+			ShaderBuildStatus status = watched.shader->PollBuild();
+			if (status == SHADER_BUILD_PENDING)
+				continue;
+			watched.pending = false;
+			double latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - watched.detected).count();
+			if (status == SHADER_BUILD_DONE)
+			{
+				m_ReloadCount++;
+				std::cout << "Reloaded " << watched.shader->GetVertexPath() << " + " << watched.shader->GetFragmentPath()
+					<< std::fixed << std::setprecision(2) << ": " << latencyMs << " ms from file change to swap ("
+					<< watched.shader->GetBuildMs() << " ms compile and link)" << std::endl;
+				std::cout.unsetf(std::ios::floatfield);
+				std::cout << std::setprecision(6);
+			}
+			else
+			{
+				m_FailureCount++;
+				std::cout << "ERROR::SHADER_WATCHER::RELOAD_FAILED: " << watched.shader->GetVertexPath() << " + "
+					<< watched.shader->GetFragmentPath() << ", keeping the previous program" << std::endl;
+			}
+		}
+	}
+
+	int GetReloadCount() const { return m_ReloadCount; }
+	int GetFailureCount() const { return m_FailureCount; }
+
+private:
+	struct WatchedShader
+	{
+		Shader* shader;
+		std::chrono::steady_clock::time_point detected;  // first file event of the pending reload
+		bool pending;
+	};
+
+	struct WatchedFile
+	{
+		std::string path;
+		std::string directory;
+		std::string name;
+		std::filesystem::file_time_type modified;
+	};
+
+	struct WatchedDirectory
+	{
+		int watch;
+		std::string directory;
+	};
+
+	struct Change
+	{
+		std::string path;
+		std::chrono::steady_clock::time_point detected;
+	};
+
+	void addFile(const std::string& path)
+	{
+		for (const WatchedFile& file : m_Files)
+			if (file.path == path)
+				return;
+		std::filesystem::path filePath(path);
+		std::string directory = filePath.parent_path().string();
+		m_Files.push_back(WatchedFile{ path, directory.empty() ? "." : directory, filePath.filename().string(), {} });
+	}
+
+	// an edit added an #include: restart the thread with the new file among the watched ones
+	void watchNewDependencies(const Shader& shader)
+	{
+		size_t watched = m_Files.size();
+		bool running = m_Thread.joinable();
+		for (const std::string& path : shader.GetDependencies())
+		{
+			bool known = std::any_of(m_Files.begin(), m_Files.end(), [&path](const WatchedFile& file) { return file.path == path; });
+			if (known)
+				continue;
+			if (running && m_Files.size() == watched)
+				Stop();
+			addFile(path);
+		}
+		if (running && m_Files.size() != watched)
+			Start();
+	}
+
+	std::vector<std::string> directories() const
+	{
+		std::vector<std::string> result;
+		for (const WatchedFile& file : m_Files)
+			if (std::find(result.begin(), result.end(), file.directory) == result.end())
+				result.push_back(file.directory);
+		return result;
+	}
+
+	// editors save in bursts (truncate + write, or write a temp file and rename it), one queued change per file
+	void queueChange(const std::string& path)
+	{
+		std::lock_guard<std::mutex> lock(m_ChangesMutex);
+		for (const Change& change : m_Changes)
+			if (change.path == path)
+				return;
+		m_Changes.push_back(Change{ path, std::chrono::steady_clock::now() });
+	}
+
+#ifdef __linux__
+	void inotifyLoop()
+	{
+		alignas(struct inotify_event) char buffer[4096];
+		pollfd descriptor = { m_Inotify, POLLIN, 0 };
+		while (!m_Quit)
+		{
+			if (poll(&descriptor, 1, WAKE_UP_MS) <= 0)
+				continue;
+			ssize_t length;
+			while ((length = read(m_Inotify, buffer, sizeof(buffer))) > 0)
+			{
+				for (char* next = buffer; next < buffer + length; )
+				{
+					const inotify_event* event = (const inotify_event*)next;
+					next += sizeof(inotify_event) + event->len;
+					if (event->len == 0)
+						continue;
+					for (const WatchedDirectory& watched : m_Watches)
+					{
+						if (watched.watch != event->wd)
+							continue;
+						for (const WatchedFile& file : m_Files)
+							if (file.directory == watched.directory && file.name == event->name)
+								queueChange(file.path);
+					}
+				}
+			}
+		}
+	}
+#else
+	static std::filesystem::file_time_type modificationTime(const std::string& path)
+	{
+		std::error_code error;
+		std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+		return error ? std::filesystem::file_time_type() : time;
+	}
+
+	void pollLoop()
+	{
+		while (!m_Quit)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(WAKE_UP_MS));
+			for (WatchedFile& file : m_Files)
+			{
+				std::filesystem::file_time_type modified = modificationTime(file.path);
+				if (modified != file.modified)
+				{
+					file.modified = modified;
+					queueChange(file.path);
+				}
+			}
+		}
+	}
+#endif
+
+private:
+	std::vector<WatchedShader> m_Shaders;  // GL thread only
+	std::vector<WatchedFile> m_Files;      // fixed while the thread runs
+	std::thread m_Thread;
+	std::atomic<bool> m_Quit{ false };
+
+	std::mutex m_ChangesMutex;
+	std::vector<Change> m_Changes;         // written by the watcher thread, taken by Update()
+
+#ifdef __linux__
+	int m_Inotify = -1;
+	std::vector<WatchedDirectory> m_Watches;
+#endif
+
+	int m_ReloadCount = 0;
+	int m_FailureCount = 0;
+};
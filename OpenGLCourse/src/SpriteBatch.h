@@ -0,0 +1,321 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "GLStateCache.h"
+#include "Shader.h"
+#include "StreamBuffer.h"
+
+// order in which End() draws the queued sprites
+enum SpriteSortMode
+{
+	SPRITE_SORT_DEFERRED,  // submission order (painter's order for overlapping, blended sprites)
+	SPRITE_SORT_TEXTURE    // grouped by shader and texture, fewest draw calls when the order doesn't matter
+};
+
+// counters of the last End()
+struct SpriteBatchStats
+{
+	int sprites = 0;
+	int drawCalls = 0;
+	int textureBinds = 0;
+	size_t uploadedBytes = 0;
+};
+
+// Batched 2D sprite renderer: Draw() only queues a quad, End() writes the vertices of up to MAX_SPRITES_PER_DRAW
+// sprites straight into a StreamBuffer ring and issues one draw call per run of sprites that shares a shader
+// and fits into the MAX_TEXTURE_SLOTS samplers of fshader_sprite.glsl. Coordinates are pixels, origin top left.
+// Custom shaders passed to Draw() must use the vertex layout and the u_ScreenSize/u_Textures uniforms of the
+// sprite shaders.
+class SpriteBatch
+{
+public:
+	static const int MAX_TEXTURE_SLOTS = 16;                      // GL_MAX_TEXTURE_IMAGE_UNITS is at least 16 in GL 3.3
+	static const int MAX_SPRITES_PER_DRAW = 16384;                // 4 vertices each, the last index still fits an unsigned short
+	static const int FRAME_SPRITES = 2 * MAX_SPRITES_PER_DRAW;    // stream buffer space per frame, three frames stay in flight
+
+	// must be created with a current GL context, the shader is the default for Draw() calls without one
+	SpriteBatch(const Shader& shader, float screenWidth, float screenHeight)
+		: m_DefaultShader(&shader), m_ScreenWidth(screenWidth), m_ScreenHeight(screenHeight), m_Stream(FRAME_SPRITES * 4 * sizeof(SpriteVertex))
+	{
+		// same VAO/VBO/EBO setup as the quad in main.cpp, but the vertices come from the stream buffer
+		glGenVertexArrays(1, &m_VAO);
+		glGenBuffers(1, &m_EBO);
+		GLStateCache& state = GLStateCache::Get();
+		state.BindVertexArray(m_VAO);
+
+		glBindBuffer(GL_ARRAY_BUFFER, m_Stream.GetBuffer());
+
+		// every quad uses the same index pattern, only the base vertex of the draw changes
+		std::vector<unsigned short> indices(MAX_SPRITES_PER_DRAW * 6);
+		for (int i = 0; i < MAX_SPRITES_PER_DRAW; i++)
+		{
+			unsigned short first = (unsigned short)(i * 4);
+			unsigned short quad[6] = { first, (unsigned short)(first + 1), (unsigned short)(first + 2),
+				(unsigned short)(first + 2), (unsigned short)(first + 3), first };
+			std::copy(quad, quad + 6, indices.begin() + i * 6);
+		}
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned short), indices.data(), GL_STATIC_DRAW);
+
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, x));
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, u));
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, color));
+		glEnableVertexAttribArray(2);
+		glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, slot));
+		glEnableVertexAttribArray(3);
+		state.BindVertexArray(0);
+	}
+
+	~SpriteBatch()
+	{
+		glDeleteVertexArrays(1, &m_VAO);
+		GLStateCache::Get().ForgetVertexArray(m_VAO);
+		glDeleteBuffers(1, &m_EBO);
+	}
+
+	SpriteBatch(const SpriteBatch&) = delete;
+	SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+	void SetScreenSize(float width, float height)
+	{
+		m_ScreenWidth = width;
+		m_ScreenHeight = height;
+	}
+
+	// start queueing sprites for End()
+	// ------------------------------------------------------------------------
+	void Begin(SpriteSortMode sortMode = SPRITE_SORT_DEFERRED)
+	{
+		m_SortMode = sortMode;
+		m_Sprites.clear();
+	}
+
+	// queue a textured quad; uv holds the texture coordinates of the top left (x, y) and bottom right (z, w) corner,
+	// the default fits textures loaded with a vertical flip (TextureManager::Load)
+	// ------------------------------------------------------------------------
+	void Draw(unsigned int texture, float x, float y, float width, float height,
+		const vector4& color = { 1.0f, 1.0f, 1.0f, 1.0f }, const vector4& uv = { 0.0f, 1.0f, 1.0f, 0.0f }, const Shader* shader = NULL)
+	{
+		QueuedSprite sprite;
+		sprite.x = x;
+		sprite.y = y;
+		sprite.width = width;
+		sprite.height = height;
+		sprite.uv = uv;
+		sprite.color = packColor(color);
+		sprite.texture = texture;
+		sprite.shader = shaderIndex(shader ? shader : m_DefaultShader);
+		m_Sprites.push_back(sprite);
+	}
+
+	// draw everything queued since Begin() with alpha blending
+	// ------------------------------------------------------------------------
+	void End()
+	{
+		m_Stats = SpriteBatchStats();
+		m_Stats.sprites = (int)m_Sprites.size();
+		if (m_Sprites.empty())
+			return;
+
+		if (m_SortMode == SPRITE_SORT_TEXTURE)
+		{
+			// shader in the top byte, texture name below, the sequence number keeps the sort stable
+			m_SortKeys.resize(m_Sprites.size());
+			for (size_t i = 0; i < m_Sprites.size(); i++)
+				m_SortKeys[i] = ((uint64_t)m_Sprites[i].shader << 56) | ((uint64_t)(m_Sprites[i].texture & 0xFFFFFF) << 32) | (uint32_t)i;
+			std::sort(m_SortKeys.begin(), m_SortKeys.end());
+		}
+
+		GLStateCache& state = GLStateCache::Get();
+		state.BindVertexArray(m_VAO);
+		state.SetBlend(true);
+		state.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		m_BoundShader = -1;
+		std::fill(m_BoundTextures, m_BoundTextures + MAX_TEXTURE_SLOTS, 0u);
+
+		for (size_t next = 0; next < m_Sprites.size(); )
+		{
+			int count = (int)std::min<size_t>(m_Sprites.size() - next, MAX_SPRITES_PER_DRAW);
+			if (!writeChunk(next, count))
+				break;
+			for (const DrawCommand& command : m_Commands)
+				submit(command);
+			m_Stream.Fence(); // this range can be reused once these draws are done
+			next += count;
+		}
+
+		state.SetBlend(false);
+		m_Sprites.clear();
+	}
+
+	const SpriteBatchStats& GetStats() const { return m_Stats; }
+	const StreamBufferStats& GetStreamStats() const { return m_Stream.GetStats(); }
+	bool IsStreamPersistent() const { return m_Stream.IsPersistent(); }
+
+private:
+	struct QueuedSprite
+	{
+		float x, y, width, height;
+		vector4 uv;
+		uint32_t color;
+		unsigned int texture;
+		int shader;              // index into m_Shaders
+	};
+
+	struct SpriteVertex
+	{
+		float x, y;
+		float u, v;
+		uint32_t color;          // RGBA8
+		uint32_t slot;           // sampler of u_Textures
+	};
+
+	struct ShaderEntry
+	{
+		const Shader* shader;
+		UniformHandle screenSize, textures;
+	};
+
+	// one glDrawElementsBaseVertex: a run of sprites in the stream buffer with its shader and texture slots
+	struct DrawCommand
+	{
+		int shader;
+		int firstVertex;         // in the stream buffer
+		int count;
+		int textureCount;
+		unsigned int textures[MAX_TEXTURE_SLOTS];
+	};
+
+	static uint32_t packColor(const vector4& color)
+	{
+		auto channel = [](float value) { return (uint32_t)(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f); };
+		return channel(color.x) | channel(color.y) << 8 | channel(color.z) << 16 | channel(color.w) << 24;
+	}
+
+	int shaderIndex(const Shader* shader)
+	{
+		if (!m_Shaders.empty() && m_Shaders[m_LastShader].shader == shader)
+			return m_LastShader;
+		for (size_t i = 0; i < m_Shaders.size(); i++)
+		{
+			if (m_Shaders[i].shader == shader)
+				return m_LastShader = (int)i;
+		}
+		m_Shaders.push_back(ShaderEntry{ shader, shader->GetUniform("u_ScreenSize"), shader->GetUniform("u_Textures") });
+		return m_LastShader = (int)m_Shaders.size() - 1;
+	}
+
+	// allocate the next count sprites in the stream buffer, fill in their vertices and split them into draw commands
+	// ------------------------------------------------------------------------
+	bool writeChunk(size_t first, int count)
+	{
+		StreamAllocation allocation = m_Stream.Map(count * 4 * sizeof(SpriteVertex), sizeof(SpriteVertex));
+		if (!allocation.data)
+			return false;
+		SpriteVertex* vertices = (SpriteVertex*)allocation.data;
+		int firstVertex = (int)(allocation.offset / sizeof(SpriteVertex));
+
+		m_Commands.clear();
+		DrawCommand* command = NULL;
+		unsigned int lastTexture = 0;
+		uint32_t lastSlot = 0;
+		for (int i = 0; i < count; i++)
+		{
+			size_t index = m_SortMode == SPRITE_SORT_TEXTURE ? (uint32_t)m_SortKeys[first + i] : first + i;
+			const QueuedSprite& sprite = m_Sprites[index];
+
+			if (!command || command->shader != sprite.shader)
+			{
+				command = newCommand(sprite.shader, firstVertex + i * 4);
+				lastTexture = 0;
+			}
+			if (command->textureCount == 0 || sprite.texture != lastTexture)
+			{
+				int slot = 0;
+				while (slot < command->textureCount && command->textures[slot] != sprite.texture)
+					slot++;
+				if (slot == MAX_TEXTURE_SLOTS)
+				{
+					// every sampler is taken, continue with a new draw call
+					command = newCommand(sprite.shader, firstVertex + i * 4);
+					slot = 0;
+				}
+				if (slot == command->textureCount)
+					command->textures[command->textureCount++] = sprite.texture;
+				lastTexture = sprite.texture;
+				lastSlot = (uint32_t)slot;
+			}
+			command->count++;
+
+			SpriteVertex* quad = vertices + i * 4;
+			float x1 = sprite.x + sprite.width, y1 = sprite.y + sprite.height;
+			quad[0] = SpriteVertex{ sprite.x, sprite.y, sprite.uv.x, sprite.uv.y, sprite.color, lastSlot };  // top left
+			quad[1] = SpriteVertex{ x1, sprite.y, sprite.uv.z, sprite.uv.y, sprite.color, lastSlot };        // top right
+			quad[2] = SpriteVertex{ x1, y1, sprite.uv.z, sprite.uv.w, sprite.color, lastSlot };              // bottom right
+			quad[3] = SpriteVertex{ sprite.x, y1, sprite.uv.x, sprite.uv.w, sprite.color, lastSlot };        // bottom left
+		}
+
+		m_Stream.Unmap();
+		m_Stats.uploadedBytes += count * 4 * sizeof(SpriteVertex);
+		return true;
+	}
+
+	DrawCommand* newCommand(int shader, int firstVertex)
+	{
+		DrawCommand command;
+		command.shader = shader;
+		command.firstVertex = firstVertex;
+		command.count = 0;
+		command.textureCount = 0;
+		m_Commands.push_back(command);
+		return &m_Commands.back();
+	}
+
+	// bind what changed since the previous command and draw it
+	// ------------------------------------------------------------------------
+	void submit(const DrawCommand& command)
+	{
+		if (command.shader != m_BoundShader)
+		{
+			const ShaderEntry& entry = m_Shaders[command.shader];
+			static const int units[MAX_TEXTURE_SLOTS] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+			entry.shader->Bind();
+			entry.shader->Set(entry.screenSize, m_ScreenWidth, m_ScreenHeight);
+			entry.shader->Set(entry.textures, units, MAX_TEXTURE_SLOTS);
+			m_BoundShader = command.shader;
+		}
+		for (int slot = 0; slot < command.textureCount; slot++)
+		{
+			if (m_BoundTextures[slot] == command.textures[slot])
+				continue;
+			GLStateCache::Get().BindTexture(slot, command.textures[slot]);
+			m_BoundTextures[slot] = command.textures[slot];
+			m_Stats.textureBinds++;
+		}
+		glDrawElementsBaseVertex(GL_TRIANGLES, command.count * 6, GL_UNSIGNED_SHORT, NULL, command.firstVertex);
+		m_Stats.drawCalls++;
+	}
+
+private:
+	const Shader* m_DefaultShader;
+	float m_ScreenWidth, m_ScreenHeight;
+	unsigned int m_VAO = 0, m_EBO = 0;
+	StreamBuffer m_Stream;                   // vertices, written directly by End()
+
+	SpriteSortMode m_SortMode = SPRITE_SORT_DEFERRED;
+	std::vector<QueuedSprite> m_Sprites;     // queued since Begin()
+	std::vector<uint64_t> m_SortKeys;        // SPRITE_SORT_TEXTURE: sort key with the sprite index in the low 32 bits
+	std::vector<ShaderEntry> m_Shaders;      // every shader seen by Draw(), indexed by QueuedSprite::shader
+	int m_LastShader = 0;
+	std::vector<DrawCommand> m_Commands;     // draw calls of the chunk being written
+
+	int m_BoundShader = -1;
+	unsigned int m_BoundTextures[MAX_TEXTURE_SLOTS] = {};
+	SpriteBatchStats m_Stats;
+};
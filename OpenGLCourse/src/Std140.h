@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// C++ mirrors of GLSL uniform block members in std140 layout. Their alignas/size equal the std140 base alignment
+// and size, so a struct made of them (in the order of the GLSL block) has the same byte layout as the block and
+// can be uploaded with a single glBufferSubData. Std140Layout computes the std140 offsets at compile time and
+// STD140_MEMBER static_asserts that the compiler placed every member there.
+// There is no vec3: std140 lets a following scalar use its fourth component, a C++ type can't express that,
+// declare a Std140Vec4 (or a vec3 + float pair as two floats in a Std140Vec4) instead.
+
+struct alignas(8) Std140Vec2
+{
+	float x, y;
+};
+
+struct alignas(16) Std140Vec4
+{
+	float x, y, z, w;
+};
+
+struct alignas(16) Std140IVec4
+{
+	int32_t x, y, z, w;
+};
+
+// column major like GLSL, columns[c][r]
+struct alignas(16) Std140Mat4
+{
+	float columns[4][4];
+};
+
+// arrays round every element up to 16 bytes
+template <typename T, int N>
+struct alignas(16) Std140Array
+{
+	struct alignas(16) Element
+	{
+		T value;
+	};
+	Element elements[N];
+
+	T& operator[](int i) { return elements[i].value; }
+	const T& operator[](int i) const { return elements[i].value; }
+};
+
+// std140 base alignment and size of each member type
+template <typename T> struct Std140Traits;
+template <> struct Std140Traits<float> { static constexpr size_t alignment = 4, size = 4; };
+template <> struct Std140Traits<int32_t> { static constexpr size_t alignment = 4, size = 4; };
+template <> struct Std140Traits<uint32_t> { static constexpr size_t alignment = 4, size = 4; };
+template <> struct Std140Traits<Std140Vec2> { static constexpr size_t alignment = 8, size = 8; };
+template <> struct Std140Traits<Std140Vec4> { static constexpr size_t alignment = 16, size = 16; };
+template <> struct Std140Traits<Std140IVec4> { static constexpr size_t alignment = 16, size = 16; };
+template <> struct Std140Traits<Std140Mat4> { static constexpr size_t alignment = 16, size = 64; };
+template <typename T, int N> struct Std140Traits<Std140Array<T, N>>
+{
+	static constexpr size_t alignment = 16;
+	static constexpr size_t size = N * ((Std140Traits<T>::size + 15) / 16 * 16);
+};
+
+// offsets of a block declared with these member types in this order
+template <typename... Members>
+struct Std140Layout
+{
+	static constexpr size_t COUNT = sizeof...(Members);
+
+	static constexpr size_t Offset(size_t member)
+	{
+		const size_t alignments[] = { Std140Traits<Members>::alignment... };
+		const size_t sizes[] = { Std140Traits<Members>::size... };
+		size_t offset = 0;
+		for (size_t i = 0; i < COUNT; i++)
+		{
+			offset = (offset + alignments[i] - 1) / alignments[i] * alignments[i];
+			if (i == member)
+				return offset;
+			offset += sizes[i];
+		}
+		return offset;
+	}
+
+	// the block size: the end of the last member rounded up to a vec4, like GL_UNIFORM_BLOCK_DATA_SIZE reports it
+	static constexpr size_t Size()
+	{
+		const size_t sizes[] = { Std140Traits<Members>::size... };
+		return (Offset(COUNT - 1) + sizes[COUNT - 1] + 15) / 16 * 16;
+	}
+};
+
+// static_assert that member number index of Struct sits at its std140 offset
+#define STD140_MEMBER(Struct, Layout, index, member) \
+	static_assert(offsetof(Struct, member) == Layout::Offset(index), #Struct "::" #member " is not at its std140 offset")
+
+// static_assert that Struct covers the whole block (and doesn't add members the layout doesn't know)
+#define STD140_SIZE(Struct, Layout) \
+	static_assert(sizeof(Struct) == Layout::Size(), #Struct " does not have the std140 block size")
@@ -0,0 +1,235 @@
+#pragma once
+#include <glad/glad.h>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iostream>
+
+struct StreamBufferStats
+{
+	size_t bytesStreamed = 0;   // bytes handed out by Map()
+	int wraps = 0;              // times the write position went back to the start
+	int fencesWaited = 0;       // fences that were not signaled yet when their range was needed again
+	double fenceWaitMs = 0.0;   // time blocked in those waits
+};
+
+// one allocation of the stream buffer, write data and then draw from buffer offset 'offset'
+struct StreamAllocation
+{
+	void* data = NULL;          // NULL when the allocation failed
+	size_t offset = 0;
+};
+
+// Ring allocator for dynamic vertex/index/uniform data, by default three frames worth of space. Every Map() hands out
+// the next free range; Fence() marks everything handed out so far as in use by the commands submitted so far, and a
+// range is only written again after its fence signaled, so the GPU never reads data that is being overwritten and
+// the driver never has to synchronize implicitly.
+// With GL 4.4 (glBufferStorage) the buffer is mapped once, persistent and coherent; on 3.3 contexts every Map() maps
+// its range with GL_MAP_UNSYNCHRONIZED_BIT (the fences do the synchronization) and Unmap() has to be called before
+// drawing from it.
+class StreamBuffer
+{
+public:
+	// must be created with a current GL context
+	StreamBuffer(size_t frameSize, int frames = 3) : m_Capacity(frameSize * frames)
+	{
+		glGenBuffers(1, &m_Buffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer); // not a binding point of the VAO, nothing else is disturbed
+		m_Persistent = GLAD_GL_VERSION_4_4 != 0;
+		if (m_Persistent)
+		{
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_COPY_WRITE_BUFFER, m_Capacity, NULL, flags);
+			m_Mapped = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, m_Capacity, flags);
+			if (!m_Mapped)
+			{
+				// immutable storage can't be respecified, start over with a mutable buffer
+				std::cout << "ERROR::STREAM_BUFFER::PERSISTENT_MAPPING_FAILED, falling back to glMapBufferRange" << std::endl;
+				glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+				glDeleteBuffers(1, &m_Buffer);
+				glGenBuffers(1, &m_Buffer);
+				glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+				m_Persistent = false;
+			}
+		}
+		if (!m_Persistent)
+			glBufferData(GL_COPY_WRITE_BUFFER, m_Capacity, NULL, GL_STREAM_DRAW);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	}
+
+	~StreamBuffer()
+	{
+		for (const Range& range : m_InFlight)
+			glDeleteSync(range.fence);
+		glDeleteBuffers(1, &m_Buffer); // also unmaps
+	}
+
+	StreamBuffer(const StreamBuffer&) = delete;
+	StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+	// hand out size bytes at an offset that is a multiple of alignment (e.g. the vertex size, or
+	// GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT for glBindBufferRange), waiting for the GPU if the range is still in use
+	// ------------------------------------------------------------------------
+	StreamAllocation Map(size_t size, size_t alignment = 4)
+	{
+		StreamAllocation allocation;
+		if (size == 0 || size > m_Capacity)
+		{
+			std::cout << "ERROR::STREAM_BUFFER::ALLOCATION_TOO_LARGE: " << size << " of " << m_Capacity << " bytes" << std::endl;
+			return allocation;
+		}
+		Unmap();
+
+		size_t offset = (m_Head + alignment - 1) / alignment * alignment;
+		Range sweep = { NULL, m_Head, offset + size }; // passed over by the write position, including alignment padding
+		if (offset + size > m_Capacity)
+		{
+			// the tail end is too short, wrap around (offset 0 satisfies every alignment)
+			offset = 0;
+			sweep.end = size < m_Head ? size : m_Head; // past the old write position it is the whole ring
+			m_Stats.wraps++;
+		}
+		makeAvailable(sweep);
+		if (m_Stats.bytesStreamed == m_FencedBytes)
+			m_FenceStart = offset; // the next fenced range starts here, a skipped tail doesn't belong to it
+
+		if (m_Persistent)
+		{
+			allocation.data = m_Mapped + offset;
+		}
+		else
+		{
+			glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+			allocation.data = glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+			if (!allocation.data)
+			{
+				std::cout << "ERROR::STREAM_BUFFER::FAILED_TO_MAP_RANGE" << std::endl;
+				return allocation;
+			}
+			m_RangeMapped = true;
+		}
+		allocation.offset = offset;
+		m_Head = offset + size;
+		m_Stats.bytesStreamed += size;
+		return allocation;
+	}
+
+	// finish writing the last Map() (only does work on the glMapBufferRange fallback), call before drawing from it
+	// ------------------------------------------------------------------------
+	void Unmap()
+	{
+		if (!m_RangeMapped)
+			return;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+		if (!glUnmapBuffer(GL_COPY_WRITE_BUFFER))
+			std::cout << "ERROR::STREAM_BUFFER::CONTENTS_LOST" << std::endl;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		m_RangeMapped = false;
+	}
+
+	// everything handed out since the previous fence stays reserved until the commands submitted so far completed;
+	// call after the draws that read it (at the latest at the end of each frame)
+	// ------------------------------------------------------------------------
+	void Fence()
+	{
+		if (m_Stats.bytesStreamed == m_FencedBytes)
+			return;
+		Unmap();
+		m_InFlight.push_back(Range{ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_FenceStart, m_Head });
+		m_FenceStart = m_Head;
+		m_FencedBytes = m_Stats.bytesStreamed;
+	}
+
+	unsigned int GetBuffer() const { return m_Buffer; }
+	size_t GetCapacity() const { return m_Capacity; }
+	bool IsPersistent() const { return m_Persistent; }
+	const StreamBufferStats& GetStats() const { return m_Stats; }
+
+private:
+	// bytes [start, end) of the ring, end < start when the range wrapped around and end == start when it is the whole ring
+	struct Range
+	{
+		GLsync fence;
+		size_t start, end;
+	};
+
+	bool overlaps(const Range& a, const Range& b) const
+	{
+		if (a.start == a.end || b.start == b.end)
+			return true;
+		// split wrapped ranges into their two pieces
+		size_t pieces[2][4];
+		int counts[2];
+		const Range* ranges[2] = { &a, &b };
+		for (int i = 0; i < 2; i++)
+		{
+			const Range& range = *ranges[i];
+			if (range.start < range.end)
+			{
+				pieces[i][0] = range.start; pieces[i][1] = range.end;
+				counts[i] = 1;
+			}
+			else
+			{
+				pieces[i][0] = range.start; pieces[i][1] = m_Capacity;
+				pieces[i][2] = 0; pieces[i][3] = range.end;
+				counts[i] = 2;
+			}
+		}
+		for (int i = 0; i < counts[0]; i++)
+			for (int j = 0; j < counts[1]; j++)
+				if (pieces[0][i * 2] < pieces[1][j * 2 + 1] && pieces[1][j * 2] < pieces[0][i * 2 + 1])
+					return true;
+		return false;
+	}
+
+	// wait until no fenced range overlaps the part of the ring the write position sweeps over next
+	void makeAvailable(const Range& sweep)
+	{
+		// the unfenced range written since the last Fence() would be overwritten: fence it so it can be waited on
+		if (m_Stats.bytesStreamed != m_FencedBytes && overlaps(sweep, Range{ NULL, m_FenceStart, m_Head }))
+			Fence();
+
+		// the ranges follow each other through the ring starting right after the write position, oldest first,
+		// so the sweep is free once the oldest remaining range is out of its reach
+		while (!m_InFlight.empty() && overlaps(sweep, m_InFlight.front()))
+		{
+			wait(m_InFlight.front().fence);
+			glDeleteSync(m_InFlight.front().fence);
+			m_InFlight.pop_front();
+		}
+	}
+
+	void wait(GLsync fence)
+	{
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+			return;
+
+		auto start = std::chrono::steady_clock::now();
+		m_Stats.fencesWaited++;
+		GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT; // the fence may not have reached the GPU yet
+		do
+		{
+			result = glClientWaitSync(fence, flags, 1000000000); // 1 s, then ask again
+			flags = 0;
+		} while (result == GL_TIMEOUT_EXPIRED);
+		if (result == GL_WAIT_FAILED)
+			std::cout << "ERROR::STREAM_BUFFER::FENCE_WAIT_FAILED" << std::endl;
+		m_Stats.fenceWaitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+private:
+	unsigned int m_Buffer = 0;
+	size_t m_Capacity;
+	bool m_Persistent = false;
+	unsigned char* m_Mapped = NULL;  // whole buffer, persistent mode only
+	bool m_RangeMapped = false;      // fallback mode: a Map() range is still mapped
+
+	size_t m_Head = 0;               // end of the last allocation
+	size_t m_FenceStart = 0;         // start of the range not yet covered by a fence
+	size_t m_FencedBytes = 0;        // bytesStreamed at the last fence, to tell an empty range from a full ring
+	std::deque<Range> m_InFlight;    // fenced ranges, oldest first
+	StreamBufferStats m_Stats;
+};
@@ -0,0 +1,414 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CompressedTexture.h"
+#include "GLExtensions.h"
+#include "GLStateCache.h"
+#include "Util.h"
+#include "stb_image.h"
+
+// handle to a texture of the TextureManager, valid right after Load() and usable before the data is resident
+struct TextureHandle
+{
+	int index = -1;
+	bool IsValid() const { return index >= 0; }
+};
+
+struct TextureStats
+{
+	int requested = 0;          // Load() calls
+	int resident = 0;           // uploaded and bound instead of the placeholder
+	int failed = 0;             // decode errors (they keep showing the placeholder)
+	double decodeMs = 0.0;      // decode time summed over all workers
+	double uploadMs = 0.0;      // render thread time spent in uploads
+	double maxUpdateMs = 0.0;   // longest single Update(), the worst stall a frame saw
+	size_t uploadedBytes = 0;
+	int compressed = 0;         // of the resident ones uploaded block compressed from a .dds/.ktx2
+	size_t savedBytes = 0;      // texture memory those save against RGBA8 with the same mip levels
+};
+
+// Texture streaming: image files are decoded by a pool of worker threads and uploaded on the render thread
+// through a pixel buffer object, at most uploadBudgetMs per frame. Until its data is resident a handle binds
+// a small placeholder texture, so the render loop never waits for the disk or the decoder.
+// Block compressed textures (.dds, .ktx2, see CompressedTexture) skip the decode: the workers only read the file
+// and its mip levels go to glCompressedTexImage2D as stored. When a source image has a container next to it with
+// the same name (container.jpg -> container.ktx2 or container.dds, as written by --compress-textures) that one is
+// loaded instead, unless the driver lacks its format; then the source image is decoded as before.
+class TextureManager
+{
+public:
+	// workerCount 0 uses every core but one (at least one worker); must be created with a current GL context
+	TextureManager(int workerCount = 0, double uploadBudgetMs = 2.0) : m_UploadBudgetMs(uploadBudgetMs)
+	{
+		createPlaceholder();
+		glGenBuffers(1, &m_PBO);
+
+		glGetIntegerv(GL_MAX_TEXTURE_SIZE, &m_MaxTextureSize);
+
+		// S3TC is an extension everywhere, RGTC is core since 3.0 and BPTC since 4.2
+		m_FormatSupported[TEXTURE_BC1] = m_FormatSupported[TEXTURE_BC2] = m_FormatSupported[TEXTURE_BC3] = GLAD_GL_EXT_texture_compression_s3tc != 0;
+		m_FormatSupported[TEXTURE_BC4] = m_FormatSupported[TEXTURE_BC5] = GLAD_GL_VERSION_3_0 != 0;
+		m_FormatSupported[TEXTURE_BC6H] = m_FormatSupported[TEXTURE_BC7] = GLAD_GL_VERSION_4_2 || GLAD_GL_ARB_texture_compression_bptc;
+
+		int cores = std::max(1, (int)std::thread::hardware_concurrency());
+		if (workerCount <= 0)
+			workerCount = std::max(1, cores - 1);
+		// the workers already decode in parallel: split the cores between them instead of letting every large JPEG
+		// start a thread per core on top (about cores^2 threads)
+		int jpegThreads = std::max(1, cores / workerCount);
+		for (int i = 0; i < workerCount; i++)
+			m_Workers.emplace_back(&TextureManager::workerLoop, this, jpegThreads);
+	}
+
+	~TextureManager()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Quit = true;
+		}
+		m_JobReady.notify_all();
+		for (std::thread& worker : m_Workers)
+			worker.join();
+		for (Decoded& decoded : m_Decoded)
+			stbi_image_free(decoded.pixels);
+
+		for (const Entry& entry : m_Entries)
+			if (entry.texture)
+			{
+				glDeleteTextures(1, &entry.texture);
+				GLStateCache::Get().ForgetTexture(entry.texture);
+			}
+		glDeleteTextures(1, &m_Placeholder);
+		GLStateCache::Get().ForgetTexture(m_Placeholder);
+		glDeleteBuffers(1, &m_PBO);
+	}
+
+	TextureManager(const TextureManager&) = delete;
+	TextureManager& operator=(const TextureManager&) = delete;
+
+	// queue an image file for decoding, every call creates a new texture. Block compressed data can't be flipped:
+	// .dds/.ktx2 files load as stored whatever flipVertically says, and since --compress-textures writes them
+	// flipped, a compressed container next to a source image only replaces it for flipped loads
+	// ------------------------------------------------------------------------
+	TextureHandle Load(const std::string& path, bool flipVertically = true)
+	{
+		TextureHandle handle{ (int)m_Entries.size() };
+		m_Entries.push_back(Entry{ path });
+		m_Stats.requested++;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Jobs.push_back(Job{ handle.index, path, flipVertically, m_UseCompressed && flipVertically });
+			m_Pending++;
+		}
+		m_JobReady.notify_one();
+		return handle;
+	}
+
+	// call once per frame on the render thread: uploads decoded images until the frame budget is used up
+	// ------------------------------------------------------------------------
+	void Update()
+	{
+		double start = NowMs();
+		uploadDecoded(m_UploadBudgetMs);
+		m_Stats.maxUpdateMs = std::max(m_Stats.maxUpdateMs, NowMs() - start);
+	}
+
+	// block until every queued texture is resident (or failed), ignoring the frame budget
+	// ------------------------------------------------------------------------
+	void WaitAll()
+	{
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_ResultReady.wait(lock, [this] { return !m_Decoded.empty() || m_Pending == 0; });
+				if (m_Decoded.empty() && m_Pending == 0)
+					return;
+			}
+			uploadDecoded(-1.0);
+		}
+	}
+
+	// bind the texture, or the placeholder while it is still loading
+	// ------------------------------------------------------------------------
+	void Bind(TextureHandle handle, int unit) const
+	{
+		GLStateCache::Get().BindTexture(unit, GetTexture(handle));
+	}
+
+	unsigned int GetTexture(TextureHandle handle) const
+	{
+		unsigned int texture = handle.IsValid() ? m_Entries[handle.index].texture : 0;
+		return texture ? texture : m_Placeholder;
+	}
+
+	bool IsResident(TextureHandle handle) const { return handle.IsValid() && m_Entries[handle.index].texture != 0; }
+
+	const TextureStats& GetStats() const { return m_Stats; }
+
+	// whether Load() picks up compressed containers next to source images (on by default)
+	void SetUseCompressed(bool useCompressed) { m_UseCompressed = useCompressed; }
+
+	bool IsFormatSupported(TextureBlockFormat format) const { return m_FormatSupported[format]; }
+
+	void PrintStats() const
+	{
+		std::cout << "Textures: " << m_Stats.resident << "/" << m_Stats.requested << " resident, " << m_Stats.failed << " failed, "
+			<< m_Stats.uploadedBytes / 1024 << " KiB uploaded, decode " << m_Stats.decodeMs << " ms (all workers), upload "
+			<< m_Stats.uploadMs << " ms, longest Update() " << m_Stats.maxUpdateMs << " ms" << std::endl;
+		if (m_Stats.compressed > 0)
+			std::cout << "  " << m_Stats.compressed << " block compressed, " << m_Stats.savedBytes / 1024 << " KiB less texture memory than as RGBA8" << std::endl;
+	}
+
+private:
+	struct Entry
+	{
+		std::string path;
+		unsigned int texture = 0; // 0 until resident
+	};
+
+	struct Job
+	{
+		int index;
+		std::string path;
+		bool flip;
+		bool useCompressed;    // look for a .ktx2/.dds next to a source image
+	};
+
+	struct Decoded
+	{
+		int index;
+		unsigned char* pixels; // NULL when decoding failed
+		int width, height, channels;
+		double decodeMs;
+		std::string error;
+		CompressedImage compressed; // levels empty unless a container was loaded instead
+		std::string fallback;       // why a container next to the source image was not used
+	};
+
+	// grey checkerboard shown in place of textures that are not resident yet
+	void createPlaceholder()
+	{
+		const unsigned char pixels[] = { 96, 96, 96, 255,  160, 160, 160, 255,  160, 160, 160, 255,  96, 96, 96, 255 };
+		glGenTextures(1, &m_Placeholder);
+		GLStateCache::Get().BindTexture(0, m_Placeholder);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	}
+
+	// worker thread: decode queued files, the GL context is never touched here
+	// ------------------------------------------------------------------------
+	void workerLoop(int jpegThreads)
+	{
+		stbi_set_jpeg_threads_thread(jpegThreads);
+		for (;;)
+		{
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_JobReady.wait(lock, [this] { return m_Quit || !m_Jobs.empty(); });
+				if (m_Quit)
+					return;
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+			}
+
+			double start = NowMs();
+			Decoded decoded{ job.index, NULL, 0, 0, 0, 0.0, std::string(), CompressedImage(), std::string() };
+			if (!loadCompressed(job, decoded))
+			{
+				stbi_set_flip_vertically_on_load_thread(job.flip); // the global flag would race between workers
+				decoded.pixels = stbi_load(job.path.c_str(), &decoded.width, &decoded.height, &decoded.channels, 0);
+				if (!decoded.pixels)
+					decoded.error = stbi_failure_reason() ? stbi_failure_reason() : "unknown error";
+			}
+			decoded.decodeMs = NowMs() - start;
+
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Decoded.push_back(std::move(decoded));
+			}
+			m_ResultReady.notify_all();
+		}
+	}
+
+	// worker thread: read the job's container, or the one next to its source image; false when the source image
+	// is to be decoded instead
+	bool loadCompressed(const Job& job, Decoded& decoded) const
+	{
+		bool container = CompressedTexture::IsContainerPath(job.path);
+		std::string path = job.path;
+		if (!container)
+		{
+			if (!job.useCompressed)
+				return false;
+			std::error_code error;
+			std::filesystem::path ktx2 = std::filesystem::path(job.path).replace_extension(".ktx2");
+			std::filesystem::path dds = std::filesystem::path(job.path).replace_extension(".dds");
+			if (std::filesystem::exists(ktx2, error))
+				path = ktx2.string();
+			else if (std::filesystem::exists(dds, error))
+				path = dds.string();
+			else
+				return false;
+		}
+
+		std::string error;
+		if (CompressedTexture::Load(path, decoded.compressed, error))
+		{
+			if (!m_FormatSupported[decoded.compressed.format])
+				error = std::string(CompressedTexture::FormatName(decoded.compressed.format)) + " is not supported by the driver";
+			else if (std::max(decoded.compressed.width, decoded.compressed.height) > m_MaxTextureSize)
+				error = "larger than GL_MAX_TEXTURE_SIZE " + std::to_string(m_MaxTextureSize);
+			else
+				return true;
+		}
+		decoded.compressed = CompressedImage();
+		if (container)
+			decoded.error = error;  // nothing to fall back to
+		else
+			decoded.fallback = path + " (" + error + ")";
+		return container;
+	}
+
+	// render thread: upload finished decodes, at least one per call so loading always progresses (budget < 0: all)
+	// ------------------------------------------------------------------------
+	void uploadDecoded(double budgetMs)
+	{
+		double start = NowMs();
+		for (;;)
+		{
+			Decoded decoded;
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				if (m_Decoded.empty())
+					break;
+				decoded = std::move(m_Decoded.front());
+				m_Decoded.pop_front();
+				m_Pending--;
+			}
+			m_Stats.decodeMs += decoded.decodeMs;
+			if (!decoded.fallback.empty())
+				std::cout << "ERROR::TEXTURE::COMPRESSED_TEXTURE_NOT_USED: " << decoded.fallback << ", decoded " << m_Entries[decoded.index].path << " instead" << std::endl;
+
+			if (decoded.pixels || !decoded.compressed.levels.empty())
+			{
+				double uploadStart = NowMs();
+				if (decoded.pixels)
+					upload(m_Entries[decoded.index], decoded);
+				else
+					uploadCompressed(m_Entries[decoded.index], decoded.compressed);
+				stbi_image_free(decoded.pixels);
+				m_Stats.uploadMs += NowMs() - uploadStart;
+			}
+			else
+			{
+				m_Stats.failed++;
+				std::cout << "ERROR::TEXTURE::FAILED_TO_LOAD_TEXTURE: " << m_Entries[decoded.index].path << " (" << decoded.error << ")" << std::endl;
+			}
+
+			if (budgetMs >= 0.0 && NowMs() - start >= budgetMs)
+				break;
+		}
+	}
+
+	// copy the data into the (orphaned) PBO and let the driver pull it from there asynchronously; returns what to
+	// pass as the pixel pointer, with the PBO still bound unless mapping failed
+	const void* stage(const void* data, size_t size)
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PBO);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW); // orphan, the previous upload may still be reading
+		void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if (!mapped)
+		{
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // mapping failed, upload straight from client memory
+			return data;
+		}
+		std::memcpy(mapped, data, size);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		return NULL; // offset 0 into the PBO
+	}
+
+	void createTexture(Entry& entry, bool mipmapped)
+	{
+		glGenTextures(1, &entry.texture);
+		GLStateCache::Get().BindTexture(0, entry.texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	}
+
+	void upload(Entry& entry, const Decoded& decoded)
+	{
+		static const GLenum formats[] = { GL_RED, GL_RED, GL_RG, GL_RGB, GL_RGBA };
+		GLenum format = formats[decoded.channels];
+		size_t size = (size_t)decoded.width * decoded.height * decoded.channels;
+
+		createTexture(entry, true); // mipmaps generated below
+		const void* source = stage(decoded.pixels, size);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // rows of RGB images are not 4 byte aligned in general
+		glTexImage2D(GL_TEXTURE_2D, 0, format, decoded.width, decoded.height, 0, format, GL_UNSIGNED_BYTE, source);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glGenerateMipmap(GL_TEXTURE_2D);
+
+		m_Stats.resident++;
+		m_Stats.uploadedBytes += size;
+	}
+
+	// the stored mip levels as they are; the GL can't generate mipmaps of compressed formats, a container without
+	// them is sampled from level 0 only. sRGB containers are sampled as linear like every other texture here.
+	void uploadCompressed(Entry& entry, const CompressedImage& image)
+	{
+		static const GLenum formats[] = { 0, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+			GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_RG_RGTC2, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_ARB, GL_COMPRESSED_RGBA_BPTC_UNORM_ARB };
+		int levelCount = (int)image.levels.size();
+
+		createTexture(entry, levelCount > 1);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+		size_t source = (size_t)stage(image.data.data(), image.data.size());
+		for (int level = 0; level < levelCount; level++)
+		{
+			const CompressedLevel& entryLevel = image.levels[level];
+			glCompressedTexImage2D(GL_TEXTURE_2D, level, formats[image.format], entryLevel.width, entryLevel.height, 0, (GLsizei)entryLevel.size, (const void*)(source + entryLevel.offset));
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+		m_Stats.resident++;
+		m_Stats.compressed++;
+		m_Stats.uploadedBytes += image.data.size();
+		m_Stats.savedBytes += image.UncompressedSize() - image.data.size();
+	}
+
+private:
+	double m_UploadBudgetMs;
+	unsigned int m_Placeholder = 0;
+	unsigned int m_PBO = 0;
+	std::vector<Entry> m_Entries;     // indexed by TextureHandle::index, render thread only
+	TextureStats m_Stats;
+	bool m_UseCompressed = true;
+	bool m_FormatSupported[TEXTURE_BLOCK_FORMAT_COUNT] = {}; // set before the workers start, read-only after
+	int m_MaxTextureSize = 0;                                 // likewise
+
+	// shared with the workers, guarded by m_Mutex
+	std::mutex m_Mutex;
+	std::condition_variable m_JobReady, m_ResultReady;
+	std::deque<Job> m_Jobs;
+	std::deque<Decoded> m_Decoded;
+	int m_Pending = 0;                // queued or decoding, not yet taken by the render thread
+	bool m_Quit = false;
+	std::vector<std::thread> m_Workers;
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+
+// uniform block binding points shared by every program, Shader::BindBlock() connects a block to one of them
+enum UniformBlockBinding
+{
+	UNIFORM_BLOCK_FRAME = 0,     // per frame data (camera, time), uploaded once and read by all programs
+	UNIFORM_BLOCK_MATERIAL = 1,
+	UNIFORM_BLOCK_DRAW = 2       // per draw data, usually ranges of a StreamBuffer (glBindBufferRange)
+};
+
+// Uniform buffer holding one T (a struct of Std140.h types) that stays bound to a binding point, so every program
+// whose block is bound to the same point reads the latest Update() without any per program call.
+template <typename T>
+class UniformBuffer
+{
+public:
+	// must be created with a current GL context
+	explicit UniformBuffer(UniformBlockBinding binding) : m_Binding(binding)
+	{
+		glGenBuffers(1, &m_Buffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(T), NULL, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_Buffer);
+	}
+
+	~UniformBuffer() { glDeleteBuffers(1, &m_Buffer); }
+
+	UniformBuffer(const UniformBuffer&) = delete;
+	UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+	// upload the whole block, one call
+	// ------------------------------------------------------------------------
+	void Update(const T& data)
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(T), &data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	unsigned int GetBuffer() const { return m_Buffer; }
+	UniformBlockBinding GetBinding() const { return m_Binding; }
+
+private:
+	unsigned int m_Buffer = 0;
+	UniformBlockBinding m_Binding;
+};
@@ -0,0 +1,89 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+#include <string>
+
+// Small helpers shared by the renderer classes and the benchmark modes.
+
+// milliseconds on the steady clock, only differences between two calls mean anything
+// ------------------------------------------------------------------------
+inline double NowMs()
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// xorshift32: fast, and the same sequence on every platform for a given seed (std::mt19937 is too, but the
+// distributions on top of it are not), which keeps benchmark scenes reproducible
+struct XorShift32
+{
+	uint32_t state;
+
+	explicit XorShift32(uint32_t seed = 12345) : state(seed) {}
+
+	uint32_t Next()
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	// in [0, 1)
+	float Next01() { return (Next() & 0xFFFFFF) / (float)0x1000000; }
+};
+
+// 64-bit FNV-1a, fed piece by piece: Fnv1a64().Add(a).Add(b).Get()
+class Fnv1a64
+{
+public:
+	Fnv1a64& Add(const void* data, size_t size)
+	{
+		const unsigned char* bytes = (const unsigned char*)data;
+		for (size_t i = 0; i < size; i++)
+			m_Hash = (m_Hash ^ bytes[i]) * PRIME;
+		return *this;
+	}
+
+	// the text and a 0xFF separator (a byte UTF-8 never contains), so "ab" + "c" doesn't hash like "a" + "bc"
+	Fnv1a64& Add(const std::string& text)
+	{
+		Add(text.data(), text.size());
+		m_Hash = (m_Hash ^ 0xFF) * PRIME;
+		return *this;
+	}
+
+	uint64_t Get() const { return m_Hash; }
+
+private:
+	static constexpr uint64_t PRIME = 1099511628211ull;
+	uint64_t m_Hash = 14695981039346656037ull;
+};
+
+// fixed point output with the given precision until the end of the scope, then the stream's previous format
+class FixedFormat
+{
+public:
+	FixedFormat(std::ostream& stream, int precision)
+		: m_Stream(stream), m_Flags(stream.flags()), m_Precision(stream.precision())
+	{
+		m_Stream.setf(std::ios::fixed, std::ios::floatfield);
+		m_Stream.precision(precision);
+	}
+
+	~FixedFormat()
+	{
+		m_Stream.flags(m_Flags);
+		m_Stream.precision(m_Precision);
+	}
+
+	FixedFormat(const FixedFormat&) = delete;
+	FixedFormat& operator=(const FixedFormat&) = delete;
+
+private:
+	std::ostream& m_Stream;
+	std::ios::fmtflags m_Flags;
+	std::streamsize m_Precision;
+};
@@ -0,0 +1,282 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// how one vertex attribute is stored in the vertex buffer; the shader always reads floats
+enum VertexAttributeType
+{
+	VERTEX_FLOAT32,          // GL_FLOAT, exact
+	VERTEX_FLOAT16,          // GL_HALF_FLOAT, 11 significant bits: positions of meshes near the origin
+	VERTEX_UNORM8,           // GL_UNSIGNED_BYTE normalized to [0, 1]: colors
+	VERTEX_UNORM16,          // GL_UNSIGNED_SHORT normalized to [0, 1]: texture coordinates inside one tile
+	VERTEX_SNORM_2_10_10_10  // GL_INT_2_10_10_10_REV normalized to [-1, 1], 4 components in 32 bits: normals, tangents
+};
+
+struct VertexAttribute
+{
+	int location;            // layout (location = N) in the shader
+	int components;
+	VertexAttributeType type;
+	int offset;              // bytes from the start of the vertex
+};
+
+// result of QuantizeVertices(), per attribute of the target format
+struct VertexQuantizationError
+{
+	int location = 0;
+	float maxError = 0.0f;   // largest absolute difference between a source value and its decoded encoding
+	float maxBound = 0.0f;   // largest error bound of the values (ErrorBound() for their magnitude)
+	int outOfBound = 0;      // values whose error exceeded their bound (a bug, never expected)
+	int clamped = 0;         // values outside the range of the type, stored as the nearest representable value
+};
+
+// Declarative interleaved vertex layout: Add() the attributes in memory order, Apply() issues the
+// glVertexAttribPointer calls, Encode()/Decode() convert between floats and the packed encodings on the CPU.
+// Every attribute starts 4 byte aligned, so the stride is always a multiple of 4 as GL wants it.
+class VertexFormat
+{
+public:
+	VertexFormat& Add(int location, int components, VertexAttributeType type)
+	{
+		if (type == VERTEX_SNORM_2_10_10_10 && components != 4)
+		{
+			std::cout << "ERROR::VERTEX_FORMAT::PACKED_ATTRIBUTE_NEEDS_4_COMPONENTS: location " << location << std::endl;
+			components = 4;
+		}
+		m_Attributes.push_back(VertexAttribute{ location, components, type, m_Stride });
+		m_Stride += (attributeSize(type, components) + 3) / 4 * 4;
+		return *this;
+	}
+
+	int GetStride() const { return m_Stride; }
+	int GetAttributeCount() const { return (int)m_Attributes.size(); }
+	const VertexAttribute& GetAttribute(int index) const { return m_Attributes[index]; }
+
+	// index of the attribute at a shader location, -1 if the format has none
+	int Find(int location) const
+	{
+		for (size_t i = 0; i < m_Attributes.size(); i++)
+			if (m_Attributes[i].location == location)
+				return (int)i;
+		return -1;
+	}
+
+	// point the attributes of the bound vertex array at the bound GL_ARRAY_BUFFER, vertices starting at bufferOffset
+	// ------------------------------------------------------------------------
+	void Apply(size_t bufferOffset = 0) const
+	{
+		static const GLenum glTypes[] = { GL_FLOAT, GL_HALF_FLOAT, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_INT_2_10_10_10_REV };
+		for (const VertexAttribute& attribute : m_Attributes)
+		{
+			GLboolean normalized = attribute.type == VERTEX_FLOAT32 || attribute.type == VERTEX_FLOAT16 ? GL_FALSE : GL_TRUE;
+			glVertexAttribPointer(attribute.location, attribute.components, glTypes[attribute.type], normalized, m_Stride,
+				(void*)(bufferOffset + attribute.offset));
+			glEnableVertexAttribArray(attribute.location);
+		}
+	}
+
+	// store the attribute's components (values[0..components-1]) into the vertex
+	// ------------------------------------------------------------------------
+	void Encode(int index, const float* values, void* vertex) const
+	{
+		const VertexAttribute& attribute = m_Attributes[index];
+		unsigned char* data = (unsigned char*)vertex + attribute.offset;
+		for (int i = 0; i < attribute.components && attribute.type != VERTEX_SNORM_2_10_10_10; i++)
+		{
+			switch (attribute.type)
+			{
+			case VERTEX_FLOAT32: std::memcpy(data + i * 4, &values[i], 4); break;
+			case VERTEX_FLOAT16: { uint16_t half = FloatToHalf(values[i]); std::memcpy(data + i * 2, &half, 2); break; }
+			case VERTEX_UNORM8:  data[i] = (unsigned char)unorm(values[i], 255.0f); break;
+			case VERTEX_UNORM16: { uint16_t value = (uint16_t)unorm(values[i], 65535.0f); std::memcpy(data + i * 2, &value, 2); break; }
+			default: break;
+			}
+		}
+		if (attribute.type == VERTEX_SNORM_2_10_10_10)
+		{
+			uint32_t packed = (uint32_t)(snorm(values[0], 511.0f) & 0x3FF) | (uint32_t)(snorm(values[1], 511.0f) & 0x3FF) << 10
+				| (uint32_t)(snorm(values[2], 511.0f) & 0x3FF) << 20 | (uint32_t)(snorm(values[3], 1.0f) & 0x3) << 30;
+			std::memcpy(data, &packed, 4);
+		}
+	}
+
+	// read the attribute back as the shader sees it
+	// ------------------------------------------------------------------------
+	void Decode(int index, const void* vertex, float* values) const
+	{
+		const VertexAttribute& attribute = m_Attributes[index];
+		const unsigned char* data = (const unsigned char*)vertex + attribute.offset;
+		if (attribute.type == VERTEX_SNORM_2_10_10_10)
+		{
+			uint32_t packed;
+			std::memcpy(&packed, data, 4);
+			// sign extend each field; GL 4.2+ maps c to max(c / (2^(b-1) - 1), -1) (3.3 drivers may use (2c + 1) / (2^b - 1))
+			int fields[4] = { (int32_t)(packed << 22) >> 22, (int32_t)(packed << 12) >> 22, (int32_t)(packed << 2) >> 22, (int32_t)packed >> 30 };
+			for (int i = 0; i < 3; i++)
+				values[i] = std::max(fields[i] / 511.0f, -1.0f);
+			values[3] = std::max((float)fields[3], -1.0f);
+			return;
+		}
+		for (int i = 0; i < attribute.components; i++)
+		{
+			switch (attribute.type)
+			{
+			case VERTEX_FLOAT32: std::memcpy(&values[i], data + i * 4, 4); break;
+			case VERTEX_FLOAT16: { uint16_t half; std::memcpy(&half, data + i * 2, 2); values[i] = HalfToFloat(half); break; }
+			case VERTEX_UNORM8:  values[i] = data[i] / 255.0f; break;
+			case VERTEX_UNORM16: { uint16_t value; std::memcpy(&value, data + i * 2, 2); values[i] = value / 65535.0f; break; }
+			default: break;
+			}
+		}
+	}
+
+	// largest absolute error of storing a value of this magnitude (inside the type's range) in component of type
+	// ------------------------------------------------------------------------
+	static float ErrorBound(VertexAttributeType type, int component, float magnitude)
+	{
+		switch (type)
+		{
+		case VERTEX_FLOAT16: return std::max(std::fabs(magnitude) * 0.00048828125f, 2.98023224e-8f); // half an ulp: 2^-11 relative, 2^-25 subnormal
+		case VERTEX_UNORM8:  return 0.5f / 255.0f;
+		case VERTEX_UNORM16: return 0.5f / 65535.0f;
+		case VERTEX_SNORM_2_10_10_10: return component < 3 ? 0.5f / 511.0f : 0.5f;
+		default:             return 0.0f;
+		}
+	}
+
+	// range check of the types that clamp (half floats clamp to +-65504 instead of overflowing to infinity)
+	static bool InRange(VertexAttributeType type, float value)
+	{
+		switch (type)
+		{
+		case VERTEX_FLOAT16: return std::fabs(value) <= 65504.0f;
+		case VERTEX_UNORM8:
+		case VERTEX_UNORM16: return value >= 0.0f && value <= 1.0f;
+		case VERTEX_SNORM_2_10_10_10: return value >= -1.0f && value <= 1.0f;
+		default:             return true;
+		}
+	}
+
+	// IEEE 754 binary16, round to nearest even, clamped to the largest finite half
+	// ------------------------------------------------------------------------
+	static uint16_t FloatToHalf(float value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, 4);
+		uint32_t sign = (bits >> 16) & 0x8000;
+		uint32_t magnitude = bits & 0x7FFFFFFF;
+		if (magnitude > 0x7F800000)
+			return (uint16_t)(sign | 0x7E00);                      // NaN
+		if (magnitude >= 0x477FF000)
+			return (uint16_t)(sign | 0x7BFF);                      // rounds to 65536 or more: clamp to 65504
+		if (magnitude < 0x38800000)
+		{
+			// below the smallest normal half (2^-14): multiples of 2^-24
+			float absolute;
+			std::memcpy(&absolute, &magnitude, 4);
+			return (uint16_t)(sign | (uint32_t)std::nearbyint(absolute * 16777216.0f));
+		}
+		uint32_t half = (magnitude - 0x38000000) >> 13;            // rebias the exponent from 127 to 15
+		uint32_t rest = magnitude & 0x1FFF;
+		if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+			half++;
+		return (uint16_t)(sign | half);
+	}
+
+	static float HalfToFloat(uint16_t half)
+	{
+		uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+		uint32_t exponent = (half >> 10) & 0x1F;
+		uint32_t mantissa = half & 0x3FF;
+		uint32_t bits;
+		if (exponent == 0)
+		{
+			float value = std::ldexp((float)mantissa, -24);
+			return sign ? -value : value;
+		}
+		if (exponent == 31)
+			bits = sign | 0x7F800000 | mantissa << 13;
+		else
+			bits = sign | (exponent + 112) << 23 | mantissa << 13;
+		float value;
+		std::memcpy(&value, &bits, 4);
+		return value;
+	}
+
+private:
+	static int attributeSize(VertexAttributeType type, int components)
+	{
+		static const int componentSizes[] = { 4, 2, 1, 2 };
+		return type == VERTEX_SNORM_2_10_10_10 ? 4 : componentSizes[type] * components;
+	}
+
+	static uint32_t unorm(float value, float scale)
+	{
+		value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+		return (uint32_t)std::nearbyint(value * scale);
+	}
+
+	static int32_t snorm(float value, float scale)
+	{
+		value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+		return (int32_t)std::nearbyint(value * scale);
+	}
+
+private:
+	std::vector<VertexAttribute> m_Attributes;
+	int m_Stride = 0;
+};
+
+// Convert count vertices from one format into another (attributes matched by location; attributes the source
+// lacks get the GL defaults 0, 0, 0, 1) and measure what the target encoding lost against its error bounds.
+// ---------------------------------------------------------------------------------------------------------
+inline std::vector<VertexQuantizationError> QuantizeVertices(const VertexFormat& from, const void* source, const VertexFormat& to, void* destination, int count)
+{
+	std::vector<VertexQuantizationError> errors(to.GetAttributeCount());
+	std::vector<int> sourceIndices(to.GetAttributeCount());
+	for (int i = 0; i < to.GetAttributeCount(); i++)
+	{
+		errors[i].location = to.GetAttribute(i).location;
+		sourceIndices[i] = from.Find(errors[i].location);
+	}
+
+	for (int vertex = 0; vertex < count; vertex++)
+	{
+		const unsigned char* input = (const unsigned char*)source + (size_t)vertex * from.GetStride();
+		unsigned char* output = (unsigned char*)destination + (size_t)vertex * to.GetStride();
+		for (int i = 0; i < to.GetAttributeCount(); i++)
+		{
+			const VertexAttribute& attribute = to.GetAttribute(i);
+			float values[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+			if (sourceIndices[i] >= 0)
+				from.Decode(sourceIndices[i], input, values);
+			to.Encode(i, values, output);
+			float decoded[4];
+			to.Decode(i, output, decoded);
+
+			// only the components the source has are measured, the filled in defaults are exact
+			VertexQuantizationError& error = errors[i];
+			int measured = sourceIndices[i] >= 0 ? std::min(attribute.components, from.GetAttribute(sourceIndices[i]).components) : 0;
+			for (int component = 0; component < measured; component++)
+			{
+				if (!VertexFormat::InRange(attribute.type, values[component]))
+				{
+					error.clamped++;
+					continue;
+				}
+				float difference = std::fabs(decoded[component] - values[component]);
+				float bound = VertexFormat::ErrorBound(attribute.type, component, values[component]);
+				error.maxError = std::max(error.maxError, difference);
+				error.maxBound = std::max(error.maxBound, bound);
+				if (difference > bound * 1.0001f)
+					error.outOfBound++;
+			}
+		}
+	}
+	return errors;
+}
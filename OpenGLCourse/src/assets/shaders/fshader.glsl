@@ -9,10 +9,15 @@ uniform vec4 ourColor;
 uniform sampler2D texture1;
 uniform sampler2D texture2;
 
+// permutations (ShaderDefines): USE_VERTEX_COLOR, USE_UNIFORM_COLOR, default the two textures
 void main()
 {
-	//FragColor = vec4(newColor, 1.0);
-	//FragColor = ourColor; 
+#if defined(USE_VERTEX_COLOR)
+	FragColor = vec4(newColor, 1.0);
+#elif defined(USE_UNIFORM_COLOR)
+	FragColor = ourColor;
+#else
 	//FragColor = texture(ourTexture, TexCoord) * vec4(newColor, 1);
 	FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.2);   //80% color 1ra textura - 20% color 2da textura
+#endif
 }
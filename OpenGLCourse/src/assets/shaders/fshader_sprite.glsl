@@ -0,0 +1,38 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoord;
+in vec4 Tint;
+flat in uint Slot;
+
+uniform sampler2D u_Textures[16];
+
+// GLSL 3.30 only allows constant expressions as sampler array index, so the slot picks a case
+vec4 sampleSlot(uint slot, vec2 uv)
+{
+	switch (slot)
+	{
+	case 0u:  return texture(u_Textures[0], uv);
+	case 1u:  return texture(u_Textures[1], uv);
+	case 2u:  return texture(u_Textures[2], uv);
+	case 3u:  return texture(u_Textures[3], uv);
+	case 4u:  return texture(u_Textures[4], uv);
+	case 5u:  return texture(u_Textures[5], uv);
+	case 6u:  return texture(u_Textures[6], uv);
+	case 7u:  return texture(u_Textures[7], uv);
+	case 8u:  return texture(u_Textures[8], uv);
+	case 9u:  return texture(u_Textures[9], uv);
+	case 10u: return texture(u_Textures[10], uv);
+	case 11u: return texture(u_Textures[11], uv);
+	case 12u: return texture(u_Textures[12], uv);
+	case 13u: return texture(u_Textures[13], uv);
+	case 14u: return texture(u_Textures[14], uv);
+	default:  return texture(u_Textures[15], uv);
+	}
+}
+
+void main()
+{
+	FragColor = sampleSlot(Slot, TexCoord) * Tint;
+}
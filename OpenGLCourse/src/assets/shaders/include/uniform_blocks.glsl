@@ -0,0 +1,13 @@
+// bound to UNIFORM_BLOCK_FRAME, uploaded once per frame for every program
+layout (std140) uniform FrameUniforms
+{
+	vec4 camera;     // xy offset, z zoom
+	vec4 time;       // x seconds
+};
+
+// bound to UNIFORM_BLOCK_DRAW, a range of the per draw stream buffer
+layout (std140) uniform DrawUniforms
+{
+	vec4 transform;  // xy offset, z scale
+	vec4 tint;
+};
@@ -0,0 +1,15 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+#include "include/uniform_blocks.glsl"
+
+out vec3 newColor;
+
+void main()
+{
+	vec2 position = (aPos.xy * transform.z + transform.xy + camera.xy) * camera.z;
+	gl_Position = vec4(position, 0.0, 1.0);
+	newColor = aColor * tint.rgb * (0.75 + 0.25 * sin(time.x));
+}
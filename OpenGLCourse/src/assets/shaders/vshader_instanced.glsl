@@ -0,0 +1,22 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aTexCoord;
+
+// per instance (glVertexAttribDivisor 1): rows of an affine 3x4 transform and a tint
+layout (location = 3) in vec4 aTransformRow0;
+layout (location = 4) in vec4 aTransformRow1;
+layout (location = 5) in vec4 aTransformRow2;
+layout (location = 6) in vec4 aInstanceColor;
+
+out vec3 newColor;
+out vec2 TexCoord;
+
+void main()
+{
+	vec4 position = vec4(aPos, 1.0);
+	gl_Position = vec4(dot(aTransformRow0, position), dot(aTransformRow1, position), dot(aTransformRow2, position), 1.0);
+	newColor = aColor * aInstanceColor.rgb;
+	TexCoord = aTexCoord;
+}
@@ -0,0 +1,23 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in vec4 aNormal;
+
+// per draw placement: xyz view space position, w uniform scale
+uniform vec4 u_Transform;
+// perspective projection: xy focal lengths (x divided by the aspect ratio), zw map view space z to clip space z
+uniform vec4 u_Projection;
+
+out vec3 newColor;
+out vec2 TexCoord;
+
+void main()
+{
+	vec3 view = aPos * u_Transform.w + u_Transform.xyz;
+	gl_Position = vec4(view.xy * u_Projection.xy, view.z * u_Projection.z + u_Projection.w, -view.z);
+	float light = 0.35 + 0.65 * max(dot(normalize(aNormal.xyz), normalize(vec3(0.3, 0.4, 1.0))), 0.0);
+	newColor = aColor * light;
+	TexCoord = aTexCoord;
+}
@@ -0,0 +1,19 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in vec4 aNormal;
+
+out vec3 newColor;
+out vec2 TexCoord;
+
+// lit vertex color, every attribute is read so packed and float layouts fetch the same data
+void main()
+{
+	// viewed from +z like a right handed camera, so outward facing counter clockwise triangles are front faces
+	gl_Position = vec4(aPos.xy * 0.9, -aPos.z * 0.5, 1.0);
+	float light = 0.35 + 0.65 * max(dot(normalize(aNormal.xyz), normalize(vec3(0.3, 0.4, 1.0))), 0.0);
+	newColor = aColor * light * (0.8 + 0.2 * aTexCoord.x);
+	TexCoord = aTexCoord;
+}
@@ -0,0 +1,21 @@
+#version 330 core
+
+layout (location = 0) in vec2 aPos;       // pixels, origin at the top left corner
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColor;     // RGBA8, normalized
+layout (location = 3) in uint aSlot;      // index into u_Textures
+
+uniform vec2 u_ScreenSize;
+
+out vec2 TexCoord;
+out vec4 Tint;
+flat out uint Slot;
+
+void main()
+{
+	vec2 ndc = aPos / u_ScreenSize * 2.0 - 1.0;
+	gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+	TexCoord = aTexCoord;
+	Tint = aColor;
+	Slot = aSlot;
+}
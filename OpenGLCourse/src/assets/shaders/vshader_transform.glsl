@@ -0,0 +1,18 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aTexCoord;
+
+// per draw placement: xy offset, z uniform scale, w depth (clip space)
+uniform vec4 u_Transform;
+
+out vec3 newColor;
+out vec2 TexCoord;
+
+void main()
+{
+	gl_Position = vec4(aPos.xy * u_Transform.z + u_Transform.xy, u_Transform.w, 1.0);
+	newColor = aColor;
+	TexCoord = aTexCoord;
+}
@@ -0,0 +1,19 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+// same inputs as vshader_blocks.glsl, one glUniform call each
+uniform vec4 u_Camera;     // xy offset, z zoom
+uniform vec4 u_Time;       // x seconds
+uniform vec4 u_Transform;  // xy offset, z scale
+uniform vec4 u_Tint;
+
+out vec3 newColor;
+
+void main()
+{
+	vec2 position = (aPos.xy * u_Transform.z + u_Transform.xy + u_Camera.xy) * u_Camera.z;
+	gl_Position = vec4(position, 0.0, 1.0);
+	newColor = aColor * u_Tint.rgb * (0.75 + 0.25 * sin(u_Time.x));
+}
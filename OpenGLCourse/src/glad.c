@@ -17,12 +17,18 @@
         --profile="compatibility" --api="gl=4.6" --generator="c" --spec="gl" --extensions=""
     Online:
         https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D4.6
+
+    Added by hand after generation (regenerating with the command above drops them):
+        On demand loading: compile with -DGLAD_ON_DEMAND, see glad_on_demand_load
+        Extensions, declared in GLExtensions.h: GL_ARB_parallel_shader_compile, GL_ARB_texture_compression_bptc,
+        GL_EXT_texture_compression_s3tc, GL_KHR_parallel_shader_compile
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <glad/glad.h>
+#include "GLExtensions.h"
 
 static void* get_proc(const char *namez);
 
@@ -67,1261 +73,5496 @@ int open_gl(void) {
 
     return 0;
 }
-
-static
-void close_gl(void) {
-    if(libGL != NULL) {
-        FreeLibrary((HMODULE) libGL);
-        libGL = NULL;
-    }
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        FreeLibrary((HMODULE) libGL);
+        libGL = NULL;
+    }
+}
+#else
+#include <dlfcn.h>
+static void* libGL;
+
+#if !defined(__APPLE__) && !defined(__HAIKU__)
+typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+#endif
+
+static
+int open_gl(void) {
+#ifdef __APPLE__
+    static const char *NAMES[] = {
+        "../Frameworks/OpenGL.framework/OpenGL",
+        "/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
+    };
+#else
+    static const char *NAMES[] = {"libGL.so.1", "libGL.so"};
+#endif
+
+    unsigned int index = 0;
+    for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
+        libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
+
+        if(libGL != NULL) {
+#if defined(__APPLE__) || defined(__HAIKU__)
+            return 1;
+#else
+            gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
+                "glXGetProcAddressARB");
+            return gladGetProcAddressPtr != NULL;
+#endif
+        }
+    }
+
+    return 0;
+}
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        dlclose(libGL);
+        libGL = NULL;
+    }
+}
+#endif
+
+static
+void* get_proc(const char *namez) {
+    void* result = NULL;
+    if(libGL == NULL) return NULL;
+
+#if !defined(__APPLE__) && !defined(__HAIKU__)
+    if(gladGetProcAddressPtr != NULL) {
+        result = gladGetProcAddressPtr(namez);
+    }
+#endif
+    if(result == NULL) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+        result = (void*)GetProcAddress((HMODULE) libGL, namez);
+#else
+        result = dlsym(libGL, namez);
+#endif
+    }
+
+    return result;
+}
+
+int gladLoadGL(void) {
+    int status = 0;
+
+    if(open_gl()) {
+        status = gladLoadGLLoader(&get_proc);
+#ifndef GLAD_ON_DEMAND
+        close_gl();
+#else
+        (void)&close_gl; /* the trampolines keep resolving through get_proc, libGL has to stay open */
+#endif
+    }
+
+    return status;
+}
+
+struct gladGLversionStruct GLVersion = { 0, 0 };
+
+#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
+#define _GLAD_IS_SOME_NEW_VERSION 1
+#endif
+
+static int max_loaded_major;
+static int max_loaded_minor;
+
+static const char *exts = NULL;
+static int num_exts_i = 0;
+static char **exts_i = NULL;
+
+static int get_exts(void) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        exts = (const char *)glGetString(GL_EXTENSIONS);
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        unsigned int index;
+
+        num_exts_i = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if (num_exts_i > 0) {
+            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
+        }
+
+        if (exts_i == NULL) {
+            return 0;
+        }
+
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            size_t len = strlen(gl_str_tmp);
+
+            char *local_str = (char*)malloc((len+1) * sizeof(char));
+            if(local_str != NULL) {
+                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
+            }
+            exts_i[index] = local_str;
+        }
+    }
+#endif
+    return 1;
+}
+
+static void free_exts(void) {
+    if (exts_i != NULL) {
+        int index;
+        for(index = 0; index < num_exts_i; index++) {
+            free((char *)exts_i[index]);
+        }
+        free((void *)exts_i);
+        exts_i = NULL;
+    }
+}
+
+static int has_ext(const char *ext) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        const char *extensions;
+        const char *loc;
+        const char *terminator;
+        extensions = exts;
+        if(extensions == NULL || ext == NULL) {
+            return 0;
+        }
+
+        while(1) {
+            loc = strstr(extensions, ext);
+            if(loc == NULL) {
+                return 0;
+            }
+
+            terminator = loc + strlen(ext);
+            if((loc == extensions || *(loc - 1) == ' ') &&
+                (*terminator == ' ' || *terminator == '\0')) {
+                return 1;
+            }
+            extensions = terminator;
+        }
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        int index;
+        if(exts_i == NULL) return 0;
+        for(index = 0; index < num_exts_i; index++) {
+            const char *e = exts_i[index];
+
+            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
+                return 1;
+            }
+        }
+    }
+#endif
+
+    return 0;
+}
+int GLAD_GL_VERSION_1_0 = 0;
+int GLAD_GL_VERSION_1_1 = 0;
+int GLAD_GL_VERSION_1_2 = 0;
+int GLAD_GL_VERSION_1_3 = 0;
+int GLAD_GL_VERSION_1_4 = 0;
+int GLAD_GL_VERSION_1_5 = 0;
+int GLAD_GL_VERSION_2_0 = 0;
+int GLAD_GL_VERSION_2_1 = 0;
+int GLAD_GL_VERSION_3_0 = 0;
+int GLAD_GL_VERSION_3_1 = 0;
+int GLAD_GL_VERSION_3_2 = 0;
+int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_VERSION_4_0 = 0;
+int GLAD_GL_VERSION_4_1 = 0;
+int GLAD_GL_VERSION_4_2 = 0;
+int GLAD_GL_VERSION_4_3 = 0;
+int GLAD_GL_VERSION_4_4 = 0;
+int GLAD_GL_VERSION_4_5 = 0;
+int GLAD_GL_VERSION_4_6 = 0;
+int GLAD_GL_ARB_parallel_shader_compile = 0;
+int GLAD_GL_ARB_texture_compression_bptc = 0;
+int GLAD_GL_EXT_texture_compression_s3tc = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+#ifdef GLAD_ON_DEMAND
+/* On-demand loading: every function pointer starts out as a trampoline that resolves the real entry point
+ * through the loader given to gladLoadGLLoader on its first call, stores it and forwards the call. Startup
+ * only queries the version, and with -ffunction-sections -fdata-sections -Wl,--gc-sections (MSVC: /Gy /OPT:REF)
+ * the linker drops the pointer and trampoline of every function the program never references.
+ * The loader must stay valid, and the first call of each function must happen with a current context.
+ * Pointers are never NULL in this mode, probe optional functions with GLVersion / glGetIntegerv instead. */
+static GLADloadproc glad_on_demand_loader = NULL;
+
+static void* glad_on_demand_load(const char *name) {
+	void *proc = NULL;
+	if (glad_on_demand_loader != NULL) {
+		proc = glad_on_demand_loader(name);
+	}
+	if (proc == NULL) {
+		fprintf(stderr, "GLAD: failed to load %s (gladLoadGLLoader not called, or not supported by the driver)\n", name);
+		abort();
+	}
+	return proc;
+}
+static void APIENTRY glad_on_demand_glAccum(GLenum op, GLfloat value) {
+	glad_glAccum = (PFNGLACCUMPROC)glad_on_demand_load("glAccum");
+	glad_glAccum(op, value);
+}
+static void APIENTRY glad_on_demand_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)glad_on_demand_load("glActiveShaderProgram");
+	glad_glActiveShaderProgram(pipeline, program);
+}
+static void APIENTRY glad_on_demand_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_on_demand_load("glActiveTexture");
+	glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_on_demand_glAlphaFunc(GLenum func, GLclampf ref) {
+	glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)glad_on_demand_load("glAlphaFunc");
+	glad_glAlphaFunc(func, ref);
+}
+static GLboolean APIENTRY glad_on_demand_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)glad_on_demand_load("glAreTexturesResident");
+	return glad_glAreTexturesResident(n, textures, residences);
+}
+static void APIENTRY glad_on_demand_glArrayElement(GLint i) {
+	glad_glArrayElement = (PFNGLARRAYELEMENTPROC)glad_on_demand_load("glArrayElement");
+	glad_glArrayElement(i);
+}
+static void APIENTRY glad_on_demand_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)glad_on_demand_load("glAttachShader");
+	glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_on_demand_glBegin(GLenum mode) {
+	glad_glBegin = (PFNGLBEGINPROC)glad_on_demand_load("glBegin");
+	glad_glBegin(mode);
+}
+static void APIENTRY glad_on_demand_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_on_demand_load("glBeginConditionalRender");
+	glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_on_demand_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_on_demand_load("glBeginQuery");
+	glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_on_demand_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)glad_on_demand_load("glBeginQueryIndexed");
+	glad_glBeginQueryIndexed(target, index, id);
+}
+static void APIENTRY glad_on_demand_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_on_demand_load("glBeginTransformFeedback");
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_on_demand_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_on_demand_load("glBindAttribLocation");
+	glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_on_demand_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_on_demand_load("glBindBuffer");
+	glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_on_demand_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_on_demand_load("glBindBufferBase");
+	glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_on_demand_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_on_demand_load("glBindBufferRange");
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_on_demand_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)glad_on_demand_load("glBindBuffersBase");
+	glad_glBindBuffersBase(target, first, count, buffers);
+}
+static void APIENTRY glad_on_demand_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)glad_on_demand_load("glBindBuffersRange");
+	glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+static void APIENTRY glad_on_demand_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_on_demand_load("glBindFragDataLocation");
+	glad_glBindFragDataLocation(program, color, name);
+}
+static void APIENTRY glad_on_demand_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_on_demand_load("glBindFragDataLocationIndexed");
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static void APIENTRY glad_on_demand_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_on_demand_load("glBindFramebuffer");
+	glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_on_demand_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)glad_on_demand_load("glBindImageTexture");
+	glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY glad_on_demand_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)glad_on_demand_load("glBindImageTextures");
+	glad_glBindImageTextures(first, count, textures);
+}
+static void APIENTRY glad_on_demand_glBindProgramPipeline(GLuint pipeline) {
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)glad_on_demand_load("glBindProgramPipeline");
+	glad_glBindProgramPipeline(pipeline);
+}
+static void APIENTRY glad_on_demand_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_on_demand_load("glBindRenderbuffer");
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_on_demand_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_on_demand_load("glBindSampler");
+	glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_on_demand_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)glad_on_demand_load("glBindSamplers");
+	glad_glBindSamplers(first, count, samplers);
+}
+static void APIENTRY glad_on_demand_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_on_demand_load("glBindTexture");
+	glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_on_demand_glBindTextureUnit(GLuint unit, GLuint texture) {
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)glad_on_demand_load("glBindTextureUnit");
+	glad_glBindTextureUnit(unit, texture);
+}
+static void APIENTRY glad_on_demand_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)glad_on_demand_load("glBindTextures");
+	glad_glBindTextures(first, count, textures);
+}
+static void APIENTRY glad_on_demand_glBindTransformFeedback(GLenum target, GLuint id) {
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)glad_on_demand_load("glBindTransformFeedback");
+	glad_glBindTransformFeedback(target, id);
+}
+static void APIENTRY glad_on_demand_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_on_demand_load("glBindVertexArray");
+	glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_on_demand_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)glad_on_demand_load("glBindVertexBuffer");
+	glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_on_demand_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)glad_on_demand_load("glBindVertexBuffers");
+	glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_on_demand_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	glad_glBitmap = (PFNGLBITMAPPROC)glad_on_demand_load("glBitmap");
+	glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY glad_on_demand_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)glad_on_demand_load("glBlendColor");
+	glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_on_demand_load("glBlendEquation");
+	glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_on_demand_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_on_demand_load("glBlendEquationSeparate");
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_on_demand_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)glad_on_demand_load("glBlendEquationSeparatei");
+	glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY glad_on_demand_glBlendEquationi(GLuint buf, GLenum mode) {
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)glad_on_demand_load("glBlendEquationi");
+	glad_glBlendEquationi(buf, mode);
+}
+static void APIENTRY glad_on_demand_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_on_demand_load("glBlendFunc");
+	glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_on_demand_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_on_demand_load("glBlendFuncSeparate");
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_on_demand_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)glad_on_demand_load("glBlendFuncSeparatei");
+	glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY glad_on_demand_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)glad_on_demand_load("glBlendFunci");
+	glad_glBlendFunci(buf, src, dst);
+}
+static void APIENTRY glad_on_demand_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_on_demand_load("glBlitFramebuffer");
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_on_demand_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_on_demand_load("glBlitNamedFramebuffer");
+	glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_on_demand_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)glad_on_demand_load("glBufferData");
+	glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_on_demand_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glad_on_demand_load("glBufferStorage");
+	glad_glBufferStorage(target, size, data, flags);
+}
+static void APIENTRY glad_on_demand_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_on_demand_load("glBufferSubData");
+	glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_on_demand_glCallList(GLuint list) {
+	glad_glCallList = (PFNGLCALLLISTPROC)glad_on_demand_load("glCallList");
+	glad_glCallList(list);
+}
+static void APIENTRY glad_on_demand_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	glad_glCallLists = (PFNGLCALLLISTSPROC)glad_on_demand_load("glCallLists");
+	glad_glCallLists(n, type, lists);
+}
+static GLenum APIENTRY glad_on_demand_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_on_demand_load("glCheckFramebufferStatus");
+	return glad_glCheckFramebufferStatus(target);
+}
+static GLenum APIENTRY glad_on_demand_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_on_demand_load("glCheckNamedFramebufferStatus");
+	return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+static void APIENTRY glad_on_demand_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)glad_on_demand_load("glClampColor");
+	glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_on_demand_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)glad_on_demand_load("glClear");
+	glad_glClear(mask);
+}
+static void APIENTRY glad_on_demand_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearAccum = (PFNGLCLEARACCUMPROC)glad_on_demand_load("glClearAccum");
+	glad_glClearAccum(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)glad_on_demand_load("glClearBufferData");
+	glad_glClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY glad_on_demand_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)glad_on_demand_load("glClearBufferSubData");
+	glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_on_demand_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_on_demand_load("glClearBufferfi");
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_on_demand_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_on_demand_load("glClearBufferfv");
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_on_demand_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_on_demand_load("glClearBufferiv");
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_on_demand_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_on_demand_load("glClearBufferuiv");
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_on_demand_glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)glad_on_demand_load("glClearColor");
+	glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glClearDepth(GLclampd depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_on_demand_load("glClearDepth");
+	glad_glClearDepth(depth);
+}
+static void APIENTRY glad_on_demand_glClearDepthf(GLfloat d) {
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)glad_on_demand_load("glClearDepthf");
+	glad_glClearDepthf(d);
+}
+static void APIENTRY glad_on_demand_glClearIndex(GLfloat c) {
+	glad_glClearIndex = (PFNGLCLEARINDEXPROC)glad_on_demand_load("glClearIndex");
+	glad_glClearIndex(c);
+}
+static void APIENTRY glad_on_demand_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)glad_on_demand_load("glClearNamedBufferData");
+	glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void APIENTRY glad_on_demand_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_on_demand_load("glClearNamedBufferSubData");
+	glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_on_demand_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_on_demand_load("glClearNamedFramebufferfi");
+	glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_on_demand_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_on_demand_load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_on_demand_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_on_demand_load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_on_demand_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_on_demand_load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_on_demand_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_on_demand_load("glClearStencil");
+	glad_glClearStencil(s);
+}
+static void APIENTRY glad_on_demand_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)glad_on_demand_load("glClearTexImage");
+	glad_glClearTexImage(texture, level, format, type, data);
+}
+static void APIENTRY glad_on_demand_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)glad_on_demand_load("glClearTexSubImage");
+	glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static void APIENTRY glad_on_demand_glClientActiveTexture(GLenum texture) {
+	glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)glad_on_demand_load("glClientActiveTexture");
+	glad_glClientActiveTexture(texture);
+}
+static GLenum APIENTRY glad_on_demand_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_on_demand_load("glClientWaitSync");
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_on_demand_glClipControl(GLenum origin, GLenum depth) {
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)glad_on_demand_load("glClipControl");
+	glad_glClipControl(origin, depth);
+}
+static void APIENTRY glad_on_demand_glClipPlane(GLenum plane, const GLdouble *equation) {
+	glad_glClipPlane = (PFNGLCLIPPLANEPROC)glad_on_demand_load("glClipPlane");
+	glad_glClipPlane(plane, equation);
+}
+static void APIENTRY glad_on_demand_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glColor3b = (PFNGLCOLOR3BPROC)glad_on_demand_load("glColor3b");
+	glad_glColor3b(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3bv(const GLbyte *v) {
+	glad_glColor3bv = (PFNGLCOLOR3BVPROC)glad_on_demand_load("glColor3bv");
+	glad_glColor3bv(v);
+}
+static void APIENTRY glad_on_demand_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glColor3d = (PFNGLCOLOR3DPROC)glad_on_demand_load("glColor3d");
+	glad_glColor3d(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3dv(const GLdouble *v) {
+	glad_glColor3dv = (PFNGLCOLOR3DVPROC)glad_on_demand_load("glColor3dv");
+	glad_glColor3dv(v);
+}
+static void APIENTRY glad_on_demand_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glColor3f = (PFNGLCOLOR3FPROC)glad_on_demand_load("glColor3f");
+	glad_glColor3f(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3fv(const GLfloat *v) {
+	glad_glColor3fv = (PFNGLCOLOR3FVPROC)glad_on_demand_load("glColor3fv");
+	glad_glColor3fv(v);
+}
+static void APIENTRY glad_on_demand_glColor3i(GLint red, GLint green, GLint blue) {
+	glad_glColor3i = (PFNGLCOLOR3IPROC)glad_on_demand_load("glColor3i");
+	glad_glColor3i(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3iv(const GLint *v) {
+	glad_glColor3iv = (PFNGLCOLOR3IVPROC)glad_on_demand_load("glColor3iv");
+	glad_glColor3iv(v);
+}
+static void APIENTRY glad_on_demand_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glColor3s = (PFNGLCOLOR3SPROC)glad_on_demand_load("glColor3s");
+	glad_glColor3s(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3sv(const GLshort *v) {
+	glad_glColor3sv = (PFNGLCOLOR3SVPROC)glad_on_demand_load("glColor3sv");
+	glad_glColor3sv(v);
+}
+static void APIENTRY glad_on_demand_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glColor3ub = (PFNGLCOLOR3UBPROC)glad_on_demand_load("glColor3ub");
+	glad_glColor3ub(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3ubv(const GLubyte *v) {
+	glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)glad_on_demand_load("glColor3ubv");
+	glad_glColor3ubv(v);
+}
+static void APIENTRY glad_on_demand_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glColor3ui = (PFNGLCOLOR3UIPROC)glad_on_demand_load("glColor3ui");
+	glad_glColor3ui(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3uiv(const GLuint *v) {
+	glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)glad_on_demand_load("glColor3uiv");
+	glad_glColor3uiv(v);
+}
+static void APIENTRY glad_on_demand_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glColor3us = (PFNGLCOLOR3USPROC)glad_on_demand_load("glColor3us");
+	glad_glColor3us(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glColor3usv(const GLushort *v) {
+	glad_glColor3usv = (PFNGLCOLOR3USVPROC)glad_on_demand_load("glColor3usv");
+	glad_glColor3usv(v);
+}
+static void APIENTRY glad_on_demand_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	glad_glColor4b = (PFNGLCOLOR4BPROC)glad_on_demand_load("glColor4b");
+	glad_glColor4b(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4bv(const GLbyte *v) {
+	glad_glColor4bv = (PFNGLCOLOR4BVPROC)glad_on_demand_load("glColor4bv");
+	glad_glColor4bv(v);
+}
+static void APIENTRY glad_on_demand_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	glad_glColor4d = (PFNGLCOLOR4DPROC)glad_on_demand_load("glColor4d");
+	glad_glColor4d(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4dv(const GLdouble *v) {
+	glad_glColor4dv = (PFNGLCOLOR4DVPROC)glad_on_demand_load("glColor4dv");
+	glad_glColor4dv(v);
+}
+static void APIENTRY glad_on_demand_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glColor4f = (PFNGLCOLOR4FPROC)glad_on_demand_load("glColor4f");
+	glad_glColor4f(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4fv(const GLfloat *v) {
+	glad_glColor4fv = (PFNGLCOLOR4FVPROC)glad_on_demand_load("glColor4fv");
+	glad_glColor4fv(v);
+}
+static void APIENTRY glad_on_demand_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_glColor4i = (PFNGLCOLOR4IPROC)glad_on_demand_load("glColor4i");
+	glad_glColor4i(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4iv(const GLint *v) {
+	glad_glColor4iv = (PFNGLCOLOR4IVPROC)glad_on_demand_load("glColor4iv");
+	glad_glColor4iv(v);
+}
+static void APIENTRY glad_on_demand_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	glad_glColor4s = (PFNGLCOLOR4SPROC)glad_on_demand_load("glColor4s");
+	glad_glColor4s(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4sv(const GLshort *v) {
+	glad_glColor4sv = (PFNGLCOLOR4SVPROC)glad_on_demand_load("glColor4sv");
+	glad_glColor4sv(v);
+}
+static void APIENTRY glad_on_demand_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	glad_glColor4ub = (PFNGLCOLOR4UBPROC)glad_on_demand_load("glColor4ub");
+	glad_glColor4ub(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4ubv(const GLubyte *v) {
+	glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)glad_on_demand_load("glColor4ubv");
+	glad_glColor4ubv(v);
+}
+static void APIENTRY glad_on_demand_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_glColor4ui = (PFNGLCOLOR4UIPROC)glad_on_demand_load("glColor4ui");
+	glad_glColor4ui(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4uiv(const GLuint *v) {
+	glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)glad_on_demand_load("glColor4uiv");
+	glad_glColor4uiv(v);
+}
+static void APIENTRY glad_on_demand_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	glad_glColor4us = (PFNGLCOLOR4USPROC)glad_on_demand_load("glColor4us");
+	glad_glColor4us(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColor4usv(const GLushort *v) {
+	glad_glColor4usv = (PFNGLCOLOR4USVPROC)glad_on_demand_load("glColor4usv");
+	glad_glColor4usv(v);
+}
+static void APIENTRY glad_on_demand_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)glad_on_demand_load("glColorMask");
+	glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_on_demand_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)glad_on_demand_load("glColorMaski");
+	glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_on_demand_glColorMaterial(GLenum face, GLenum mode) {
+	glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)glad_on_demand_load("glColorMaterial");
+	glad_glColorMaterial(face, mode);
+}
+static void APIENTRY glad_on_demand_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_on_demand_load("glColorP3ui");
+	glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_on_demand_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_on_demand_load("glColorP3uiv");
+	glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_on_demand_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_on_demand_load("glColorP4ui");
+	glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_on_demand_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_on_demand_load("glColorP4uiv");
+	glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_on_demand_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *ptr) {
+	glad_glColorPointer = (PFNGLCOLORPOINTERPROC)glad_on_demand_load("glColorPointer");
+	glad_glColorPointer(size, type, stride, ptr);
+}
+static void APIENTRY glad_on_demand_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_on_demand_load("glCompileShader");
+	glad_glCompileShader(shader);
+}
+static void APIENTRY glad_on_demand_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_on_demand_load("glCompressedTexImage1D");
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_on_demand_load("glCompressedTexImage2D");
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_on_demand_load("glCompressedTexImage3D");
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_on_demand_load("glCompressedTexSubImage1D");
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_on_demand_load("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_on_demand_load("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_on_demand_load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_on_demand_load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_on_demand_load("glCompressedTextureSubImage3D");
+	glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_on_demand_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_on_demand_load("glCopyBufferSubData");
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_on_demand_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)glad_on_demand_load("glCopyImageSubData");
+	glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY glad_on_demand_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_on_demand_load("glCopyNamedBufferSubData");
+	glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_on_demand_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)glad_on_demand_load("glCopyPixels");
+	glad_glCopyPixels(x, y, width, height, type);
+}
+static void APIENTRY glad_on_demand_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_on_demand_load("glCopyTexImage1D");
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_on_demand_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_on_demand_load("glCopyTexImage2D");
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_on_demand_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_on_demand_load("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_on_demand_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_on_demand_load("glCopyTexSubImage2D");
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_on_demand_load("glCopyTexSubImage3D");
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_on_demand_load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_on_demand_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_on_demand_load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_on_demand_load("glCopyTextureSubImage3D");
+	glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)glad_on_demand_load("glCreateBuffers");
+	glad_glCreateBuffers(n, buffers);
+}
+static void APIENTRY glad_on_demand_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)glad_on_demand_load("glCreateFramebuffers");
+	glad_glCreateFramebuffers(n, framebuffers);
+}
+static GLuint APIENTRY glad_on_demand_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_on_demand_load("glCreateProgram");
+	return glad_glCreateProgram();
+}
+static void APIENTRY glad_on_demand_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)glad_on_demand_load("glCreateProgramPipelines");
+	glad_glCreateProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_on_demand_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)glad_on_demand_load("glCreateQueries");
+	glad_glCreateQueries(target, n, ids);
+}
+static void APIENTRY glad_on_demand_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)glad_on_demand_load("glCreateRenderbuffers");
+	glad_glCreateRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_on_demand_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)glad_on_demand_load("glCreateSamplers");
+	glad_glCreateSamplers(n, samplers);
+}
+static GLuint APIENTRY glad_on_demand_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)glad_on_demand_load("glCreateShader");
+	return glad_glCreateShader(type);
+}
+static GLuint APIENTRY glad_on_demand_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)glad_on_demand_load("glCreateShaderProgramv");
+	return glad_glCreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY glad_on_demand_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)glad_on_demand_load("glCreateTextures");
+	glad_glCreateTextures(target, n, textures);
+}
+static void APIENTRY glad_on_demand_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_on_demand_load("glCreateTransformFeedbacks");
+	glad_glCreateTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_on_demand_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)glad_on_demand_load("glCreateVertexArrays");
+	glad_glCreateVertexArrays(n, arrays);
+}
+static void APIENTRY glad_on_demand_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)glad_on_demand_load("glCullFace");
+	glad_glCullFace(mode);
+}
+static void APIENTRY glad_on_demand_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)glad_on_demand_load("glDebugMessageCallback");
+	glad_glDebugMessageCallback(callback, userParam);
+}
+static void APIENTRY glad_on_demand_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)glad_on_demand_load("glDebugMessageControl");
+	glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_on_demand_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)glad_on_demand_load("glDebugMessageInsert");
+	glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_on_demand_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_on_demand_load("glDeleteBuffers");
+	glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_on_demand_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_on_demand_load("glDeleteFramebuffers");
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_on_demand_glDeleteLists(GLuint list, GLsizei range) {
+	glad_glDeleteLists = (PFNGLDELETELISTSPROC)glad_on_demand_load("glDeleteLists");
+	glad_glDeleteLists(list, range);
+}
+static void APIENTRY glad_on_demand_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_on_demand_load("glDeleteProgram");
+	glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_on_demand_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)glad_on_demand_load("glDeleteProgramPipelines");
+	glad_glDeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_on_demand_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_on_demand_load("glDeleteQueries");
+	glad_glDeleteQueries(n, ids);
+}
+static void APIENTRY glad_on_demand_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_on_demand_load("glDeleteRenderbuffers");
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_on_demand_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_on_demand_load("glDeleteSamplers");
+	glad_glDeleteSamplers(count, samplers);
+}
+static void APIENTRY glad_on_demand_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)glad_on_demand_load("glDeleteShader");
+	glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_on_demand_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)glad_on_demand_load("glDeleteSync");
+	glad_glDeleteSync(sync);
+}
+static void APIENTRY glad_on_demand_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_on_demand_load("glDeleteTextures");
+	glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_on_demand_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_on_demand_load("glDeleteTransformFeedbacks");
+	glad_glDeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_on_demand_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_on_demand_load("glDeleteVertexArrays");
+	glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_on_demand_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_on_demand_load("glDepthFunc");
+	glad_glDepthFunc(func);
+}
+static void APIENTRY glad_on_demand_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)glad_on_demand_load("glDepthMask");
+	glad_glDepthMask(flag);
+}
+static void APIENTRY glad_on_demand_glDepthRange(GLclampd near_val, GLclampd far_val) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_on_demand_load("glDepthRange");
+	glad_glDepthRange(near_val, far_val);
+}
+static void APIENTRY glad_on_demand_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)glad_on_demand_load("glDepthRangeArrayv");
+	glad_glDepthRangeArrayv(first, count, v);
+}
+static void APIENTRY glad_on_demand_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)glad_on_demand_load("glDepthRangeIndexed");
+	glad_glDepthRangeIndexed(index, n, f);
+}
+static void APIENTRY glad_on_demand_glDepthRangef(GLfloat n, GLfloat f) {
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)glad_on_demand_load("glDepthRangef");
+	glad_glDepthRangef(n, f);
+}
+static void APIENTRY glad_on_demand_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)glad_on_demand_load("glDetachShader");
+	glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_on_demand_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)glad_on_demand_load("glDisable");
+	glad_glDisable(cap);
+}
+static void APIENTRY glad_on_demand_glDisableClientState(GLenum cap) {
+	glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)glad_on_demand_load("glDisableClientState");
+	glad_glDisableClientState(cap);
+}
+static void APIENTRY glad_on_demand_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_on_demand_load("glDisableVertexArrayAttrib");
+	glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_on_demand_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_on_demand_load("glDisableVertexAttribArray");
+	glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_on_demand_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)glad_on_demand_load("glDisablei");
+	glad_glDisablei(target, index);
+}
+static void APIENTRY glad_on_demand_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glad_on_demand_load("glDispatchCompute");
+	glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY glad_on_demand_glDispatchComputeIndirect(GLintptr indirect) {
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_on_demand_load("glDispatchComputeIndirect");
+	glad_glDispatchComputeIndirect(indirect);
+}
+static void APIENTRY glad_on_demand_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_on_demand_load("glDrawArrays");
+	glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_on_demand_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glad_on_demand_load("glDrawArraysIndirect");
+	glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY glad_on_demand_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_on_demand_load("glDrawArraysInstanced");
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_on_demand_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_on_demand_load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_on_demand_glDrawBuffer(GLenum mode) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_on_demand_load("glDrawBuffer");
+	glad_glDrawBuffer(mode);
+}
+static void APIENTRY glad_on_demand_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_on_demand_load("glDrawBuffers");
+	glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_on_demand_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_on_demand_load("glDrawElements");
+	glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_on_demand_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_on_demand_load("glDrawElementsBaseVertex");
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_on_demand_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_on_demand_load("glDrawElementsIndirect");
+	glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY glad_on_demand_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_on_demand_load("glDrawElementsInstanced");
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_on_demand_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_on_demand_load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_on_demand_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_on_demand_load("glDrawElementsInstancedBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_on_demand_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_on_demand_load("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_on_demand_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)glad_on_demand_load("glDrawPixels");
+	glad_glDrawPixels(width, height, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_on_demand_load("glDrawRangeElements");
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_on_demand_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_on_demand_load("glDrawRangeElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_on_demand_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_on_demand_load("glDrawTransformFeedback");
+	glad_glDrawTransformFeedback(mode, id);
+}
+static void APIENTRY glad_on_demand_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_on_demand_load("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY glad_on_demand_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_on_demand_load("glDrawTransformFeedbackStream");
+	glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY glad_on_demand_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_on_demand_load("glDrawTransformFeedbackStreamInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY glad_on_demand_glEdgeFlag(GLboolean flag) {
+	glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)glad_on_demand_load("glEdgeFlag");
+	glad_glEdgeFlag(flag);
+}
+static void APIENTRY glad_on_demand_glEdgeFlagPointer(GLsizei stride, const void *ptr) {
+	glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)glad_on_demand_load("glEdgeFlagPointer");
+	glad_glEdgeFlagPointer(stride, ptr);
+}
+static void APIENTRY glad_on_demand_glEdgeFlagv(const GLboolean *flag) {
+	glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)glad_on_demand_load("glEdgeFlagv");
+	glad_glEdgeFlagv(flag);
+}
+static void APIENTRY glad_on_demand_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)glad_on_demand_load("glEnable");
+	glad_glEnable(cap);
+}
+static void APIENTRY glad_on_demand_glEnableClientState(GLenum cap) {
+	glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)glad_on_demand_load("glEnableClientState");
+	glad_glEnableClientState(cap);
+}
+static void APIENTRY glad_on_demand_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_on_demand_load("glEnableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_on_demand_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_on_demand_load("glEnableVertexAttribArray");
+	glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_on_demand_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)glad_on_demand_load("glEnablei");
+	glad_glEnablei(target, index);
+}
+static void APIENTRY glad_on_demand_glEnd(void) {
+	glad_glEnd = (PFNGLENDPROC)glad_on_demand_load("glEnd");
+	glad_glEnd();
+}
+static void APIENTRY glad_on_demand_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_on_demand_load("glEndConditionalRender");
+	glad_glEndConditionalRender();
+}
+static void APIENTRY glad_on_demand_glEndList(void) {
+	glad_glEndList = (PFNGLENDLISTPROC)glad_on_demand_load("glEndList");
+	glad_glEndList();
+}
+static void APIENTRY glad_on_demand_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)glad_on_demand_load("glEndQuery");
+	glad_glEndQuery(target);
+}
+static void APIENTRY glad_on_demand_glEndQueryIndexed(GLenum target, GLuint index) {
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)glad_on_demand_load("glEndQueryIndexed");
+	glad_glEndQueryIndexed(target, index);
+}
+static void APIENTRY glad_on_demand_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_on_demand_load("glEndTransformFeedback");
+	glad_glEndTransformFeedback();
+}
+static void APIENTRY glad_on_demand_glEvalCoord1d(GLdouble u) {
+	glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)glad_on_demand_load("glEvalCoord1d");
+	glad_glEvalCoord1d(u);
+}
+static void APIENTRY glad_on_demand_glEvalCoord1dv(const GLdouble *u) {
+	glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)glad_on_demand_load("glEvalCoord1dv");
+	glad_glEvalCoord1dv(u);
+}
+static void APIENTRY glad_on_demand_glEvalCoord1f(GLfloat u) {
+	glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)glad_on_demand_load("glEvalCoord1f");
+	glad_glEvalCoord1f(u);
+}
+static void APIENTRY glad_on_demand_glEvalCoord1fv(const GLfloat *u) {
+	glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)glad_on_demand_load("glEvalCoord1fv");
+	glad_glEvalCoord1fv(u);
+}
+static void APIENTRY glad_on_demand_glEvalCoord2d(GLdouble u, GLdouble v) {
+	glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)glad_on_demand_load("glEvalCoord2d");
+	glad_glEvalCoord2d(u, v);
+}
+static void APIENTRY glad_on_demand_glEvalCoord2dv(const GLdouble *u) {
+	glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)glad_on_demand_load("glEvalCoord2dv");
+	glad_glEvalCoord2dv(u);
+}
+static void APIENTRY glad_on_demand_glEvalCoord2f(GLfloat u, GLfloat v) {
+	glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)glad_on_demand_load("glEvalCoord2f");
+	glad_glEvalCoord2f(u, v);
+}
+static void APIENTRY glad_on_demand_glEvalCoord2fv(const GLfloat *u) {
+	glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)glad_on_demand_load("glEvalCoord2fv");
+	glad_glEvalCoord2fv(u);
+}
+static void APIENTRY glad_on_demand_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)glad_on_demand_load("glEvalMesh1");
+	glad_glEvalMesh1(mode, i1, i2);
+}
+static void APIENTRY glad_on_demand_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)glad_on_demand_load("glEvalMesh2");
+	glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+static void APIENTRY glad_on_demand_glEvalPoint1(GLint i) {
+	glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)glad_on_demand_load("glEvalPoint1");
+	glad_glEvalPoint1(i);
+}
+static void APIENTRY glad_on_demand_glEvalPoint2(GLint i, GLint j) {
+	glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)glad_on_demand_load("glEvalPoint2");
+	glad_glEvalPoint2(i, j);
+}
+static void APIENTRY glad_on_demand_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)glad_on_demand_load("glFeedbackBuffer");
+	glad_glFeedbackBuffer(size, type, buffer);
+}
+static GLsync APIENTRY glad_on_demand_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)glad_on_demand_load("glFenceSync");
+	return glad_glFenceSync(condition, flags);
+}
+static void APIENTRY glad_on_demand_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)glad_on_demand_load("glFinish");
+	glad_glFinish();
+}
+static void APIENTRY glad_on_demand_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)glad_on_demand_load("glFlush");
+	glad_glFlush();
+}
+static void APIENTRY glad_on_demand_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_on_demand_load("glFlushMappedBufferRange");
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_on_demand_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_on_demand_load("glFlushMappedNamedBufferRange");
+	glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void APIENTRY glad_on_demand_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)glad_on_demand_load("glFogCoordPointer");
+	glad_glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY glad_on_demand_glFogCoordd(GLdouble coord) {
+	glad_glFogCoordd = (PFNGLFOGCOORDDPROC)glad_on_demand_load("glFogCoordd");
+	glad_glFogCoordd(coord);
+}
+static void APIENTRY glad_on_demand_glFogCoorddv(const GLdouble *coord) {
+	glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)glad_on_demand_load("glFogCoorddv");
+	glad_glFogCoorddv(coord);
+}
+static void APIENTRY glad_on_demand_glFogCoordf(GLfloat coord) {
+	glad_glFogCoordf = (PFNGLFOGCOORDFPROC)glad_on_demand_load("glFogCoordf");
+	glad_glFogCoordf(coord);
+}
+static void APIENTRY glad_on_demand_glFogCoordfv(const GLfloat *coord) {
+	glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)glad_on_demand_load("glFogCoordfv");
+	glad_glFogCoordfv(coord);
+}
+static void APIENTRY glad_on_demand_glFogf(GLenum pname, GLfloat param) {
+	glad_glFogf = (PFNGLFOGFPROC)glad_on_demand_load("glFogf");
+	glad_glFogf(pname, param);
+}
+static void APIENTRY glad_on_demand_glFogfv(GLenum pname, const GLfloat *params) {
+	glad_glFogfv = (PFNGLFOGFVPROC)glad_on_demand_load("glFogfv");
+	glad_glFogfv(pname, params);
+}
+static void APIENTRY glad_on_demand_glFogi(GLenum pname, GLint param) {
+	glad_glFogi = (PFNGLFOGIPROC)glad_on_demand_load("glFogi");
+	glad_glFogi(pname, param);
+}
+static void APIENTRY glad_on_demand_glFogiv(GLenum pname, const GLint *params) {
+	glad_glFogiv = (PFNGLFOGIVPROC)glad_on_demand_load("glFogiv");
+	glad_glFogiv(pname, params);
+}
+static void APIENTRY glad_on_demand_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)glad_on_demand_load("glFramebufferParameteri");
+	glad_glFramebufferParameteri(target, pname, param);
+}
+static void APIENTRY glad_on_demand_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_on_demand_load("glFramebufferRenderbuffer");
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_on_demand_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_on_demand_load("glFramebufferTexture");
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_on_demand_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_on_demand_load("glFramebufferTexture1D");
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_on_demand_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_on_demand_load("glFramebufferTexture2D");
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_on_demand_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_on_demand_load("glFramebufferTexture3D");
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_on_demand_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_on_demand_load("glFramebufferTextureLayer");
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void APIENTRY glad_on_demand_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)glad_on_demand_load("glFrontFace");
+	glad_glFrontFace(mode);
+}
+static void APIENTRY glad_on_demand_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val) {
+	glad_glFrustum = (PFNGLFRUSTUMPROC)glad_on_demand_load("glFrustum");
+	glad_glFrustum(left, right, bottom, top, near_val, far_val);
+}
+static void APIENTRY glad_on_demand_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_on_demand_load("glGenBuffers");
+	glad_glGenBuffers(n, buffers);
+}
+static void APIENTRY glad_on_demand_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_on_demand_load("glGenFramebuffers");
+	glad_glGenFramebuffers(n, framebuffers);
+}
+static GLuint APIENTRY glad_on_demand_glGenLists(GLsizei range) {
+	glad_glGenLists = (PFNGLGENLISTSPROC)glad_on_demand_load("glGenLists");
+	return glad_glGenLists(range);
+}
+static void APIENTRY glad_on_demand_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)glad_on_demand_load("glGenProgramPipelines");
+	glad_glGenProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_on_demand_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)glad_on_demand_load("glGenQueries");
+	glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_on_demand_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_on_demand_load("glGenRenderbuffers");
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_on_demand_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_on_demand_load("glGenSamplers");
+	glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_on_demand_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)glad_on_demand_load("glGenTextures");
+	glad_glGenTextures(n, textures);
+}
+static void APIENTRY glad_on_demand_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)glad_on_demand_load("glGenTransformFeedbacks");
+	glad_glGenTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_on_demand_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_on_demand_load("glGenVertexArrays");
+	glad_glGenVertexArrays(n, arrays);
+}
+static void APIENTRY glad_on_demand_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_on_demand_load("glGenerateMipmap");
+	glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_on_demand_glGenerateTextureMipmap(GLuint texture) {
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)glad_on_demand_load("glGenerateTextureMipmap");
+	glad_glGenerateTextureMipmap(texture);
+}
+static void APIENTRY glad_on_demand_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_on_demand_load("glGetActiveAtomicCounterBufferiv");
+	glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_on_demand_load("glGetActiveAttrib");
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_on_demand_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)glad_on_demand_load("glGetActiveSubroutineName");
+	glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_on_demand_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_on_demand_load("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_on_demand_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_on_demand_load("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY glad_on_demand_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_on_demand_load("glGetActiveUniform");
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_on_demand_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_on_demand_load("glGetActiveUniformBlockName");
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_on_demand_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_on_demand_load("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_on_demand_load("glGetActiveUniformName");
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static void APIENTRY glad_on_demand_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_on_demand_load("glGetActiveUniformsiv");
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_on_demand_load("glGetAttachedShaders");
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_on_demand_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_on_demand_load("glGetAttribLocation");
+	return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_on_demand_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_on_demand_load("glGetBooleani_v");
+	glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_on_demand_glGetBooleanv(GLenum pname, GLboolean *params) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_on_demand_load("glGetBooleanv");
+	glad_glGetBooleanv(pname, params);
+}
+static void APIENTRY glad_on_demand_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_on_demand_load("glGetBufferParameteri64v");
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_on_demand_load("glGetBufferParameteriv");
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_on_demand_load("glGetBufferPointerv");
+	glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_on_demand_load("glGetBufferSubData");
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_on_demand_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)glad_on_demand_load("glGetClipPlane");
+	glad_glGetClipPlane(plane, equation);
+}
+static void APIENTRY glad_on_demand_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_on_demand_load("glGetCompressedTexImage");
+	glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_on_demand_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_on_demand_load("glGetCompressedTextureImage");
+	glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void APIENTRY glad_on_demand_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glad_on_demand_load("glGetCompressedTextureSubImage");
+	glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLuint APIENTRY glad_on_demand_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)glad_on_demand_load("glGetDebugMessageLog");
+	return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_on_demand_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)glad_on_demand_load("glGetDoublei_v");
+	glad_glGetDoublei_v(target, index, data);
+}
+static void APIENTRY glad_on_demand_glGetDoublev(GLenum pname, GLdouble *params) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_on_demand_load("glGetDoublev");
+	glad_glGetDoublev(pname, params);
+}
+static GLenum APIENTRY glad_on_demand_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)glad_on_demand_load("glGetError");
+	return glad_glGetError();
+}
+static void APIENTRY glad_on_demand_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)glad_on_demand_load("glGetFloati_v");
+	glad_glGetFloati_v(target, index, data);
+}
+static void APIENTRY glad_on_demand_glGetFloatv(GLenum pname, GLfloat *params) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)glad_on_demand_load("glGetFloatv");
+	glad_glGetFloatv(pname, params);
+}
+static GLint APIENTRY glad_on_demand_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_on_demand_load("glGetFragDataIndex");
+	return glad_glGetFragDataIndex(program, name);
+}
+static GLint APIENTRY glad_on_demand_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_on_demand_load("glGetFragDataLocation");
+	return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_on_demand_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_on_demand_load("glGetFramebufferAttachmentParameteriv");
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_on_demand_load("glGetFramebufferParameteriv");
+	glad_glGetFramebufferParameteriv(target, pname, params);
+}
+static GLenum APIENTRY glad_on_demand_glGetGraphicsResetStatus(void) {
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)glad_on_demand_load("glGetGraphicsResetStatus");
+	return glad_glGetGraphicsResetStatus();
+}
+static void APIENTRY glad_on_demand_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_on_demand_load("glGetInteger64i_v");
+	glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_on_demand_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_on_demand_load("glGetInteger64v");
+	glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_on_demand_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_on_demand_load("glGetIntegeri_v");
+	glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_on_demand_glGetIntegerv(GLenum pname, GLint *params) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_on_demand_load("glGetIntegerv");
+	glad_glGetIntegerv(pname, params);
+}
+static void APIENTRY glad_on_demand_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)glad_on_demand_load("glGetInternalformati64v");
+	glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_on_demand_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)glad_on_demand_load("glGetInternalformativ");
+	glad_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_on_demand_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)glad_on_demand_load("glGetLightfv");
+	glad_glGetLightfv(light, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)glad_on_demand_load("glGetLightiv");
+	glad_glGetLightiv(light, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	glad_glGetMapdv = (PFNGLGETMAPDVPROC)glad_on_demand_load("glGetMapdv");
+	glad_glGetMapdv(target, query, v);
+}
+static void APIENTRY glad_on_demand_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	glad_glGetMapfv = (PFNGLGETMAPFVPROC)glad_on_demand_load("glGetMapfv");
+	glad_glGetMapfv(target, query, v);
+}
+static void APIENTRY glad_on_demand_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	glad_glGetMapiv = (PFNGLGETMAPIVPROC)glad_on_demand_load("glGetMapiv");
+	glad_glGetMapiv(target, query, v);
+}
+static void APIENTRY glad_on_demand_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)glad_on_demand_load("glGetMaterialfv");
+	glad_glGetMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)glad_on_demand_load("glGetMaterialiv");
+	glad_glGetMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_on_demand_load("glGetMultisamplefv");
+	glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_on_demand_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_on_demand_load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_on_demand_load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_on_demand_load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_on_demand_load("glGetNamedBufferSubData");
+	glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_on_demand_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_on_demand_load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_on_demand_load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void APIENTRY glad_on_demand_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_on_demand_load("glGetNamedRenderbufferParameteriv");
+	glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)glad_on_demand_load("glGetObjectLabel");
+	glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_on_demand_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)glad_on_demand_load("glGetObjectPtrLabel");
+	glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY glad_on_demand_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)glad_on_demand_load("glGetPixelMapfv");
+	glad_glGetPixelMapfv(map, values);
+}
+static void APIENTRY glad_on_demand_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)glad_on_demand_load("glGetPixelMapuiv");
+	glad_glGetPixelMapuiv(map, values);
+}
+static void APIENTRY glad_on_demand_glGetPixelMapusv(GLenum map, GLushort *values) {
+	glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)glad_on_demand_load("glGetPixelMapusv");
+	glad_glGetPixelMapusv(map, values);
+}
+static void APIENTRY glad_on_demand_glGetPointerv(GLenum pname, void **params) {
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)glad_on_demand_load("glGetPointerv");
+	glad_glGetPointerv(pname, params);
+}
+static void APIENTRY glad_on_demand_glGetPolygonStipple(GLubyte *mask) {
+	glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)glad_on_demand_load("glGetPolygonStipple");
+	glad_glGetPolygonStipple(mask);
+}
+static void APIENTRY glad_on_demand_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glad_on_demand_load("glGetProgramBinary");
+	glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_on_demand_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_on_demand_load("glGetProgramInfoLog");
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_on_demand_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)glad_on_demand_load("glGetProgramInterfaceiv");
+	glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_on_demand_load("glGetProgramPipelineInfoLog");
+	glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY glad_on_demand_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)glad_on_demand_load("glGetProgramPipelineiv");
+	glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+static GLuint APIENTRY glad_on_demand_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_on_demand_load("glGetProgramResourceIndex");
+	return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+static GLint APIENTRY glad_on_demand_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_on_demand_load("glGetProgramResourceLocation");
+	return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY glad_on_demand_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_on_demand_load("glGetProgramResourceLocationIndex");
+	return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY glad_on_demand_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)glad_on_demand_load("glGetProgramResourceName");
+	glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY glad_on_demand_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)glad_on_demand_load("glGetProgramResourceiv");
+	glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+static void APIENTRY glad_on_demand_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)glad_on_demand_load("glGetProgramStageiv");
+	glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY glad_on_demand_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_on_demand_load("glGetProgramiv");
+	glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_on_demand_load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_on_demand_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_on_demand_load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_on_demand_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_on_demand_load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_on_demand_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_on_demand_load("glGetQueryBufferObjectuiv");
+	glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_on_demand_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)glad_on_demand_load("glGetQueryIndexediv");
+	glad_glGetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_on_demand_load("glGetQueryObjecti64v");
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_on_demand_load("glGetQueryObjectiv");
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_on_demand_load("glGetQueryObjectui64v");
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_on_demand_load("glGetQueryObjectuiv");
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_on_demand_load("glGetQueryiv");
+	glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_on_demand_load("glGetRenderbufferParameteriv");
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_on_demand_load("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_on_demand_load("glGetSamplerParameterIuiv");
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_on_demand_load("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_on_demand_load("glGetSamplerParameteriv");
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_on_demand_load("glGetShaderInfoLog");
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_on_demand_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)glad_on_demand_load("glGetShaderPrecisionFormat");
+	glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY glad_on_demand_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_on_demand_load("glGetShaderSource");
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static void APIENTRY glad_on_demand_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_on_demand_load("glGetShaderiv");
+	glad_glGetShaderiv(shader, pname, params);
+}
+static const GLubyte * APIENTRY glad_on_demand_glGetString(GLenum name) {
+	glad_glGetString = (PFNGLGETSTRINGPROC)glad_on_demand_load("glGetString");
+	return glad_glGetString(name);
+}
+static const GLubyte * APIENTRY glad_on_demand_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)glad_on_demand_load("glGetStringi");
+	return glad_glGetStringi(name, index);
+}
+static GLuint APIENTRY glad_on_demand_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)glad_on_demand_load("glGetSubroutineIndex");
+	return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+static GLint APIENTRY glad_on_demand_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_on_demand_load("glGetSubroutineUniformLocation");
+	return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static void APIENTRY glad_on_demand_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_on_demand_load("glGetSynciv");
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_on_demand_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)glad_on_demand_load("glGetTexEnvfv");
+	glad_glGetTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)glad_on_demand_load("glGetTexEnviv");
+	glad_glGetTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)glad_on_demand_load("glGetTexGendv");
+	glad_glGetTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)glad_on_demand_load("glGetTexGenfv");
+	glad_glGetTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)glad_on_demand_load("glGetTexGeniv");
+	glad_glGetTexGeniv(coord, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_on_demand_load("glGetTexImage");
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_on_demand_load("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_on_demand_load("glGetTexLevelParameteriv");
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_on_demand_load("glGetTexParameterIiv");
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_on_demand_load("glGetTexParameterIuiv");
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_on_demand_load("glGetTexParameterfv");
+	glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_on_demand_load("glGetTexParameteriv");
+	glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)glad_on_demand_load("glGetTextureImage");
+	glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_on_demand_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_on_demand_load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_on_demand_load("glGetTextureLevelParameteriv");
+	glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)glad_on_demand_load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_on_demand_load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)glad_on_demand_load("glGetTextureParameterfv");
+	glad_glGetTextureParameterfv(texture, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)glad_on_demand_load("glGetTextureParameteriv");
+	glad_glGetTextureParameteriv(texture, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)glad_on_demand_load("glGetTextureSubImage");
+	glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_on_demand_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_on_demand_load("glGetTransformFeedbackVarying");
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_on_demand_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glad_on_demand_load("glGetTransformFeedbacki64_v");
+	glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+static void APIENTRY glad_on_demand_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)glad_on_demand_load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+static void APIENTRY glad_on_demand_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_on_demand_load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+static GLuint APIENTRY glad_on_demand_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_on_demand_load("glGetUniformBlockIndex");
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_on_demand_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_on_demand_load("glGetUniformIndices");
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static GLint APIENTRY glad_on_demand_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_on_demand_load("glGetUniformLocation");
+	return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_on_demand_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_on_demand_load("glGetUniformSubroutineuiv");
+	glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY glad_on_demand_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)glad_on_demand_load("glGetUniformdv");
+	glad_glGetUniformdv(program, location, params);
+}
+static void APIENTRY glad_on_demand_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_on_demand_load("glGetUniformfv");
+	glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_on_demand_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_on_demand_load("glGetUniformiv");
+	glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_on_demand_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_on_demand_load("glGetUniformuiv");
+	glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_on_demand_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_on_demand_load("glGetVertexArrayIndexed64iv");
+	glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_on_demand_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_on_demand_load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_on_demand_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)glad_on_demand_load("glGetVertexArrayiv");
+	glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_on_demand_load("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_on_demand_load("glGetVertexAttribIuiv");
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)glad_on_demand_load("glGetVertexAttribLdv");
+	glad_glGetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_on_demand_load("glGetVertexAttribPointerv");
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_on_demand_load("glGetVertexAttribdv");
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_on_demand_load("glGetVertexAttribfv");
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_on_demand_load("glGetVertexAttribiv");
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_on_demand_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)glad_on_demand_load("glGetnColorTable");
+	glad_glGetnColorTable(target, format, type, bufSize, table);
+}
+static void APIENTRY glad_on_demand_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glad_on_demand_load("glGetnCompressedTexImage");
+	glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+static void APIENTRY glad_on_demand_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)glad_on_demand_load("glGetnConvolutionFilter");
+	glad_glGetnConvolutionFilter(target, format, type, bufSize, image);
+}
+static void APIENTRY glad_on_demand_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)glad_on_demand_load("glGetnHistogram");
+	glad_glGetnHistogram(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY glad_on_demand_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)glad_on_demand_load("glGetnMapdv");
+	glad_glGetnMapdv(target, query, bufSize, v);
+}
+static void APIENTRY glad_on_demand_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)glad_on_demand_load("glGetnMapfv");
+	glad_glGetnMapfv(target, query, bufSize, v);
+}
+static void APIENTRY glad_on_demand_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)glad_on_demand_load("glGetnMapiv");
+	glad_glGetnMapiv(target, query, bufSize, v);
+}
+static void APIENTRY glad_on_demand_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)glad_on_demand_load("glGetnMinmax");
+	glad_glGetnMinmax(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY glad_on_demand_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)glad_on_demand_load("glGetnPixelMapfv");
+	glad_glGetnPixelMapfv(map, bufSize, values);
+}
+static void APIENTRY glad_on_demand_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)glad_on_demand_load("glGetnPixelMapuiv");
+	glad_glGetnPixelMapuiv(map, bufSize, values);
+}
+static void APIENTRY glad_on_demand_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)glad_on_demand_load("glGetnPixelMapusv");
+	glad_glGetnPixelMapusv(map, bufSize, values);
+}
+static void APIENTRY glad_on_demand_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)glad_on_demand_load("glGetnPolygonStipple");
+	glad_glGetnPolygonStipple(bufSize, pattern);
+}
+static void APIENTRY glad_on_demand_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)glad_on_demand_load("glGetnSeparableFilter");
+	glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+static void APIENTRY glad_on_demand_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)glad_on_demand_load("glGetnTexImage");
+	glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_on_demand_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)glad_on_demand_load("glGetnUniformdv");
+	glad_glGetnUniformdv(program, location, bufSize, params);
+}
+static void APIENTRY glad_on_demand_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)glad_on_demand_load("glGetnUniformfv");
+	glad_glGetnUniformfv(program, location, bufSize, params);
+}
+static void APIENTRY glad_on_demand_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)glad_on_demand_load("glGetnUniformiv");
+	glad_glGetnUniformiv(program, location, bufSize, params);
+}
+static void APIENTRY glad_on_demand_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)glad_on_demand_load("glGetnUniformuiv");
+	glad_glGetnUniformuiv(program, location, bufSize, params);
+}
+static void APIENTRY glad_on_demand_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)glad_on_demand_load("glHint");
+	glad_glHint(target, mode);
+}
+static void APIENTRY glad_on_demand_glIndexMask(GLuint mask) {
+	glad_glIndexMask = (PFNGLINDEXMASKPROC)glad_on_demand_load("glIndexMask");
+	glad_glIndexMask(mask);
+}
+static void APIENTRY glad_on_demand_glIndexPointer(GLenum type, GLsizei stride, const void *ptr) {
+	glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)glad_on_demand_load("glIndexPointer");
+	glad_glIndexPointer(type, stride, ptr);
+}
+static void APIENTRY glad_on_demand_glIndexd(GLdouble c) {
+	glad_glIndexd = (PFNGLINDEXDPROC)glad_on_demand_load("glIndexd");
+	glad_glIndexd(c);
+}
+static void APIENTRY glad_on_demand_glIndexdv(const GLdouble *c) {
+	glad_glIndexdv = (PFNGLINDEXDVPROC)glad_on_demand_load("glIndexdv");
+	glad_glIndexdv(c);
+}
+static void APIENTRY glad_on_demand_glIndexf(GLfloat c) {
+	glad_glIndexf = (PFNGLINDEXFPROC)glad_on_demand_load("glIndexf");
+	glad_glIndexf(c);
+}
+static void APIENTRY glad_on_demand_glIndexfv(const GLfloat *c) {
+	glad_glIndexfv = (PFNGLINDEXFVPROC)glad_on_demand_load("glIndexfv");
+	glad_glIndexfv(c);
+}
+static void APIENTRY glad_on_demand_glIndexi(GLint c) {
+	glad_glIndexi = (PFNGLINDEXIPROC)glad_on_demand_load("glIndexi");
+	glad_glIndexi(c);
+}
+static void APIENTRY glad_on_demand_glIndexiv(const GLint *c) {
+	glad_glIndexiv = (PFNGLINDEXIVPROC)glad_on_demand_load("glIndexiv");
+	glad_glIndexiv(c);
+}
+static void APIENTRY glad_on_demand_glIndexs(GLshort c) {
+	glad_glIndexs = (PFNGLINDEXSPROC)glad_on_demand_load("glIndexs");
+	glad_glIndexs(c);
+}
+static void APIENTRY glad_on_demand_glIndexsv(const GLshort *c) {
+	glad_glIndexsv = (PFNGLINDEXSVPROC)glad_on_demand_load("glIndexsv");
+	glad_glIndexsv(c);
+}
+static void APIENTRY glad_on_demand_glIndexub(GLubyte c) {
+	glad_glIndexub = (PFNGLINDEXUBPROC)glad_on_demand_load("glIndexub");
+	glad_glIndexub(c);
+}
+static void APIENTRY glad_on_demand_glIndexubv(const GLubyte *c) {
+	glad_glIndexubv = (PFNGLINDEXUBVPROC)glad_on_demand_load("glIndexubv");
+	glad_glIndexubv(c);
+}
+static void APIENTRY glad_on_demand_glInitNames(void) {
+	glad_glInitNames = (PFNGLINITNAMESPROC)glad_on_demand_load("glInitNames");
+	glad_glInitNames();
+}
+static void APIENTRY glad_on_demand_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)glad_on_demand_load("glInterleavedArrays");
+	glad_glInterleavedArrays(format, stride, pointer);
+}
+static void APIENTRY glad_on_demand_glInvalidateBufferData(GLuint buffer) {
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)glad_on_demand_load("glInvalidateBufferData");
+	glad_glInvalidateBufferData(buffer);
+}
+static void APIENTRY glad_on_demand_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_on_demand_load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY glad_on_demand_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)glad_on_demand_load("glInvalidateFramebuffer");
+	glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY glad_on_demand_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_on_demand_load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY glad_on_demand_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_on_demand_load("glInvalidateNamedFramebufferSubData");
+	glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_on_demand_load("glInvalidateSubFramebuffer");
+	glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glInvalidateTexImage(GLuint texture, GLint level) {
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)glad_on_demand_load("glInvalidateTexImage");
+	glad_glInvalidateTexImage(texture, level);
+}
+static void APIENTRY glad_on_demand_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)glad_on_demand_load("glInvalidateTexSubImage");
+	glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static GLboolean APIENTRY glad_on_demand_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)glad_on_demand_load("glIsBuffer");
+	return glad_glIsBuffer(buffer);
+}
+static GLboolean APIENTRY glad_on_demand_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)glad_on_demand_load("glIsEnabled");
+	return glad_glIsEnabled(cap);
+}
+static GLboolean APIENTRY glad_on_demand_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_on_demand_load("glIsEnabledi");
+	return glad_glIsEnabledi(target, index);
+}
+static GLboolean APIENTRY glad_on_demand_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_on_demand_load("glIsFramebuffer");
+	return glad_glIsFramebuffer(framebuffer);
+}
+static GLboolean APIENTRY glad_on_demand_glIsList(GLuint list) {
+	glad_glIsList = (PFNGLISLISTPROC)glad_on_demand_load("glIsList");
+	return glad_glIsList(list);
+}
+static GLboolean APIENTRY glad_on_demand_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)glad_on_demand_load("glIsProgram");
+	return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_on_demand_glIsProgramPipeline(GLuint pipeline) {
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)glad_on_demand_load("glIsProgramPipeline");
+	return glad_glIsProgramPipeline(pipeline);
+}
+static GLboolean APIENTRY glad_on_demand_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)glad_on_demand_load("glIsQuery");
+	return glad_glIsQuery(id);
+}
+static GLboolean APIENTRY glad_on_demand_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_on_demand_load("glIsRenderbuffer");
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+static GLboolean APIENTRY glad_on_demand_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)glad_on_demand_load("glIsSampler");
+	return glad_glIsSampler(sampler);
+}
+static GLboolean APIENTRY glad_on_demand_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)glad_on_demand_load("glIsShader");
+	return glad_glIsShader(shader);
+}
+static GLboolean APIENTRY glad_on_demand_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)glad_on_demand_load("glIsSync");
+	return glad_glIsSync(sync);
+}
+static GLboolean APIENTRY glad_on_demand_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)glad_on_demand_load("glIsTexture");
+	return glad_glIsTexture(texture);
+}
+static GLboolean APIENTRY glad_on_demand_glIsTransformFeedback(GLuint id) {
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)glad_on_demand_load("glIsTransformFeedback");
+	return glad_glIsTransformFeedback(id);
+}
+static GLboolean APIENTRY glad_on_demand_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_on_demand_load("glIsVertexArray");
+	return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_on_demand_glLightModelf(GLenum pname, GLfloat param) {
+	glad_glLightModelf = (PFNGLLIGHTMODELFPROC)glad_on_demand_load("glLightModelf");
+	glad_glLightModelf(pname, param);
+}
+static void APIENTRY glad_on_demand_glLightModelfv(GLenum pname, const GLfloat *params) {
+	glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)glad_on_demand_load("glLightModelfv");
+	glad_glLightModelfv(pname, params);
+}
+static void APIENTRY glad_on_demand_glLightModeli(GLenum pname, GLint param) {
+	glad_glLightModeli = (PFNGLLIGHTMODELIPROC)glad_on_demand_load("glLightModeli");
+	glad_glLightModeli(pname, param);
+}
+static void APIENTRY glad_on_demand_glLightModeliv(GLenum pname, const GLint *params) {
+	glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)glad_on_demand_load("glLightModeliv");
+	glad_glLightModeliv(pname, params);
+}
+static void APIENTRY glad_on_demand_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	glad_glLightf = (PFNGLLIGHTFPROC)glad_on_demand_load("glLightf");
+	glad_glLightf(light, pname, param);
+}
+static void APIENTRY glad_on_demand_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_glLightfv = (PFNGLLIGHTFVPROC)glad_on_demand_load("glLightfv");
+	glad_glLightfv(light, pname, params);
+}
+static void APIENTRY glad_on_demand_glLighti(GLenum light, GLenum pname, GLint param) {
+	glad_glLighti = (PFNGLLIGHTIPROC)glad_on_demand_load("glLighti");
+	glad_glLighti(light, pname, param);
+}
+static void APIENTRY glad_on_demand_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	glad_glLightiv = (PFNGLLIGHTIVPROC)glad_on_demand_load("glLightiv");
+	glad_glLightiv(light, pname, params);
+}
+static void APIENTRY glad_on_demand_glLineStipple(GLint factor, GLushort pattern) {
+	glad_glLineStipple = (PFNGLLINESTIPPLEPROC)glad_on_demand_load("glLineStipple");
+	glad_glLineStipple(factor, pattern);
+}
+static void APIENTRY glad_on_demand_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)glad_on_demand_load("glLineWidth");
+	glad_glLineWidth(width);
+}
+static void APIENTRY glad_on_demand_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_on_demand_load("glLinkProgram");
+	glad_glLinkProgram(program);
+}
+static void APIENTRY glad_on_demand_glListBase(GLuint base) {
+	glad_glListBase = (PFNGLLISTBASEPROC)glad_on_demand_load("glListBase");
+	glad_glListBase(base);
+}
+static void APIENTRY glad_on_demand_glLoadIdentity(void) {
+	glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)glad_on_demand_load("glLoadIdentity");
+	glad_glLoadIdentity();
+}
+static void APIENTRY glad_on_demand_glLoadMatrixd(const GLdouble *m) {
+	glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)glad_on_demand_load("glLoadMatrixd");
+	glad_glLoadMatrixd(m);
+}
+static void APIENTRY glad_on_demand_glLoadMatrixf(const GLfloat *m) {
+	glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)glad_on_demand_load("glLoadMatrixf");
+	glad_glLoadMatrixf(m);
+}
+static void APIENTRY glad_on_demand_glLoadName(GLuint name) {
+	glad_glLoadName = (PFNGLLOADNAMEPROC)glad_on_demand_load("glLoadName");
+	glad_glLoadName(name);
+}
+static void APIENTRY glad_on_demand_glLoadTransposeMatrixd(const GLdouble *m) {
+	glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)glad_on_demand_load("glLoadTransposeMatrixd");
+	glad_glLoadTransposeMatrixd(m);
+}
+static void APIENTRY glad_on_demand_glLoadTransposeMatrixf(const GLfloat *m) {
+	glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)glad_on_demand_load("glLoadTransposeMatrixf");
+	glad_glLoadTransposeMatrixf(m);
+}
+static void APIENTRY glad_on_demand_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)glad_on_demand_load("glLogicOp");
+	glad_glLogicOp(opcode);
+}
+static void APIENTRY glad_on_demand_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_glMap1d = (PFNGLMAP1DPROC)glad_on_demand_load("glMap1d");
+	glad_glMap1d(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_on_demand_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_glMap1f = (PFNGLMAP1FPROC)glad_on_demand_load("glMap1f");
+	glad_glMap1f(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_on_demand_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_glMap2d = (PFNGLMAP2DPROC)glad_on_demand_load("glMap2d");
+	glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_on_demand_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_glMap2f = (PFNGLMAP2FPROC)glad_on_demand_load("glMap2f");
+	glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void * APIENTRY glad_on_demand_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_on_demand_load("glMapBuffer");
+	return glad_glMapBuffer(target, access);
+}
+static void * APIENTRY glad_on_demand_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_on_demand_load("glMapBufferRange");
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_on_demand_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)glad_on_demand_load("glMapGrid1d");
+	glad_glMapGrid1d(un, u1, u2);
+}
+static void APIENTRY glad_on_demand_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)glad_on_demand_load("glMapGrid1f");
+	glad_glMapGrid1f(un, u1, u2);
+}
+static void APIENTRY glad_on_demand_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)glad_on_demand_load("glMapGrid2d");
+	glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_on_demand_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)glad_on_demand_load("glMapGrid2f");
+	glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+static void * APIENTRY glad_on_demand_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)glad_on_demand_load("glMapNamedBuffer");
+	return glad_glMapNamedBuffer(buffer, access);
+}
+static void * APIENTRY glad_on_demand_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)glad_on_demand_load("glMapNamedBufferRange");
+	return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+static void APIENTRY glad_on_demand_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	glad_glMaterialf = (PFNGLMATERIALFPROC)glad_on_demand_load("glMaterialf");
+	glad_glMaterialf(face, pname, param);
+}
+static void APIENTRY glad_on_demand_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_glMaterialfv = (PFNGLMATERIALFVPROC)glad_on_demand_load("glMaterialfv");
+	glad_glMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_on_demand_glMateriali(GLenum face, GLenum pname, GLint param) {
+	glad_glMateriali = (PFNGLMATERIALIPROC)glad_on_demand_load("glMateriali");
+	glad_glMateriali(face, pname, param);
+}
+static void APIENTRY glad_on_demand_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	glad_glMaterialiv = (PFNGLMATERIALIVPROC)glad_on_demand_load("glMaterialiv");
+	glad_glMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_on_demand_glMatrixMode(GLenum mode) {
+	glad_glMatrixMode = (PFNGLMATRIXMODEPROC)glad_on_demand_load("glMatrixMode");
+	glad_glMatrixMode(mode);
+}
+static void APIENTRY glad_on_demand_glMaxShaderCompilerThreadsARB(GLuint count) {
+	glad_glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)glad_on_demand_load("glMaxShaderCompilerThreadsARB");
+	glad_glMaxShaderCompilerThreadsARB(count);
+}
+static void APIENTRY glad_on_demand_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glad_on_demand_load("glMaxShaderCompilerThreadsKHR");
+	glad_glMaxShaderCompilerThreadsKHR(count);
+}
+static void APIENTRY glad_on_demand_glMemoryBarrier(GLbitfield barriers) {
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)glad_on_demand_load("glMemoryBarrier");
+	glad_glMemoryBarrier(barriers);
+}
+static void APIENTRY glad_on_demand_glMemoryBarrierByRegion(GLbitfield barriers) {
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)glad_on_demand_load("glMemoryBarrierByRegion");
+	glad_glMemoryBarrierByRegion(barriers);
+}
+static void APIENTRY glad_on_demand_glMinSampleShading(GLfloat value) {
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)glad_on_demand_load("glMinSampleShading");
+	glad_glMinSampleShading(value);
+}
+static void APIENTRY glad_on_demand_glMultMatrixd(const GLdouble *m) {
+	glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)glad_on_demand_load("glMultMatrixd");
+	glad_glMultMatrixd(m);
+}
+static void APIENTRY glad_on_demand_glMultMatrixf(const GLfloat *m) {
+	glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)glad_on_demand_load("glMultMatrixf");
+	glad_glMultMatrixf(m);
+}
+static void APIENTRY glad_on_demand_glMultTransposeMatrixd(const GLdouble *m) {
+	glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)glad_on_demand_load("glMultTransposeMatrixd");
+	glad_glMultTransposeMatrixd(m);
+}
+static void APIENTRY glad_on_demand_glMultTransposeMatrixf(const GLfloat *m) {
+	glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)glad_on_demand_load("glMultTransposeMatrixf");
+	glad_glMultTransposeMatrixf(m);
+}
+static void APIENTRY glad_on_demand_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_on_demand_load("glMultiDrawArrays");
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_on_demand_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_on_demand_load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_on_demand_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)glad_on_demand_load("glMultiDrawArraysIndirectCount");
+	glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY glad_on_demand_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_on_demand_load("glMultiDrawElements");
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_on_demand_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_on_demand_load("glMultiDrawElementsBaseVertex");
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_on_demand_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_on_demand_load("glMultiDrawElementsIndirect");
+	glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_on_demand_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)glad_on_demand_load("glMultiDrawElementsIndirectCount");
+	glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)glad_on_demand_load("glMultiTexCoord1d");
+	glad_glMultiTexCoord1d(target, s);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)glad_on_demand_load("glMultiTexCoord1dv");
+	glad_glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)glad_on_demand_load("glMultiTexCoord1f");
+	glad_glMultiTexCoord1f(target, s);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)glad_on_demand_load("glMultiTexCoord1fv");
+	glad_glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1i(GLenum target, GLint s) {
+	glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)glad_on_demand_load("glMultiTexCoord1i");
+	glad_glMultiTexCoord1i(target, s);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)glad_on_demand_load("glMultiTexCoord1iv");
+	glad_glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1s(GLenum target, GLshort s) {
+	glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)glad_on_demand_load("glMultiTexCoord1s");
+	glad_glMultiTexCoord1s(target, s);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)glad_on_demand_load("glMultiTexCoord1sv");
+	glad_glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)glad_on_demand_load("glMultiTexCoord2d");
+	glad_glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)glad_on_demand_load("glMultiTexCoord2dv");
+	glad_glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)glad_on_demand_load("glMultiTexCoord2f");
+	glad_glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)glad_on_demand_load("glMultiTexCoord2fv");
+	glad_glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)glad_on_demand_load("glMultiTexCoord2i");
+	glad_glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)glad_on_demand_load("glMultiTexCoord2iv");
+	glad_glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)glad_on_demand_load("glMultiTexCoord2s");
+	glad_glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)glad_on_demand_load("glMultiTexCoord2sv");
+	glad_glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)glad_on_demand_load("glMultiTexCoord3d");
+	glad_glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)glad_on_demand_load("glMultiTexCoord3dv");
+	glad_glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)glad_on_demand_load("glMultiTexCoord3f");
+	glad_glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)glad_on_demand_load("glMultiTexCoord3fv");
+	glad_glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)glad_on_demand_load("glMultiTexCoord3i");
+	glad_glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)glad_on_demand_load("glMultiTexCoord3iv");
+	glad_glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)glad_on_demand_load("glMultiTexCoord3s");
+	glad_glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)glad_on_demand_load("glMultiTexCoord3sv");
+	glad_glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)glad_on_demand_load("glMultiTexCoord4d");
+	glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)glad_on_demand_load("glMultiTexCoord4dv");
+	glad_glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)glad_on_demand_load("glMultiTexCoord4f");
+	glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)glad_on_demand_load("glMultiTexCoord4fv");
+	glad_glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)glad_on_demand_load("glMultiTexCoord4i");
+	glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)glad_on_demand_load("glMultiTexCoord4iv");
+	glad_glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)glad_on_demand_load("glMultiTexCoord4s");
+	glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)glad_on_demand_load("glMultiTexCoord4sv");
+	glad_glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_on_demand_load("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_on_demand_load("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_on_demand_load("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_on_demand_load("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_on_demand_load("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_on_demand_load("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_on_demand_load("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_on_demand_load("glMultiTexCoordP4uiv");
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_on_demand_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)glad_on_demand_load("glNamedBufferData");
+	glad_glNamedBufferData(buffer, size, data, usage);
+}
+static void APIENTRY glad_on_demand_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)glad_on_demand_load("glNamedBufferStorage");
+	glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+static void APIENTRY glad_on_demand_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)glad_on_demand_load("glNamedBufferSubData");
+	glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_on_demand_load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_on_demand_load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_on_demand_load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_on_demand_load("glNamedFramebufferReadBuffer");
+	glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_on_demand_load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_on_demand_load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void APIENTRY glad_on_demand_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_on_demand_load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY glad_on_demand_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_on_demand_load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY glad_on_demand_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_on_demand_load("glNamedRenderbufferStorageMultisample");
+	glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY glad_on_demand_glNewList(GLuint list, GLenum mode) {
+	glad_glNewList = (PFNGLNEWLISTPROC)glad_on_demand_load("glNewList");
+	glad_glNewList(list, mode);
+}
+static void APIENTRY glad_on_demand_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_glNormal3b = (PFNGLNORMAL3BPROC)glad_on_demand_load("glNormal3b");
+	glad_glNormal3b(nx, ny, nz);
+}
+static void APIENTRY glad_on_demand_glNormal3bv(const GLbyte *v) {
+	glad_glNormal3bv = (PFNGLNORMAL3BVPROC)glad_on_demand_load("glNormal3bv");
+	glad_glNormal3bv(v);
+}
+static void APIENTRY glad_on_demand_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_glNormal3d = (PFNGLNORMAL3DPROC)glad_on_demand_load("glNormal3d");
+	glad_glNormal3d(nx, ny, nz);
+}
+static void APIENTRY glad_on_demand_glNormal3dv(const GLdouble *v) {
+	glad_glNormal3dv = (PFNGLNORMAL3DVPROC)glad_on_demand_load("glNormal3dv");
+	glad_glNormal3dv(v);
+}
+static void APIENTRY glad_on_demand_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_glNormal3f = (PFNGLNORMAL3FPROC)glad_on_demand_load("glNormal3f");
+	glad_glNormal3f(nx, ny, nz);
+}
+static void APIENTRY glad_on_demand_glNormal3fv(const GLfloat *v) {
+	glad_glNormal3fv = (PFNGLNORMAL3FVPROC)glad_on_demand_load("glNormal3fv");
+	glad_glNormal3fv(v);
+}
+static void APIENTRY glad_on_demand_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	glad_glNormal3i = (PFNGLNORMAL3IPROC)glad_on_demand_load("glNormal3i");
+	glad_glNormal3i(nx, ny, nz);
+}
+static void APIENTRY glad_on_demand_glNormal3iv(const GLint *v) {
+	glad_glNormal3iv = (PFNGLNORMAL3IVPROC)glad_on_demand_load("glNormal3iv");
+	glad_glNormal3iv(v);
+}
+static void APIENTRY glad_on_demand_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	glad_glNormal3s = (PFNGLNORMAL3SPROC)glad_on_demand_load("glNormal3s");
+	glad_glNormal3s(nx, ny, nz);
+}
+static void APIENTRY glad_on_demand_glNormal3sv(const GLshort *v) {
+	glad_glNormal3sv = (PFNGLNORMAL3SVPROC)glad_on_demand_load("glNormal3sv");
+	glad_glNormal3sv(v);
+}
+static void APIENTRY glad_on_demand_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_on_demand_load("glNormalP3ui");
+	glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_on_demand_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_on_demand_load("glNormalP3uiv");
+	glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_on_demand_glNormalPointer(GLenum type, GLsizei stride, const void *ptr) {
+	glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)glad_on_demand_load("glNormalPointer");
+	glad_glNormalPointer(type, stride, ptr);
+}
+static void APIENTRY glad_on_demand_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)glad_on_demand_load("glObjectLabel");
+	glad_glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY glad_on_demand_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)glad_on_demand_load("glObjectPtrLabel");
+	glad_glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY glad_on_demand_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val) {
+	glad_glOrtho = (PFNGLORTHOPROC)glad_on_demand_load("glOrtho");
+	glad_glOrtho(left, right, bottom, top, near_val, far_val);
+}
+static void APIENTRY glad_on_demand_glPassThrough(GLfloat token) {
+	glad_glPassThrough = (PFNGLPASSTHROUGHPROC)glad_on_demand_load("glPassThrough");
+	glad_glPassThrough(token);
+}
+static void APIENTRY glad_on_demand_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)glad_on_demand_load("glPatchParameterfv");
+	glad_glPatchParameterfv(pname, values);
+}
+static void APIENTRY glad_on_demand_glPatchParameteri(GLenum pname, GLint value) {
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)glad_on_demand_load("glPatchParameteri");
+	glad_glPatchParameteri(pname, value);
+}
+static void APIENTRY glad_on_demand_glPauseTransformFeedback(void) {
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_on_demand_load("glPauseTransformFeedback");
+	glad_glPauseTransformFeedback();
+}
+static void APIENTRY glad_on_demand_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)glad_on_demand_load("glPixelMapfv");
+	glad_glPixelMapfv(map, mapsize, values);
+}
+static void APIENTRY glad_on_demand_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)glad_on_demand_load("glPixelMapuiv");
+	glad_glPixelMapuiv(map, mapsize, values);
+}
+static void APIENTRY glad_on_demand_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)glad_on_demand_load("glPixelMapusv");
+	glad_glPixelMapusv(map, mapsize, values);
+}
+static void APIENTRY glad_on_demand_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_on_demand_load("glPixelStoref");
+	glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_on_demand_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_on_demand_load("glPixelStorei");
+	glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_on_demand_glPixelTransferf(GLenum pname, GLfloat param) {
+	glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)glad_on_demand_load("glPixelTransferf");
+	glad_glPixelTransferf(pname, param);
+}
+static void APIENTRY glad_on_demand_glPixelTransferi(GLenum pname, GLint param) {
+	glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)glad_on_demand_load("glPixelTransferi");
+	glad_glPixelTransferi(pname, param);
+}
+static void APIENTRY glad_on_demand_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	glad_glPixelZoom = (PFNGLPIXELZOOMPROC)glad_on_demand_load("glPixelZoom");
+	glad_glPixelZoom(xfactor, yfactor);
+}
+static void APIENTRY glad_on_demand_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_on_demand_load("glPointParameterf");
+	glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_on_demand_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_on_demand_load("glPointParameterfv");
+	glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_on_demand_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_on_demand_load("glPointParameteri");
+	glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_on_demand_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_on_demand_load("glPointParameteriv");
+	glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_on_demand_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)glad_on_demand_load("glPointSize");
+	glad_glPointSize(size);
+}
+static void APIENTRY glad_on_demand_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_on_demand_load("glPolygonMode");
+	glad_glPolygonMode(face, mode);
+}
+static void APIENTRY glad_on_demand_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_on_demand_load("glPolygonOffset");
+	glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_on_demand_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)glad_on_demand_load("glPolygonOffsetClamp");
+	glad_glPolygonOffsetClamp(factor, units, clamp);
+}
+static void APIENTRY glad_on_demand_glPolygonStipple(const GLubyte *mask) {
+	glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)glad_on_demand_load("glPolygonStipple");
+	glad_glPolygonStipple(mask);
+}
+static void APIENTRY glad_on_demand_glPopAttrib(void) {
+	glad_glPopAttrib = (PFNGLPOPATTRIBPROC)glad_on_demand_load("glPopAttrib");
+	glad_glPopAttrib();
+}
+static void APIENTRY glad_on_demand_glPopClientAttrib(void) {
+	glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)glad_on_demand_load("glPopClientAttrib");
+	glad_glPopClientAttrib();
+}
+static void APIENTRY glad_on_demand_glPopDebugGroup(void) {
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)glad_on_demand_load("glPopDebugGroup");
+	glad_glPopDebugGroup();
+}
+static void APIENTRY glad_on_demand_glPopMatrix(void) {
+	glad_glPopMatrix = (PFNGLPOPMATRIXPROC)glad_on_demand_load("glPopMatrix");
+	glad_glPopMatrix();
+}
+static void APIENTRY glad_on_demand_glPopName(void) {
+	glad_glPopName = (PFNGLPOPNAMEPROC)glad_on_demand_load("glPopName");
+	glad_glPopName();
+}
+static void APIENTRY glad_on_demand_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_on_demand_load("glPrimitiveRestartIndex");
+	glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_on_demand_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLclampf *priorities) {
+	glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)glad_on_demand_load("glPrioritizeTextures");
+	glad_glPrioritizeTextures(n, textures, priorities);
+}
+static void APIENTRY glad_on_demand_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)glad_on_demand_load("glProgramBinary");
+	glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_on_demand_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glad_on_demand_load("glProgramParameteri");
+	glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)glad_on_demand_load("glProgramUniform1d");
+	glad_glProgramUniform1d(program, location, v0);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)glad_on_demand_load("glProgramUniform1dv");
+	glad_glProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)glad_on_demand_load("glProgramUniform1f");
+	glad_glProgramUniform1f(program, location, v0);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)glad_on_demand_load("glProgramUniform1fv");
+	glad_glProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)glad_on_demand_load("glProgramUniform1i");
+	glad_glProgramUniform1i(program, location, v0);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)glad_on_demand_load("glProgramUniform1iv");
+	glad_glProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)glad_on_demand_load("glProgramUniform1ui");
+	glad_glProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY glad_on_demand_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)glad_on_demand_load("glProgramUniform1uiv");
+	glad_glProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)glad_on_demand_load("glProgramUniform2d");
+	glad_glProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)glad_on_demand_load("glProgramUniform2dv");
+	glad_glProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)glad_on_demand_load("glProgramUniform2f");
+	glad_glProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)glad_on_demand_load("glProgramUniform2fv");
+	glad_glProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)glad_on_demand_load("glProgramUniform2i");
+	glad_glProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)glad_on_demand_load("glProgramUniform2iv");
+	glad_glProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)glad_on_demand_load("glProgramUniform2ui");
+	glad_glProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)glad_on_demand_load("glProgramUniform2uiv");
+	glad_glProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)glad_on_demand_load("glProgramUniform3d");
+	glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)glad_on_demand_load("glProgramUniform3dv");
+	glad_glProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)glad_on_demand_load("glProgramUniform3f");
+	glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)glad_on_demand_load("glProgramUniform3fv");
+	glad_glProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)glad_on_demand_load("glProgramUniform3i");
+	glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)glad_on_demand_load("glProgramUniform3iv");
+	glad_glProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)glad_on_demand_load("glProgramUniform3ui");
+	glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)glad_on_demand_load("glProgramUniform3uiv");
+	glad_glProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)glad_on_demand_load("glProgramUniform4d");
+	glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)glad_on_demand_load("glProgramUniform4dv");
+	glad_glProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)glad_on_demand_load("glProgramUniform4f");
+	glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)glad_on_demand_load("glProgramUniform4fv");
+	glad_glProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)glad_on_demand_load("glProgramUniform4i");
+	glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)glad_on_demand_load("glProgramUniform4iv");
+	glad_glProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)glad_on_demand_load("glProgramUniform4ui");
+	glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)glad_on_demand_load("glProgramUniform4uiv");
+	glad_glProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_on_demand_load("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_on_demand_load("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_on_demand_load("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_on_demand_load("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_on_demand_load("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_on_demand_load("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_on_demand_load("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_on_demand_load("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_on_demand_load("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_on_demand_load("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_on_demand_load("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_on_demand_load("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_on_demand_load("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_on_demand_load("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_on_demand_load("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_on_demand_load("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_on_demand_load("glProgramUniformMatrix4x3dv");
+	glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_on_demand_load("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_on_demand_load("glProvokingVertex");
+	glad_glProvokingVertex(mode);
+}
+static void APIENTRY glad_on_demand_glPushAttrib(GLbitfield mask) {
+	glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)glad_on_demand_load("glPushAttrib");
+	glad_glPushAttrib(mask);
+}
+static void APIENTRY glad_on_demand_glPushClientAttrib(GLbitfield mask) {
+	glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)glad_on_demand_load("glPushClientAttrib");
+	glad_glPushClientAttrib(mask);
+}
+static void APIENTRY glad_on_demand_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)glad_on_demand_load("glPushDebugGroup");
+	glad_glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY glad_on_demand_glPushMatrix(void) {
+	glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)glad_on_demand_load("glPushMatrix");
+	glad_glPushMatrix();
+}
+static void APIENTRY glad_on_demand_glPushName(GLuint name) {
+	glad_glPushName = (PFNGLPUSHNAMEPROC)glad_on_demand_load("glPushName");
+	glad_glPushName(name);
+}
+static void APIENTRY glad_on_demand_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_on_demand_load("glQueryCounter");
+	glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_on_demand_glRasterPos2d(GLdouble x, GLdouble y) {
+	glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)glad_on_demand_load("glRasterPos2d");
+	glad_glRasterPos2d(x, y);
+}
+static void APIENTRY glad_on_demand_glRasterPos2dv(const GLdouble *v) {
+	glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)glad_on_demand_load("glRasterPos2dv");
+	glad_glRasterPos2dv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos2f(GLfloat x, GLfloat y) {
+	glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)glad_on_demand_load("glRasterPos2f");
+	glad_glRasterPos2f(x, y);
+}
+static void APIENTRY glad_on_demand_glRasterPos2fv(const GLfloat *v) {
+	glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)glad_on_demand_load("glRasterPos2fv");
+	glad_glRasterPos2fv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos2i(GLint x, GLint y) {
+	glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)glad_on_demand_load("glRasterPos2i");
+	glad_glRasterPos2i(x, y);
+}
+static void APIENTRY glad_on_demand_glRasterPos2iv(const GLint *v) {
+	glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)glad_on_demand_load("glRasterPos2iv");
+	glad_glRasterPos2iv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos2s(GLshort x, GLshort y) {
+	glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)glad_on_demand_load("glRasterPos2s");
+	glad_glRasterPos2s(x, y);
+}
+static void APIENTRY glad_on_demand_glRasterPos2sv(const GLshort *v) {
+	glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)glad_on_demand_load("glRasterPos2sv");
+	glad_glRasterPos2sv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)glad_on_demand_load("glRasterPos3d");
+	glad_glRasterPos3d(x, y, z);
+}
+static void APIENTRY glad_on_demand_glRasterPos3dv(const GLdouble *v) {
+	glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)glad_on_demand_load("glRasterPos3dv");
+	glad_glRasterPos3dv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)glad_on_demand_load("glRasterPos3f");
+	glad_glRasterPos3f(x, y, z);
+}
+static void APIENTRY glad_on_demand_glRasterPos3fv(const GLfloat *v) {
+	glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)glad_on_demand_load("glRasterPos3fv");
+	glad_glRasterPos3fv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos3i(GLint x, GLint y, GLint z) {
+	glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)glad_on_demand_load("glRasterPos3i");
+	glad_glRasterPos3i(x, y, z);
+}
+static void APIENTRY glad_on_demand_glRasterPos3iv(const GLint *v) {
+	glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)glad_on_demand_load("glRasterPos3iv");
+	glad_glRasterPos3iv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)glad_on_demand_load("glRasterPos3s");
+	glad_glRasterPos3s(x, y, z);
+}
+static void APIENTRY glad_on_demand_glRasterPos3sv(const GLshort *v) {
+	glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)glad_on_demand_load("glRasterPos3sv");
+	glad_glRasterPos3sv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)glad_on_demand_load("glRasterPos4d");
+	glad_glRasterPos4d(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glRasterPos4dv(const GLdouble *v) {
+	glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)glad_on_demand_load("glRasterPos4dv");
+	glad_glRasterPos4dv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)glad_on_demand_load("glRasterPos4f");
+	glad_glRasterPos4f(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glRasterPos4fv(const GLfloat *v) {
+	glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)glad_on_demand_load("glRasterPos4fv");
+	glad_glRasterPos4fv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)glad_on_demand_load("glRasterPos4i");
+	glad_glRasterPos4i(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glRasterPos4iv(const GLint *v) {
+	glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)glad_on_demand_load("glRasterPos4iv");
+	glad_glRasterPos4iv(v);
+}
+static void APIENTRY glad_on_demand_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)glad_on_demand_load("glRasterPos4s");
+	glad_glRasterPos4s(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glRasterPos4sv(const GLshort *v) {
+	glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)glad_on_demand_load("glRasterPos4sv");
+	glad_glRasterPos4sv(v);
+}
+static void APIENTRY glad_on_demand_glReadBuffer(GLenum mode) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)glad_on_demand_load("glReadBuffer");
+	glad_glReadBuffer(mode);
+}
+static void APIENTRY glad_on_demand_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)glad_on_demand_load("glReadPixels");
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)glad_on_demand_load("glReadnPixels");
+	glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY glad_on_demand_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	glad_glRectd = (PFNGLRECTDPROC)glad_on_demand_load("glRectd");
+	glad_glRectd(x1, y1, x2, y2);
+}
+static void APIENTRY glad_on_demand_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	glad_glRectdv = (PFNGLRECTDVPROC)glad_on_demand_load("glRectdv");
+	glad_glRectdv(v1, v2);
+}
+static void APIENTRY glad_on_demand_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	glad_glRectf = (PFNGLRECTFPROC)glad_on_demand_load("glRectf");
+	glad_glRectf(x1, y1, x2, y2);
+}
+static void APIENTRY glad_on_demand_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	glad_glRectfv = (PFNGLRECTFVPROC)glad_on_demand_load("glRectfv");
+	glad_glRectfv(v1, v2);
+}
+static void APIENTRY glad_on_demand_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	glad_glRecti = (PFNGLRECTIPROC)glad_on_demand_load("glRecti");
+	glad_glRecti(x1, y1, x2, y2);
+}
+static void APIENTRY glad_on_demand_glRectiv(const GLint *v1, const GLint *v2) {
+	glad_glRectiv = (PFNGLRECTIVPROC)glad_on_demand_load("glRectiv");
+	glad_glRectiv(v1, v2);
+}
+static void APIENTRY glad_on_demand_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	glad_glRects = (PFNGLRECTSPROC)glad_on_demand_load("glRects");
+	glad_glRects(x1, y1, x2, y2);
+}
+static void APIENTRY glad_on_demand_glRectsv(const GLshort *v1, const GLshort *v2) {
+	glad_glRectsv = (PFNGLRECTSVPROC)glad_on_demand_load("glRectsv");
+	glad_glRectsv(v1, v2);
+}
+static void APIENTRY glad_on_demand_glReleaseShaderCompiler(void) {
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)glad_on_demand_load("glReleaseShaderCompiler");
+	glad_glReleaseShaderCompiler();
+}
+static GLint APIENTRY glad_on_demand_glRenderMode(GLenum mode) {
+	glad_glRenderMode = (PFNGLRENDERMODEPROC)glad_on_demand_load("glRenderMode");
+	return glad_glRenderMode(mode);
+}
+static void APIENTRY glad_on_demand_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_on_demand_load("glRenderbufferStorage");
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_on_demand_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_on_demand_load("glRenderbufferStorageMultisample");
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_on_demand_glResumeTransformFeedback(void) {
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_on_demand_load("glResumeTransformFeedback");
+	glad_glResumeTransformFeedback();
+}
+static void APIENTRY glad_on_demand_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRotated = (PFNGLROTATEDPROC)glad_on_demand_load("glRotated");
+	glad_glRotated(angle, x, y, z);
+}
+static void APIENTRY glad_on_demand_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRotatef = (PFNGLROTATEFPROC)glad_on_demand_load("glRotatef");
+	glad_glRotatef(angle, x, y, z);
+}
+static void APIENTRY glad_on_demand_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_on_demand_load("glSampleCoverage");
+	glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_on_demand_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_on_demand_load("glSampleMaski");
+	glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_on_demand_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_on_demand_load("glSamplerParameterIiv");
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_on_demand_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_on_demand_load("glSamplerParameterIuiv");
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_on_demand_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_on_demand_load("glSamplerParameterf");
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_on_demand_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_on_demand_load("glSamplerParameterfv");
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_on_demand_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_on_demand_load("glSamplerParameteri");
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_on_demand_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_on_demand_load("glSamplerParameteriv");
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_on_demand_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glScaled = (PFNGLSCALEDPROC)glad_on_demand_load("glScaled");
+	glad_glScaled(x, y, z);
+}
+static void APIENTRY glad_on_demand_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glScalef = (PFNGLSCALEFPROC)glad_on_demand_load("glScalef");
+	glad_glScalef(x, y, z);
+}
+static void APIENTRY glad_on_demand_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)glad_on_demand_load("glScissor");
+	glad_glScissor(x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)glad_on_demand_load("glScissorArrayv");
+	glad_glScissorArrayv(first, count, v);
+}
+static void APIENTRY glad_on_demand_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)glad_on_demand_load("glScissorIndexed");
+	glad_glScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY glad_on_demand_glScissorIndexedv(GLuint index, const GLint *v) {
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)glad_on_demand_load("glScissorIndexedv");
+	glad_glScissorIndexedv(index, v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)glad_on_demand_load("glSecondaryColor3b");
+	glad_glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3bv(const GLbyte *v) {
+	glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)glad_on_demand_load("glSecondaryColor3bv");
+	glad_glSecondaryColor3bv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)glad_on_demand_load("glSecondaryColor3d");
+	glad_glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3dv(const GLdouble *v) {
+	glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)glad_on_demand_load("glSecondaryColor3dv");
+	glad_glSecondaryColor3dv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)glad_on_demand_load("glSecondaryColor3f");
+	glad_glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3fv(const GLfloat *v) {
+	glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)glad_on_demand_load("glSecondaryColor3fv");
+	glad_glSecondaryColor3fv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)glad_on_demand_load("glSecondaryColor3i");
+	glad_glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3iv(const GLint *v) {
+	glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)glad_on_demand_load("glSecondaryColor3iv");
+	glad_glSecondaryColor3iv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)glad_on_demand_load("glSecondaryColor3s");
+	glad_glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3sv(const GLshort *v) {
+	glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)glad_on_demand_load("glSecondaryColor3sv");
+	glad_glSecondaryColor3sv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)glad_on_demand_load("glSecondaryColor3ub");
+	glad_glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3ubv(const GLubyte *v) {
+	glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)glad_on_demand_load("glSecondaryColor3ubv");
+	glad_glSecondaryColor3ubv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)glad_on_demand_load("glSecondaryColor3ui");
+	glad_glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3uiv(const GLuint *v) {
+	glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)glad_on_demand_load("glSecondaryColor3uiv");
+	glad_glSecondaryColor3uiv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)glad_on_demand_load("glSecondaryColor3us");
+	glad_glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY glad_on_demand_glSecondaryColor3usv(const GLushort *v) {
+	glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)glad_on_demand_load("glSecondaryColor3usv");
+	glad_glSecondaryColor3usv(v);
+}
+static void APIENTRY glad_on_demand_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_on_demand_load("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_on_demand_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_on_demand_load("glSecondaryColorP3uiv");
+	glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_on_demand_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)glad_on_demand_load("glSecondaryColorPointer");
+	glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_on_demand_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)glad_on_demand_load("glSelectBuffer");
+	glad_glSelectBuffer(size, buffer);
+}
+static void APIENTRY glad_on_demand_glShadeModel(GLenum mode) {
+	glad_glShadeModel = (PFNGLSHADEMODELPROC)glad_on_demand_load("glShadeModel");
+	glad_glShadeModel(mode);
+}
+static void APIENTRY glad_on_demand_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)glad_on_demand_load("glShaderBinary");
+	glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+static void APIENTRY glad_on_demand_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_on_demand_load("glShaderSource");
+	glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_on_demand_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_on_demand_load("glShaderStorageBlockBinding");
+	glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY glad_on_demand_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)glad_on_demand_load("glSpecializeShader");
+	glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void APIENTRY glad_on_demand_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_on_demand_load("glStencilFunc");
+	glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_on_demand_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_on_demand_load("glStencilFuncSeparate");
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_on_demand_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)glad_on_demand_load("glStencilMask");
+	glad_glStencilMask(mask);
+}
+static void APIENTRY glad_on_demand_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_on_demand_load("glStencilMaskSeparate");
+	glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_on_demand_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)glad_on_demand_load("glStencilOp");
+	glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_on_demand_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_on_demand_load("glStencilOpSeparate");
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_on_demand_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_on_demand_load("glTexBuffer");
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_on_demand_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)glad_on_demand_load("glTexBufferRange");
+	glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_on_demand_glTexCoord1d(GLdouble s) {
+	glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)glad_on_demand_load("glTexCoord1d");
+	glad_glTexCoord1d(s);
+}
+static void APIENTRY glad_on_demand_glTexCoord1dv(const GLdouble *v) {
+	glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)glad_on_demand_load("glTexCoord1dv");
+	glad_glTexCoord1dv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord1f(GLfloat s) {
+	glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)glad_on_demand_load("glTexCoord1f");
+	glad_glTexCoord1f(s);
+}
+static void APIENTRY glad_on_demand_glTexCoord1fv(const GLfloat *v) {
+	glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)glad_on_demand_load("glTexCoord1fv");
+	glad_glTexCoord1fv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord1i(GLint s) {
+	glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)glad_on_demand_load("glTexCoord1i");
+	glad_glTexCoord1i(s);
+}
+static void APIENTRY glad_on_demand_glTexCoord1iv(const GLint *v) {
+	glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)glad_on_demand_load("glTexCoord1iv");
+	glad_glTexCoord1iv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord1s(GLshort s) {
+	glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)glad_on_demand_load("glTexCoord1s");
+	glad_glTexCoord1s(s);
+}
+static void APIENTRY glad_on_demand_glTexCoord1sv(const GLshort *v) {
+	glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)glad_on_demand_load("glTexCoord1sv");
+	glad_glTexCoord1sv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord2d(GLdouble s, GLdouble t) {
+	glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)glad_on_demand_load("glTexCoord2d");
+	glad_glTexCoord2d(s, t);
+}
+static void APIENTRY glad_on_demand_glTexCoord2dv(const GLdouble *v) {
+	glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)glad_on_demand_load("glTexCoord2dv");
+	glad_glTexCoord2dv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord2f(GLfloat s, GLfloat t) {
+	glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)glad_on_demand_load("glTexCoord2f");
+	glad_glTexCoord2f(s, t);
+}
+static void APIENTRY glad_on_demand_glTexCoord2fv(const GLfloat *v) {
+	glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)glad_on_demand_load("glTexCoord2fv");
+	glad_glTexCoord2fv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord2i(GLint s, GLint t) {
+	glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)glad_on_demand_load("glTexCoord2i");
+	glad_glTexCoord2i(s, t);
+}
+static void APIENTRY glad_on_demand_glTexCoord2iv(const GLint *v) {
+	glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)glad_on_demand_load("glTexCoord2iv");
+	glad_glTexCoord2iv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord2s(GLshort s, GLshort t) {
+	glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)glad_on_demand_load("glTexCoord2s");
+	glad_glTexCoord2s(s, t);
+}
+static void APIENTRY glad_on_demand_glTexCoord2sv(const GLshort *v) {
+	glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)glad_on_demand_load("glTexCoord2sv");
+	glad_glTexCoord2sv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)glad_on_demand_load("glTexCoord3d");
+	glad_glTexCoord3d(s, t, r);
+}
+static void APIENTRY glad_on_demand_glTexCoord3dv(const GLdouble *v) {
+	glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)glad_on_demand_load("glTexCoord3dv");
+	glad_glTexCoord3dv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)glad_on_demand_load("glTexCoord3f");
+	glad_glTexCoord3f(s, t, r);
+}
+static void APIENTRY glad_on_demand_glTexCoord3fv(const GLfloat *v) {
+	glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)glad_on_demand_load("glTexCoord3fv");
+	glad_glTexCoord3fv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord3i(GLint s, GLint t, GLint r) {
+	glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)glad_on_demand_load("glTexCoord3i");
+	glad_glTexCoord3i(s, t, r);
+}
+static void APIENTRY glad_on_demand_glTexCoord3iv(const GLint *v) {
+	glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)glad_on_demand_load("glTexCoord3iv");
+	glad_glTexCoord3iv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)glad_on_demand_load("glTexCoord3s");
+	glad_glTexCoord3s(s, t, r);
+}
+static void APIENTRY glad_on_demand_glTexCoord3sv(const GLshort *v) {
+	glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)glad_on_demand_load("glTexCoord3sv");
+	glad_glTexCoord3sv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)glad_on_demand_load("glTexCoord4d");
+	glad_glTexCoord4d(s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glTexCoord4dv(const GLdouble *v) {
+	glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)glad_on_demand_load("glTexCoord4dv");
+	glad_glTexCoord4dv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)glad_on_demand_load("glTexCoord4f");
+	glad_glTexCoord4f(s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glTexCoord4fv(const GLfloat *v) {
+	glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)glad_on_demand_load("glTexCoord4fv");
+	glad_glTexCoord4fv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)glad_on_demand_load("glTexCoord4i");
+	glad_glTexCoord4i(s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glTexCoord4iv(const GLint *v) {
+	glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)glad_on_demand_load("glTexCoord4iv");
+	glad_glTexCoord4iv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)glad_on_demand_load("glTexCoord4s");
+	glad_glTexCoord4s(s, t, r, q);
+}
+static void APIENTRY glad_on_demand_glTexCoord4sv(const GLshort *v) {
+	glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)glad_on_demand_load("glTexCoord4sv");
+	glad_glTexCoord4sv(v);
+}
+static void APIENTRY glad_on_demand_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_on_demand_load("glTexCoordP1ui");
+	glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_on_demand_load("glTexCoordP1uiv");
+	glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_on_demand_load("glTexCoordP2ui");
+	glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_on_demand_load("glTexCoordP2uiv");
+	glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_on_demand_load("glTexCoordP3ui");
+	glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_on_demand_load("glTexCoordP3uiv");
+	glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_on_demand_load("glTexCoordP4ui");
+	glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_on_demand_load("glTexCoordP4uiv");
+	glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_on_demand_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *ptr) {
+	glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)glad_on_demand_load("glTexCoordPointer");
+	glad_glTexCoordPointer(size, type, stride, ptr);
+}
+static void APIENTRY glad_on_demand_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexEnvf = (PFNGLTEXENVFPROC)glad_on_demand_load("glTexEnvf");
+	glad_glTexEnvf(target, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexEnvfv = (PFNGLTEXENVFVPROC)glad_on_demand_load("glTexEnvfv");
+	glad_glTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	glad_glTexEnvi = (PFNGLTEXENVIPROC)glad_on_demand_load("glTexEnvi");
+	glad_glTexEnvi(target, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexEnviv = (PFNGLTEXENVIVPROC)glad_on_demand_load("glTexEnviv");
+	glad_glTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	glad_glTexGend = (PFNGLTEXGENDPROC)glad_on_demand_load("glTexGend");
+	glad_glTexGend(coord, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_glTexGendv = (PFNGLTEXGENDVPROC)glad_on_demand_load("glTexGendv");
+	glad_glTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	glad_glTexGenf = (PFNGLTEXGENFPROC)glad_on_demand_load("glTexGenf");
+	glad_glTexGenf(coord, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_glTexGenfv = (PFNGLTEXGENFVPROC)glad_on_demand_load("glTexGenfv");
+	glad_glTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	glad_glTexGeni = (PFNGLTEXGENIPROC)glad_on_demand_load("glTexGeni");
+	glad_glTexGeni(coord, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	glad_glTexGeniv = (PFNGLTEXGENIVPROC)glad_on_demand_load("glTexGeniv");
+	glad_glTexGeniv(coord, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexImage1D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_on_demand_load("glTexImage1D");
+	glad_glTexImage1D(target, level, internalFormat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_on_demand_load("glTexImage2D");
+	glad_glTexImage2D(target, level, internalFormat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_on_demand_load("glTexImage2DMultisample");
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_on_demand_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_on_demand_load("glTexImage3D");
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_on_demand_load("glTexImage3DMultisample");
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_on_demand_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_on_demand_load("glTexParameterIiv");
+	glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_on_demand_load("glTexParameterIuiv");
+	glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_on_demand_load("glTexParameterf");
+	glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_on_demand_load("glTexParameterfv");
+	glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_on_demand_load("glTexParameteri");
+	glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_on_demand_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_on_demand_load("glTexParameteriv");
+	glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_on_demand_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)glad_on_demand_load("glTexStorage1D");
+	glad_glTexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY glad_on_demand_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)glad_on_demand_load("glTexStorage2D");
+	glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY glad_on_demand_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_on_demand_load("glTexStorage2DMultisample");
+	glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_on_demand_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)glad_on_demand_load("glTexStorage3D");
+	glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_on_demand_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_on_demand_load("glTexStorage3DMultisample");
+	glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_on_demand_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_on_demand_load("glTexSubImage1D");
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_on_demand_load("glTexSubImage2D");
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_on_demand_load("glTexSubImage3D");
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTextureBarrier(void) {
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)glad_on_demand_load("glTextureBarrier");
+	glad_glTextureBarrier();
+}
+static void APIENTRY glad_on_demand_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)glad_on_demand_load("glTextureBuffer");
+	glad_glTextureBuffer(texture, internalformat, buffer);
+}
+static void APIENTRY glad_on_demand_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)glad_on_demand_load("glTextureBufferRange");
+	glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_on_demand_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)glad_on_demand_load("glTextureParameterIiv");
+	glad_glTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_on_demand_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)glad_on_demand_load("glTextureParameterIuiv");
+	glad_glTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_on_demand_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)glad_on_demand_load("glTextureParameterf");
+	glad_glTextureParameterf(texture, pname, param);
+}
+static void APIENTRY glad_on_demand_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)glad_on_demand_load("glTextureParameterfv");
+	glad_glTextureParameterfv(texture, pname, param);
+}
+static void APIENTRY glad_on_demand_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)glad_on_demand_load("glTextureParameteri");
+	glad_glTextureParameteri(texture, pname, param);
+}
+static void APIENTRY glad_on_demand_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)glad_on_demand_load("glTextureParameteriv");
+	glad_glTextureParameteriv(texture, pname, param);
+}
+static void APIENTRY glad_on_demand_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)glad_on_demand_load("glTextureStorage1D");
+	glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+static void APIENTRY glad_on_demand_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)glad_on_demand_load("glTextureStorage2D");
+	glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void APIENTRY glad_on_demand_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_on_demand_load("glTextureStorage2DMultisample");
+	glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_on_demand_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)glad_on_demand_load("glTextureStorage3D");
+	glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_on_demand_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_on_demand_load("glTextureStorage3DMultisample");
+	glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_on_demand_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)glad_on_demand_load("glTextureSubImage1D");
+	glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)glad_on_demand_load("glTextureSubImage2D");
+	glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)glad_on_demand_load("glTextureSubImage3D");
+	glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_on_demand_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)glad_on_demand_load("glTextureView");
+	glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY glad_on_demand_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_on_demand_load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void APIENTRY glad_on_demand_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_on_demand_load("glTransformFeedbackBufferRange");
+	glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void APIENTRY glad_on_demand_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_on_demand_load("glTransformFeedbackVaryings");
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_on_demand_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glTranslated = (PFNGLTRANSLATEDPROC)glad_on_demand_load("glTranslated");
+	glad_glTranslated(x, y, z);
+}
+static void APIENTRY glad_on_demand_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTranslatef = (PFNGLTRANSLATEFPROC)glad_on_demand_load("glTranslatef");
+	glad_glTranslatef(x, y, z);
+}
+static void APIENTRY glad_on_demand_glUniform1d(GLint location, GLdouble x) {
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)glad_on_demand_load("glUniform1d");
+	glad_glUniform1d(location, x);
+}
+static void APIENTRY glad_on_demand_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)glad_on_demand_load("glUniform1dv");
+	glad_glUniform1dv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)glad_on_demand_load("glUniform1f");
+	glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_on_demand_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_on_demand_load("glUniform1fv");
+	glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)glad_on_demand_load("glUniform1i");
+	glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_on_demand_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_on_demand_load("glUniform1iv");
+	glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_on_demand_load("glUniform1ui");
+	glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_on_demand_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_on_demand_load("glUniform1uiv");
+	glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)glad_on_demand_load("glUniform2d");
+	glad_glUniform2d(location, x, y);
+}
+static void APIENTRY glad_on_demand_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)glad_on_demand_load("glUniform2dv");
+	glad_glUniform2dv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)glad_on_demand_load("glUniform2f");
+	glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_on_demand_load("glUniform2fv");
+	glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)glad_on_demand_load("glUniform2i");
+	glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_on_demand_load("glUniform2iv");
+	glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_on_demand_load("glUniform2ui");
+	glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_on_demand_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_on_demand_load("glUniform2uiv");
+	glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)glad_on_demand_load("glUniform3d");
+	glad_glUniform3d(location, x, y, z);
+}
+static void APIENTRY glad_on_demand_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)glad_on_demand_load("glUniform3dv");
+	glad_glUniform3dv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)glad_on_demand_load("glUniform3f");
+	glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_on_demand_load("glUniform3fv");
+	glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)glad_on_demand_load("glUniform3i");
+	glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_on_demand_load("glUniform3iv");
+	glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_on_demand_load("glUniform3ui");
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_on_demand_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_on_demand_load("glUniform3uiv");
+	glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)glad_on_demand_load("glUniform4d");
+	glad_glUniform4d(location, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)glad_on_demand_load("glUniform4dv");
+	glad_glUniform4dv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)glad_on_demand_load("glUniform4f");
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_on_demand_load("glUniform4fv");
+	glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)glad_on_demand_load("glUniform4i");
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_on_demand_load("glUniform4iv");
+	glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_on_demand_load("glUniform4ui");
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_on_demand_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_on_demand_load("glUniform4uiv");
+	glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_on_demand_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_on_demand_load("glUniformBlockBinding");
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)glad_on_demand_load("glUniformMatrix2dv");
+	glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_on_demand_load("glUniformMatrix2fv");
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)glad_on_demand_load("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_on_demand_load("glUniformMatrix2x3fv");
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)glad_on_demand_load("glUniformMatrix2x4dv");
+	glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_on_demand_load("glUniformMatrix2x4fv");
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)glad_on_demand_load("glUniformMatrix3dv");
+	glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_on_demand_load("glUniformMatrix3fv");
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)glad_on_demand_load("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_on_demand_load("glUniformMatrix3x2fv");
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)glad_on_demand_load("glUniformMatrix3x4dv");
+	glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_on_demand_load("glUniformMatrix3x4fv");
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)glad_on_demand_load("glUniformMatrix4dv");
+	glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_on_demand_load("glUniformMatrix4fv");
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)glad_on_demand_load("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_on_demand_load("glUniformMatrix4x2fv");
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)glad_on_demand_load("glUniformMatrix4x3dv");
+	glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_on_demand_load("glUniformMatrix4x3fv");
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_on_demand_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)glad_on_demand_load("glUniformSubroutinesuiv");
+	glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static GLboolean APIENTRY glad_on_demand_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_on_demand_load("glUnmapBuffer");
+	return glad_glUnmapBuffer(target);
+}
+static GLboolean APIENTRY glad_on_demand_glUnmapNamedBuffer(GLuint buffer) {
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)glad_on_demand_load("glUnmapNamedBuffer");
+	return glad_glUnmapNamedBuffer(buffer);
+}
+static void APIENTRY glad_on_demand_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_on_demand_load("glUseProgram");
+	glad_glUseProgram(program);
+}
+static void APIENTRY glad_on_demand_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)glad_on_demand_load("glUseProgramStages");
+	glad_glUseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY glad_on_demand_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_on_demand_load("glValidateProgram");
+	glad_glValidateProgram(program);
+}
+static void APIENTRY glad_on_demand_glValidateProgramPipeline(GLuint pipeline) {
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_on_demand_load("glValidateProgramPipeline");
+	glad_glValidateProgramPipeline(pipeline);
+}
+static void APIENTRY glad_on_demand_glVertex2d(GLdouble x, GLdouble y) {
+	glad_glVertex2d = (PFNGLVERTEX2DPROC)glad_on_demand_load("glVertex2d");
+	glad_glVertex2d(x, y);
+}
+static void APIENTRY glad_on_demand_glVertex2dv(const GLdouble *v) {
+	glad_glVertex2dv = (PFNGLVERTEX2DVPROC)glad_on_demand_load("glVertex2dv");
+	glad_glVertex2dv(v);
+}
+static void APIENTRY glad_on_demand_glVertex2f(GLfloat x, GLfloat y) {
+	glad_glVertex2f = (PFNGLVERTEX2FPROC)glad_on_demand_load("glVertex2f");
+	glad_glVertex2f(x, y);
+}
+static void APIENTRY glad_on_demand_glVertex2fv(const GLfloat *v) {
+	glad_glVertex2fv = (PFNGLVERTEX2FVPROC)glad_on_demand_load("glVertex2fv");
+	glad_glVertex2fv(v);
+}
+static void APIENTRY glad_on_demand_glVertex2i(GLint x, GLint y) {
+	glad_glVertex2i = (PFNGLVERTEX2IPROC)glad_on_demand_load("glVertex2i");
+	glad_glVertex2i(x, y);
+}
+static void APIENTRY glad_on_demand_glVertex2iv(const GLint *v) {
+	glad_glVertex2iv = (PFNGLVERTEX2IVPROC)glad_on_demand_load("glVertex2iv");
+	glad_glVertex2iv(v);
+}
+static void APIENTRY glad_on_demand_glVertex2s(GLshort x, GLshort y) {
+	glad_glVertex2s = (PFNGLVERTEX2SPROC)glad_on_demand_load("glVertex2s");
+	glad_glVertex2s(x, y);
+}
+static void APIENTRY glad_on_demand_glVertex2sv(const GLshort *v) {
+	glad_glVertex2sv = (PFNGLVERTEX2SVPROC)glad_on_demand_load("glVertex2sv");
+	glad_glVertex2sv(v);
+}
+static void APIENTRY glad_on_demand_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertex3d = (PFNGLVERTEX3DPROC)glad_on_demand_load("glVertex3d");
+	glad_glVertex3d(x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertex3dv(const GLdouble *v) {
+	glad_glVertex3dv = (PFNGLVERTEX3DVPROC)glad_on_demand_load("glVertex3dv");
+	glad_glVertex3dv(v);
+}
+static void APIENTRY glad_on_demand_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertex3f = (PFNGLVERTEX3FPROC)glad_on_demand_load("glVertex3f");
+	glad_glVertex3f(x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertex3fv(const GLfloat *v) {
+	glad_glVertex3fv = (PFNGLVERTEX3FVPROC)glad_on_demand_load("glVertex3fv");
+	glad_glVertex3fv(v);
+}
+static void APIENTRY glad_on_demand_glVertex3i(GLint x, GLint y, GLint z) {
+	glad_glVertex3i = (PFNGLVERTEX3IPROC)glad_on_demand_load("glVertex3i");
+	glad_glVertex3i(x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertex3iv(const GLint *v) {
+	glad_glVertex3iv = (PFNGLVERTEX3IVPROC)glad_on_demand_load("glVertex3iv");
+	glad_glVertex3iv(v);
+}
+static void APIENTRY glad_on_demand_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	glad_glVertex3s = (PFNGLVERTEX3SPROC)glad_on_demand_load("glVertex3s");
+	glad_glVertex3s(x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertex3sv(const GLshort *v) {
+	glad_glVertex3sv = (PFNGLVERTEX3SVPROC)glad_on_demand_load("glVertex3sv");
+	glad_glVertex3sv(v);
+}
+static void APIENTRY glad_on_demand_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertex4d = (PFNGLVERTEX4DPROC)glad_on_demand_load("glVertex4d");
+	glad_glVertex4d(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertex4dv(const GLdouble *v) {
+	glad_glVertex4dv = (PFNGLVERTEX4DVPROC)glad_on_demand_load("glVertex4dv");
+	glad_glVertex4dv(v);
+}
+static void APIENTRY glad_on_demand_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertex4f = (PFNGLVERTEX4FPROC)glad_on_demand_load("glVertex4f");
+	glad_glVertex4f(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertex4fv(const GLfloat *v) {
+	glad_glVertex4fv = (PFNGLVERTEX4FVPROC)glad_on_demand_load("glVertex4fv");
+	glad_glVertex4fv(v);
+}
+static void APIENTRY glad_on_demand_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertex4i = (PFNGLVERTEX4IPROC)glad_on_demand_load("glVertex4i");
+	glad_glVertex4i(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertex4iv(const GLint *v) {
+	glad_glVertex4iv = (PFNGLVERTEX4IVPROC)glad_on_demand_load("glVertex4iv");
+	glad_glVertex4iv(v);
+}
+static void APIENTRY glad_on_demand_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertex4s = (PFNGLVERTEX4SPROC)glad_on_demand_load("glVertex4s");
+	glad_glVertex4s(x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertex4sv(const GLshort *v) {
+	glad_glVertex4sv = (PFNGLVERTEX4SVPROC)glad_on_demand_load("glVertex4sv");
+	glad_glVertex4sv(v);
+}
+static void APIENTRY glad_on_demand_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_on_demand_load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY glad_on_demand_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_on_demand_load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_on_demand_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_on_demand_load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_on_demand_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_on_demand_load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_on_demand_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_on_demand_load("glVertexArrayBindingDivisor");
+	glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void APIENTRY glad_on_demand_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_on_demand_load("glVertexArrayElementBuffer");
+	glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+static void APIENTRY glad_on_demand_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_on_demand_load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_on_demand_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_on_demand_load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_on_demand_load("glVertexAttrib1d");
+	glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_on_demand_load("glVertexAttrib1dv");
+	glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_on_demand_load("glVertexAttrib1f");
+	glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_on_demand_load("glVertexAttrib1fv");
+	glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_on_demand_load("glVertexAttrib1s");
+	glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_on_demand_load("glVertexAttrib1sv");
+	glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_on_demand_load("glVertexAttrib2d");
+	glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_on_demand_load("glVertexAttrib2dv");
+	glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_on_demand_load("glVertexAttrib2f");
+	glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_on_demand_load("glVertexAttrib2fv");
+	glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_on_demand_load("glVertexAttrib2s");
+	glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_on_demand_load("glVertexAttrib2sv");
+	glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_on_demand_load("glVertexAttrib3d");
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_on_demand_load("glVertexAttrib3dv");
+	glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_on_demand_load("glVertexAttrib3f");
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_on_demand_load("glVertexAttrib3fv");
+	glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_on_demand_load("glVertexAttrib3s");
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_on_demand_load("glVertexAttrib3sv");
+	glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_on_demand_load("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_on_demand_load("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_on_demand_load("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_on_demand_load("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_on_demand_load("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_on_demand_load("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_on_demand_load("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_on_demand_load("glVertexAttrib4bv");
+	glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_on_demand_load("glVertexAttrib4d");
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_on_demand_load("glVertexAttrib4dv");
+	glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_on_demand_load("glVertexAttrib4f");
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_on_demand_load("glVertexAttrib4fv");
+	glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_on_demand_load("glVertexAttrib4iv");
+	glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_on_demand_load("glVertexAttrib4s");
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_on_demand_load("glVertexAttrib4sv");
+	glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_on_demand_load("glVertexAttrib4ubv");
+	glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_on_demand_load("glVertexAttrib4uiv");
+	glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_on_demand_load("glVertexAttrib4usv");
+	glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)glad_on_demand_load("glVertexAttribBinding");
+	glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY glad_on_demand_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_on_demand_load("glVertexAttribDivisor");
+	glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_on_demand_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)glad_on_demand_load("glVertexAttribFormat");
+	glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_on_demand_load("glVertexAttribI1i");
+	glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_on_demand_load("glVertexAttribI1iv");
+	glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_on_demand_load("glVertexAttribI1ui");
+	glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_on_demand_load("glVertexAttribI1uiv");
+	glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_on_demand_load("glVertexAttribI2i");
+	glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_on_demand_load("glVertexAttribI2iv");
+	glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_on_demand_load("glVertexAttribI2ui");
+	glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_on_demand_load("glVertexAttribI2uiv");
+	glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_on_demand_load("glVertexAttribI3i");
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_on_demand_load("glVertexAttribI3iv");
+	glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_on_demand_load("glVertexAttribI3ui");
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_on_demand_load("glVertexAttribI3uiv");
+	glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_on_demand_load("glVertexAttribI4bv");
+	glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_on_demand_load("glVertexAttribI4i");
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_on_demand_load("glVertexAttribI4iv");
+	glad_glVertexAttribI4iv(index, v);
 }
-#else
-#include <dlfcn.h>
-static void* libGL;
-
-#if !defined(__APPLE__) && !defined(__HAIKU__)
-typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
-static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
-#endif
-
-static
-int open_gl(void) {
-#ifdef __APPLE__
-    static const char *NAMES[] = {
-        "../Frameworks/OpenGL.framework/OpenGL",
-        "/Library/Frameworks/OpenGL.framework/OpenGL",
-        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
-        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
-    };
-#else
-    static const char *NAMES[] = {"libGL.so.1", "libGL.so"};
-#endif
-
-    unsigned int index = 0;
-    for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
-        libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
-
-        if(libGL != NULL) {
-#if defined(__APPLE__) || defined(__HAIKU__)
-            return 1;
-#else
-            gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
-                "glXGetProcAddressARB");
-            return gladGetProcAddressPtr != NULL;
-#endif
-        }
-    }
-
-    return 0;
+static void APIENTRY glad_on_demand_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_on_demand_load("glVertexAttribI4sv");
+	glad_glVertexAttribI4sv(index, v);
 }
-
-static
-void close_gl(void) {
-    if(libGL != NULL) {
-        dlclose(libGL);
-        libGL = NULL;
-    }
+static void APIENTRY glad_on_demand_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_on_demand_load("glVertexAttribI4ubv");
+	glad_glVertexAttribI4ubv(index, v);
 }
-#endif
-
-static
-void* get_proc(const char *namez) {
-    void* result = NULL;
-    if(libGL == NULL) return NULL;
-
-#if !defined(__APPLE__) && !defined(__HAIKU__)
-    if(gladGetProcAddressPtr != NULL) {
-        result = gladGetProcAddressPtr(namez);
-    }
-#endif
-    if(result == NULL) {
-#if defined(_WIN32) || defined(__CYGWIN__)
-        result = (void*)GetProcAddress((HMODULE) libGL, namez);
-#else
-        result = dlsym(libGL, namez);
-#endif
-    }
-
-    return result;
+static void APIENTRY glad_on_demand_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_on_demand_load("glVertexAttribI4ui");
+	glad_glVertexAttribI4ui(index, x, y, z, w);
 }
-
-int gladLoadGL(void) {
-    int status = 0;
-
-    if(open_gl()) {
-        status = gladLoadGLLoader(&get_proc);
-        close_gl();
-    }
-
-    return status;
+static void APIENTRY glad_on_demand_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_on_demand_load("glVertexAttribI4uiv");
+	glad_glVertexAttribI4uiv(index, v);
 }
-
-struct gladGLversionStruct GLVersion = { 0, 0 };
-
-#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
-#define _GLAD_IS_SOME_NEW_VERSION 1
-#endif
-
-static int max_loaded_major;
-static int max_loaded_minor;
-
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
-
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
-    }
-#endif
-    return 1;
+static void APIENTRY glad_on_demand_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_on_demand_load("glVertexAttribI4usv");
+	glad_glVertexAttribI4usv(index, v);
 }
-
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
+static void APIENTRY glad_on_demand_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)glad_on_demand_load("glVertexAttribIFormat");
+	glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
 }
-
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
-    }
-#endif
-
-    return 0;
+static void APIENTRY glad_on_demand_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_on_demand_load("glVertexAttribIPointer");
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
 }
-int GLAD_GL_VERSION_1_0 = 0;
-int GLAD_GL_VERSION_1_1 = 0;
-int GLAD_GL_VERSION_1_2 = 0;
-int GLAD_GL_VERSION_1_3 = 0;
-int GLAD_GL_VERSION_1_4 = 0;
-int GLAD_GL_VERSION_1_5 = 0;
-int GLAD_GL_VERSION_2_0 = 0;
-int GLAD_GL_VERSION_2_1 = 0;
-int GLAD_GL_VERSION_3_0 = 0;
-int GLAD_GL_VERSION_3_1 = 0;
-int GLAD_GL_VERSION_3_2 = 0;
-int GLAD_GL_VERSION_3_3 = 0;
-int GLAD_GL_VERSION_4_0 = 0;
-int GLAD_GL_VERSION_4_1 = 0;
-int GLAD_GL_VERSION_4_2 = 0;
-int GLAD_GL_VERSION_4_3 = 0;
-int GLAD_GL_VERSION_4_4 = 0;
-int GLAD_GL_VERSION_4_5 = 0;
-int GLAD_GL_VERSION_4_6 = 0;
-PFNGLACCUMPROC glad_glAccum = NULL;
-PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
-PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
-PFNGLALPHAFUNCPROC glad_glAlphaFunc = NULL;
-PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident = NULL;
-PFNGLARRAYELEMENTPROC glad_glArrayElement = NULL;
-PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
-PFNGLBEGINPROC glad_glBegin = NULL;
-PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
-PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
-PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
-PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
-PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
-PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
-PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
-PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
-PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase = NULL;
-PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange = NULL;
-PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
-PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
-PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
-PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures = NULL;
-PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
-PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
-PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
-PFNGLBINDSAMPLERSPROC glad_glBindSamplers = NULL;
-PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
-PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
-PFNGLBINDTEXTURESPROC glad_glBindTextures = NULL;
-PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
-PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
-PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = NULL;
-PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers = NULL;
-PFNGLBITMAPPROC glad_glBitmap = NULL;
-PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
-PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
-PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
-PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
-PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
-PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
-PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
-PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
-PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
-PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
-PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = NULL;
-PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
-PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
-PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
-PFNGLCALLLISTPROC glad_glCallList = NULL;
-PFNGLCALLLISTSPROC glad_glCallLists = NULL;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
-PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = NULL;
-PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
-PFNGLCLEARPROC glad_glClear = NULL;
-PFNGLCLEARACCUMPROC glad_glClearAccum = NULL;
-PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = NULL;
-PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = NULL;
-PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
-PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
-PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
-PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
-PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
-PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
-PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
-PFNGLCLEARINDEXPROC glad_glClearIndex = NULL;
-PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = NULL;
-PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = NULL;
-PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
-PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage = NULL;
-PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage = NULL;
-PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture = NULL;
-PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
-PFNGLCLIPCONTROLPROC glad_glClipControl = NULL;
-PFNGLCLIPPLANEPROC glad_glClipPlane = NULL;
-PFNGLCOLOR3BPROC glad_glColor3b = NULL;
-PFNGLCOLOR3BVPROC glad_glColor3bv = NULL;
-PFNGLCOLOR3DPROC glad_glColor3d = NULL;
-PFNGLCOLOR3DVPROC glad_glColor3dv = NULL;
-PFNGLCOLOR3FPROC glad_glColor3f = NULL;
-PFNGLCOLOR3FVPROC glad_glColor3fv = NULL;
-PFNGLCOLOR3IPROC glad_glColor3i = NULL;
-PFNGLCOLOR3IVPROC glad_glColor3iv = NULL;
-PFNGLCOLOR3SPROC glad_glColor3s = NULL;
-PFNGLCOLOR3SVPROC glad_glColor3sv = NULL;
-PFNGLCOLOR3UBPROC glad_glColor3ub = NULL;
-PFNGLCOLOR3UBVPROC glad_glColor3ubv = NULL;
-PFNGLCOLOR3UIPROC glad_glColor3ui = NULL;
-PFNGLCOLOR3UIVPROC glad_glColor3uiv = NULL;
-PFNGLCOLOR3USPROC glad_glColor3us = NULL;
-PFNGLCOLOR3USVPROC glad_glColor3usv = NULL;
-PFNGLCOLOR4BPROC glad_glColor4b = NULL;
-PFNGLCOLOR4BVPROC glad_glColor4bv = NULL;
-PFNGLCOLOR4DPROC glad_glColor4d = NULL;
-PFNGLCOLOR4DVPROC glad_glColor4dv = NULL;
-PFNGLCOLOR4FPROC glad_glColor4f = NULL;
-PFNGLCOLOR4FVPROC glad_glColor4fv = NULL;
-PFNGLCOLOR4IPROC glad_glColor4i = NULL;
-PFNGLCOLOR4IVPROC glad_glColor4iv = NULL;
-PFNGLCOLOR4SPROC glad_glColor4s = NULL;
-PFNGLCOLOR4SVPROC glad_glColor4sv = NULL;
-PFNGLCOLOR4UBPROC glad_glColor4ub = NULL;
-PFNGLCOLOR4UBVPROC glad_glColor4ubv = NULL;
-PFNGLCOLOR4UIPROC glad_glColor4ui = NULL;
-PFNGLCOLOR4UIVPROC glad_glColor4uiv = NULL;
-PFNGLCOLOR4USPROC glad_glColor4us = NULL;
-PFNGLCOLOR4USVPROC glad_glColor4usv = NULL;
-PFNGLCOLORMASKPROC glad_glColorMask = NULL;
-PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
-PFNGLCOLORMATERIALPROC glad_glColorMaterial = NULL;
-PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
-PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
-PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
-PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
-PFNGLCOLORPOINTERPROC glad_glColorPointer = NULL;
-PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = NULL;
-PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
-PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = NULL;
-PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = NULL;
-PFNGLCOPYPIXELSPROC glad_glCopyPixels = NULL;
-PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
-PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
-PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
-PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = NULL;
-PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = NULL;
-PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = NULL;
-PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
-PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = NULL;
-PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
-PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = NULL;
-PFNGLCREATEQUERIESPROC glad_glCreateQueries = NULL;
-PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = NULL;
-PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = NULL;
-PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
-PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
-PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
-PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = NULL;
-PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
-PFNGLCULLFACEPROC glad_glCullFace = NULL;
-PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
-PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
-PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
-PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
-PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
-PFNGLDELETELISTSPROC glad_glDeleteLists = NULL;
-PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
-PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
-PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
-PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
-PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
-PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
-PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
-PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
-PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
-PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
-PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
-PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
-PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
-PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
-PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
-PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
-PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
-PFNGLDISABLEPROC glad_glDisable = NULL;
-PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState = NULL;
-PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = NULL;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
-PFNGLDISABLEIPROC glad_glDisablei = NULL;
-PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = NULL;
-PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = NULL;
-PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
-PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
-PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
-PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
-PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
-PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
-PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
-PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
-PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
-PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
-PFNGLDRAWPIXELSPROC glad_glDrawPixels = NULL;
-PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
-PFNGLEDGEFLAGPROC glad_glEdgeFlag = NULL;
-PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer = NULL;
-PFNGLEDGEFLAGVPROC glad_glEdgeFlagv = NULL;
-PFNGLENABLEPROC glad_glEnable = NULL;
-PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState = NULL;
-PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = NULL;
-PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
-PFNGLENABLEIPROC glad_glEnablei = NULL;
-PFNGLENDPROC glad_glEnd = NULL;
-PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
-PFNGLENDLISTPROC glad_glEndList = NULL;
-PFNGLENDQUERYPROC glad_glEndQuery = NULL;
-PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
-PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
-PFNGLEVALCOORD1DPROC glad_glEvalCoord1d = NULL;
-PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv = NULL;
-PFNGLEVALCOORD1FPROC glad_glEvalCoord1f = NULL;
-PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv = NULL;
-PFNGLEVALCOORD2DPROC glad_glEvalCoord2d = NULL;
-PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv = NULL;
-PFNGLEVALCOORD2FPROC glad_glEvalCoord2f = NULL;
-PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv = NULL;
-PFNGLEVALMESH1PROC glad_glEvalMesh1 = NULL;
-PFNGLEVALMESH2PROC glad_glEvalMesh2 = NULL;
-PFNGLEVALPOINT1PROC glad_glEvalPoint1 = NULL;
-PFNGLEVALPOINT2PROC glad_glEvalPoint2 = NULL;
-PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer = NULL;
-PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
-PFNGLFINISHPROC glad_glFinish = NULL;
-PFNGLFLUSHPROC glad_glFlush = NULL;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
-PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = NULL;
-PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer = NULL;
-PFNGLFOGCOORDDPROC glad_glFogCoordd = NULL;
-PFNGLFOGCOORDDVPROC glad_glFogCoorddv = NULL;
-PFNGLFOGCOORDFPROC glad_glFogCoordf = NULL;
-PFNGLFOGCOORDFVPROC glad_glFogCoordfv = NULL;
-PFNGLFOGFPROC glad_glFogf = NULL;
-PFNGLFOGFVPROC glad_glFogfv = NULL;
-PFNGLFOGIPROC glad_glFogi = NULL;
-PFNGLFOGIVPROC glad_glFogiv = NULL;
-PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = NULL;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
-PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
-PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
-PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
-PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
-PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
-PFNGLFRUSTUMPROC glad_glFrustum = NULL;
-PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
-PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
-PFNGLGENLISTSPROC glad_glGenLists = NULL;
-PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
-PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
-PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
-PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
-PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
-PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
-PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
-PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
-PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
-PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
-PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
-PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
-PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
-PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
-PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
-PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
-PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
-PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
-PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
-PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
-PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
-PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
-PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
-PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
-PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
-PFNGLGETCLIPPLANEPROC glad_glGetClipPlane = NULL;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
-PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = NULL;
-PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage = NULL;
-PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
-PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
-PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
-PFNGLGETERRORPROC glad_glGetError = NULL;
-PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
-PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
-PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
-PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
-PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = NULL;
-PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus = NULL;
-PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
-PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
-PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
-PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
-PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = NULL;
-PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
-PFNGLGETLIGHTFVPROC glad_glGetLightfv = NULL;
-PFNGLGETLIGHTIVPROC glad_glGetLightiv = NULL;
-PFNGLGETMAPDVPROC glad_glGetMapdv = NULL;
-PFNGLGETMAPFVPROC glad_glGetMapfv = NULL;
-PFNGLGETMAPIVPROC glad_glGetMapiv = NULL;
-PFNGLGETMATERIALFVPROC glad_glGetMaterialfv = NULL;
-PFNGLGETMATERIALIVPROC glad_glGetMaterialiv = NULL;
-PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
-PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = NULL;
-PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = NULL;
-PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = NULL;
-PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = NULL;
-PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = NULL;
-PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = NULL;
-PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = NULL;
-PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
-PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
-PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv = NULL;
-PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv = NULL;
-PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv = NULL;
-PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
-PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple = NULL;
-PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
-PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
-PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = NULL;
-PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
-PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
-PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = NULL;
-PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = NULL;
-PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = NULL;
-PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = NULL;
-PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = NULL;
-PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
-PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
-PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = NULL;
-PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = NULL;
-PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = NULL;
-PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = NULL;
-PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
-PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
-PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
-PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
-PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
-PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
-PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
-PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
-PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
-PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
-PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
-PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
-PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
-PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
-PFNGLGETSTRINGPROC glad_glGetString = NULL;
-PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
-PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
-PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
-PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
-PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv = NULL;
-PFNGLGETTEXENVIVPROC glad_glGetTexEnviv = NULL;
-PFNGLGETTEXGENDVPROC glad_glGetTexGendv = NULL;
-PFNGLGETTEXGENFVPROC glad_glGetTexGenfv = NULL;
-PFNGLGETTEXGENIVPROC glad_glGetTexGeniv = NULL;
-PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
-PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
-PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
-PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
-PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
-PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
-PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
-PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = NULL;
-PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = NULL;
-PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = NULL;
-PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = NULL;
-PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = NULL;
-PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = NULL;
-PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = NULL;
-PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage = NULL;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
-PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = NULL;
-PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = NULL;
-PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = NULL;
-PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
-PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
-PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
-PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
-PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
-PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
-PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
-PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
-PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = NULL;
-PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = NULL;
-PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = NULL;
-PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
-PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
-PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
-PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
-PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
-PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
-PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
-PFNGLGETNCOLORTABLEPROC glad_glGetnColorTable = NULL;
-PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage = NULL;
-PFNGLGETNCONVOLUTIONFILTERPROC glad_glGetnConvolutionFilter = NULL;
-PFNGLGETNHISTOGRAMPROC glad_glGetnHistogram = NULL;
-PFNGLGETNMAPDVPROC glad_glGetnMapdv = NULL;
-PFNGLGETNMAPFVPROC glad_glGetnMapfv = NULL;
-PFNGLGETNMAPIVPROC glad_glGetnMapiv = NULL;
-PFNGLGETNMINMAXPROC glad_glGetnMinmax = NULL;
-PFNGLGETNPIXELMAPFVPROC glad_glGetnPixelMapfv = NULL;
-PFNGLGETNPIXELMAPUIVPROC glad_glGetnPixelMapuiv = NULL;
-PFNGLGETNPIXELMAPUSVPROC glad_glGetnPixelMapusv = NULL;
-PFNGLGETNPOLYGONSTIPPLEPROC glad_glGetnPolygonStipple = NULL;
-PFNGLGETNSEPARABLEFILTERPROC glad_glGetnSeparableFilter = NULL;
-PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage = NULL;
-PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv = NULL;
-PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv = NULL;
-PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv = NULL;
-PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv = NULL;
-PFNGLHINTPROC glad_glHint = NULL;
-PFNGLINDEXMASKPROC glad_glIndexMask = NULL;
-PFNGLINDEXPOINTERPROC glad_glIndexPointer = NULL;
-PFNGLINDEXDPROC glad_glIndexd = NULL;
-PFNGLINDEXDVPROC glad_glIndexdv = NULL;
-PFNGLINDEXFPROC glad_glIndexf = NULL;
-PFNGLINDEXFVPROC glad_glIndexfv = NULL;
-PFNGLINDEXIPROC glad_glIndexi = NULL;
-PFNGLINDEXIVPROC glad_glIndexiv = NULL;
-PFNGLINDEXSPROC glad_glIndexs = NULL;
-PFNGLINDEXSVPROC glad_glIndexsv = NULL;
-PFNGLINDEXUBPROC glad_glIndexub = NULL;
-PFNGLINDEXUBVPROC glad_glIndexubv = NULL;
-PFNGLINITNAMESPROC glad_glInitNames = NULL;
-PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays = NULL;
-PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
-PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
-PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
-PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = NULL;
-PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = NULL;
-PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
-PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
-PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
-PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
-PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
-PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
-PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
-PFNGLISLISTPROC glad_glIsList = NULL;
-PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
-PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
-PFNGLISQUERYPROC glad_glIsQuery = NULL;
-PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
-PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
-PFNGLISSHADERPROC glad_glIsShader = NULL;
-PFNGLISSYNCPROC glad_glIsSync = NULL;
-PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
-PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
-PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
-PFNGLLIGHTMODELFPROC glad_glLightModelf = NULL;
-PFNGLLIGHTMODELFVPROC glad_glLightModelfv = NULL;
-PFNGLLIGHTMODELIPROC glad_glLightModeli = NULL;
-PFNGLLIGHTMODELIVPROC glad_glLightModeliv = NULL;
-PFNGLLIGHTFPROC glad_glLightf = NULL;
-PFNGLLIGHTFVPROC glad_glLightfv = NULL;
-PFNGLLIGHTIPROC glad_glLighti = NULL;
-PFNGLLIGHTIVPROC glad_glLightiv = NULL;
-PFNGLLINESTIPPLEPROC glad_glLineStipple = NULL;
-PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
-PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
-PFNGLLISTBASEPROC glad_glListBase = NULL;
-PFNGLLOADIDENTITYPROC glad_glLoadIdentity = NULL;
-PFNGLLOADMATRIXDPROC glad_glLoadMatrixd = NULL;
-PFNGLLOADMATRIXFPROC glad_glLoadMatrixf = NULL;
-PFNGLLOADNAMEPROC glad_glLoadName = NULL;
-PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd = NULL;
-PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf = NULL;
-PFNGLLOGICOPPROC glad_glLogicOp = NULL;
-PFNGLMAP1DPROC glad_glMap1d = NULL;
-PFNGLMAP1FPROC glad_glMap1f = NULL;
-PFNGLMAP2DPROC glad_glMap2d = NULL;
-PFNGLMAP2FPROC glad_glMap2f = NULL;
-PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
-PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
-PFNGLMAPGRID1DPROC glad_glMapGrid1d = NULL;
-PFNGLMAPGRID1FPROC glad_glMapGrid1f = NULL;
-PFNGLMAPGRID2DPROC glad_glMapGrid2d = NULL;
-PFNGLMAPGRID2FPROC glad_glMapGrid2f = NULL;
-PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer = NULL;
-PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = NULL;
-PFNGLMATERIALFPROC glad_glMaterialf = NULL;
-PFNGLMATERIALFVPROC glad_glMaterialfv = NULL;
-PFNGLMATERIALIPROC glad_glMateriali = NULL;
-PFNGLMATERIALIVPROC glad_glMaterialiv = NULL;
-PFNGLMATRIXMODEPROC glad_glMatrixMode = NULL;
-PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
-PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion = NULL;
-PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
-PFNGLMULTMATRIXDPROC glad_glMultMatrixd = NULL;
-PFNGLMULTMATRIXFPROC glad_glMultMatrixf = NULL;
-PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd = NULL;
-PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf = NULL;
-PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
-PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
-PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_glMultiDrawArraysIndirectCount = NULL;
-PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
-PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
-PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_glMultiDrawElementsIndirectCount = NULL;
-PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d = NULL;
-PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv = NULL;
-PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f = NULL;
-PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv = NULL;
-PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i = NULL;
-PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv = NULL;
-PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s = NULL;
-PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv = NULL;
-PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d = NULL;
-PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv = NULL;
-PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f = NULL;
-PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv = NULL;
-PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i = NULL;
-PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv = NULL;
-PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s = NULL;
-PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv = NULL;
-PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d = NULL;
-PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv = NULL;
-PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f = NULL;
-PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv = NULL;
-PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i = NULL;
-PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv = NULL;
-PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s = NULL;
-PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv = NULL;
-PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d = NULL;
-PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv = NULL;
-PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f = NULL;
-PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv = NULL;
-PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i = NULL;
-PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv = NULL;
-PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s = NULL;
-PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv = NULL;
-PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
-PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
-PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
-PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
-PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
-PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
-PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
-PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
-PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
-PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
-PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = NULL;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = NULL;
-PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = NULL;
-PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = NULL;
-PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = NULL;
-PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = NULL;
-PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = NULL;
-PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = NULL;
-PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = NULL;
-PFNGLNEWLISTPROC glad_glNewList = NULL;
-PFNGLNORMAL3BPROC glad_glNormal3b = NULL;
-PFNGLNORMAL3BVPROC glad_glNormal3bv = NULL;
-PFNGLNORMAL3DPROC glad_glNormal3d = NULL;
-PFNGLNORMAL3DVPROC glad_glNormal3dv = NULL;
-PFNGLNORMAL3FPROC glad_glNormal3f = NULL;
-PFNGLNORMAL3FVPROC glad_glNormal3fv = NULL;
-PFNGLNORMAL3IPROC glad_glNormal3i = NULL;
-PFNGLNORMAL3IVPROC glad_glNormal3iv = NULL;
-PFNGLNORMAL3SPROC glad_glNormal3s = NULL;
-PFNGLNORMAL3SVPROC glad_glNormal3sv = NULL;
-PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
-PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
-PFNGLNORMALPOINTERPROC glad_glNormalPointer = NULL;
-PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
-PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
-PFNGLORTHOPROC glad_glOrtho = NULL;
-PFNGLPASSTHROUGHPROC glad_glPassThrough = NULL;
-PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
-PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
-PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
-PFNGLPIXELMAPFVPROC glad_glPixelMapfv = NULL;
-PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv = NULL;
-PFNGLPIXELMAPUSVPROC glad_glPixelMapusv = NULL;
-PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
-PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
-PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf = NULL;
-PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi = NULL;
-PFNGLPIXELZOOMPROC glad_glPixelZoom = NULL;
-PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
-PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
-PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
-PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
-PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
-PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
-PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
-PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp = NULL;
-PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple = NULL;
-PFNGLPOPATTRIBPROC glad_glPopAttrib = NULL;
-PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib = NULL;
-PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
-PFNGLPOPMATRIXPROC glad_glPopMatrix = NULL;
-PFNGLPOPNAMEPROC glad_glPopName = NULL;
-PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
-PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures = NULL;
-PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
-PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
-PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
-PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
-PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
-PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
-PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
-PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
-PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
-PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
-PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
-PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
-PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
-PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
-PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
-PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
-PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
-PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
-PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
-PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
-PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
-PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
-PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
-PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
-PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
-PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
-PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
-PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
-PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
-PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
-PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
-PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
-PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
-PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
-PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
-PFNGLPUSHATTRIBPROC glad_glPushAttrib = NULL;
-PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib = NULL;
-PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
-PFNGLPUSHMATRIXPROC glad_glPushMatrix = NULL;
-PFNGLPUSHNAMEPROC glad_glPushName = NULL;
-PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
-PFNGLRASTERPOS2DPROC glad_glRasterPos2d = NULL;
-PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv = NULL;
-PFNGLRASTERPOS2FPROC glad_glRasterPos2f = NULL;
-PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv = NULL;
-PFNGLRASTERPOS2IPROC glad_glRasterPos2i = NULL;
-PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv = NULL;
-PFNGLRASTERPOS2SPROC glad_glRasterPos2s = NULL;
-PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv = NULL;
-PFNGLRASTERPOS3DPROC glad_glRasterPos3d = NULL;
-PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv = NULL;
-PFNGLRASTERPOS3FPROC glad_glRasterPos3f = NULL;
-PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv = NULL;
-PFNGLRASTERPOS3IPROC glad_glRasterPos3i = NULL;
-PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv = NULL;
-PFNGLRASTERPOS3SPROC glad_glRasterPos3s = NULL;
-PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv = NULL;
-PFNGLRASTERPOS4DPROC glad_glRasterPos4d = NULL;
-PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv = NULL;
-PFNGLRASTERPOS4FPROC glad_glRasterPos4f = NULL;
-PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv = NULL;
-PFNGLRASTERPOS4IPROC glad_glRasterPos4i = NULL;
-PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv = NULL;
-PFNGLRASTERPOS4SPROC glad_glRasterPos4s = NULL;
-PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv = NULL;
-PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
-PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
-PFNGLREADNPIXELSPROC glad_glReadnPixels = NULL;
-PFNGLRECTDPROC glad_glRectd = NULL;
-PFNGLRECTDVPROC glad_glRectdv = NULL;
-PFNGLRECTFPROC glad_glRectf = NULL;
-PFNGLRECTFVPROC glad_glRectfv = NULL;
-PFNGLRECTIPROC glad_glRecti = NULL;
-PFNGLRECTIVPROC glad_glRectiv = NULL;
-PFNGLRECTSPROC glad_glRects = NULL;
-PFNGLRECTSVPROC glad_glRectsv = NULL;
-PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
-PFNGLRENDERMODEPROC glad_glRenderMode = NULL;
-PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
-PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
-PFNGLROTATEDPROC glad_glRotated = NULL;
-PFNGLROTATEFPROC glad_glRotatef = NULL;
-PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
-PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
-PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
-PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
-PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
-PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
-PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
-PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
-PFNGLSCALEDPROC glad_glScaled = NULL;
-PFNGLSCALEFPROC glad_glScalef = NULL;
-PFNGLSCISSORPROC glad_glScissor = NULL;
-PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
-PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
-PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
-PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b = NULL;
-PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv = NULL;
-PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d = NULL;
-PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv = NULL;
-PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f = NULL;
-PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv = NULL;
-PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i = NULL;
-PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv = NULL;
-PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s = NULL;
-PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv = NULL;
-PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub = NULL;
-PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv = NULL;
-PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui = NULL;
-PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv = NULL;
-PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us = NULL;
-PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv = NULL;
-PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
-PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
-PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer = NULL;
-PFNGLSELECTBUFFERPROC glad_glSelectBuffer = NULL;
-PFNGLSHADEMODELPROC glad_glShadeModel = NULL;
-PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
-PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
-PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = NULL;
-PFNGLSPECIALIZESHADERPROC glad_glSpecializeShader = NULL;
-PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
-PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
-PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
-PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
-PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
-PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
-PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
-PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = NULL;
-PFNGLTEXCOORD1DPROC glad_glTexCoord1d = NULL;
-PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv = NULL;
-PFNGLTEXCOORD1FPROC glad_glTexCoord1f = NULL;
-PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv = NULL;
-PFNGLTEXCOORD1IPROC glad_glTexCoord1i = NULL;
-PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv = NULL;
-PFNGLTEXCOORD1SPROC glad_glTexCoord1s = NULL;
-PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv = NULL;
-PFNGLTEXCOORD2DPROC glad_glTexCoord2d = NULL;
-PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv = NULL;
-PFNGLTEXCOORD2FPROC glad_glTexCoord2f = NULL;
-PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv = NULL;
-PFNGLTEXCOORD2IPROC glad_glTexCoord2i = NULL;
-PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv = NULL;
-PFNGLTEXCOORD2SPROC glad_glTexCoord2s = NULL;
-PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv = NULL;
-PFNGLTEXCOORD3DPROC glad_glTexCoord3d = NULL;
-PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv = NULL;
-PFNGLTEXCOORD3FPROC glad_glTexCoord3f = NULL;
-PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv = NULL;
-PFNGLTEXCOORD3IPROC glad_glTexCoord3i = NULL;
-PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv = NULL;
-PFNGLTEXCOORD3SPROC glad_glTexCoord3s = NULL;
-PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv = NULL;
-PFNGLTEXCOORD4DPROC glad_glTexCoord4d = NULL;
-PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv = NULL;
-PFNGLTEXCOORD4FPROC glad_glTexCoord4f = NULL;
-PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv = NULL;
-PFNGLTEXCOORD4IPROC glad_glTexCoord4i = NULL;
-PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv = NULL;
-PFNGLTEXCOORD4SPROC glad_glTexCoord4s = NULL;
-PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv = NULL;
-PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
-PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
-PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
-PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
-PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
-PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
-PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
-PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
-PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer = NULL;
-PFNGLTEXENVFPROC glad_glTexEnvf = NULL;
-PFNGLTEXENVFVPROC glad_glTexEnvfv = NULL;
-PFNGLTEXENVIPROC glad_glTexEnvi = NULL;
-PFNGLTEXENVIVPROC glad_glTexEnviv = NULL;
-PFNGLTEXGENDPROC glad_glTexGend = NULL;
-PFNGLTEXGENDVPROC glad_glTexGendv = NULL;
-PFNGLTEXGENFPROC glad_glTexGenf = NULL;
-PFNGLTEXGENFVPROC glad_glTexGenfv = NULL;
-PFNGLTEXGENIPROC glad_glTexGeni = NULL;
-PFNGLTEXGENIVPROC glad_glTexGeniv = NULL;
-PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
-PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
-PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
-PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
-PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
-PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
-PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
-PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
-PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
-PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
-PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
-PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = NULL;
-PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
-PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = NULL;
-PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
-PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
-PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
-PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier = NULL;
-PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = NULL;
-PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = NULL;
-PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = NULL;
-PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = NULL;
-PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = NULL;
-PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = NULL;
-PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
-PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = NULL;
-PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = NULL;
-PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
-PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = NULL;
-PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = NULL;
-PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = NULL;
-PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = NULL;
-PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
-PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = NULL;
-PFNGLTEXTUREVIEWPROC glad_glTextureView = NULL;
-PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = NULL;
-PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = NULL;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
-PFNGLTRANSLATEDPROC glad_glTranslated = NULL;
-PFNGLTRANSLATEFPROC glad_glTranslatef = NULL;
-PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
-PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
-PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
-PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
-PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
-PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
-PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
-PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
-PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
-PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
-PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
-PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
-PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
-PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
-PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
-PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
-PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
-PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
-PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
-PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
-PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
-PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
-PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
-PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
-PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
-PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
-PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
-PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
-PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
-PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
-PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
-PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
-PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
-PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
-PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
-PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
-PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
-PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
-PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
-PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
-PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
-PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
-PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
-PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
-PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
-PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
-PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
-PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
-PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
-PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
-PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
-PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
-PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
-PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
-PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
-PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
-PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
-PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
-PFNGLVERTEX2DPROC glad_glVertex2d = NULL;
-PFNGLVERTEX2DVPROC glad_glVertex2dv = NULL;
-PFNGLVERTEX2FPROC glad_glVertex2f = NULL;
-PFNGLVERTEX2FVPROC glad_glVertex2fv = NULL;
-PFNGLVERTEX2IPROC glad_glVertex2i = NULL;
-PFNGLVERTEX2IVPROC glad_glVertex2iv = NULL;
-PFNGLVERTEX2SPROC glad_glVertex2s = NULL;
-PFNGLVERTEX2SVPROC glad_glVertex2sv = NULL;
-PFNGLVERTEX3DPROC glad_glVertex3d = NULL;
-PFNGLVERTEX3DVPROC glad_glVertex3dv = NULL;
-PFNGLVERTEX3FPROC glad_glVertex3f = NULL;
-PFNGLVERTEX3FVPROC glad_glVertex3fv = NULL;
-PFNGLVERTEX3IPROC glad_glVertex3i = NULL;
-PFNGLVERTEX3IVPROC glad_glVertex3iv = NULL;
-PFNGLVERTEX3SPROC glad_glVertex3s = NULL;
-PFNGLVERTEX3SVPROC glad_glVertex3sv = NULL;
-PFNGLVERTEX4DPROC glad_glVertex4d = NULL;
-PFNGLVERTEX4DVPROC glad_glVertex4dv = NULL;
-PFNGLVERTEX4FPROC glad_glVertex4f = NULL;
-PFNGLVERTEX4FVPROC glad_glVertex4fv = NULL;
-PFNGLVERTEX4IPROC glad_glVertex4i = NULL;
-PFNGLVERTEX4IVPROC glad_glVertex4iv = NULL;
-PFNGLVERTEX4SPROC glad_glVertex4s = NULL;
-PFNGLVERTEX4SVPROC glad_glVertex4sv = NULL;
-PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = NULL;
-PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = NULL;
-PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = NULL;
-PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = NULL;
-PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = NULL;
-PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = NULL;
-PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = NULL;
-PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = NULL;
-PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
-PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
-PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
-PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
-PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
-PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
-PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
-PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
-PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
-PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
-PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
-PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
-PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
-PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
-PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
-PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
-PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
-PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
-PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
-PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
-PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
-PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
-PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
-PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
-PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
-PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
-PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
-PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
-PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
-PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
-PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
-PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
-PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
-PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
-PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
-PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
-PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = NULL;
-PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
-PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = NULL;
-PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
-PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
-PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
-PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
-PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
-PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
-PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
-PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
-PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
-PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
-PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
-PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
-PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
-PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
-PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
-PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
-PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
-PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
-PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
-PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
-PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = NULL;
-PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
-PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
-PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
-PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
-PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
-PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
-PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
-PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
-PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
-PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = NULL;
-PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
-PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
-PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
-PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
-PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
-PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
-PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
-PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
-PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
-PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
-PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = NULL;
-PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
-PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
-PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
-PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
-PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
-PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
-PFNGLVERTEXPOINTERPROC glad_glVertexPointer = NULL;
-PFNGLVIEWPORTPROC glad_glViewport = NULL;
-PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
-PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
-PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
-PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
-PFNGLWINDOWPOS2DPROC glad_glWindowPos2d = NULL;
-PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv = NULL;
-PFNGLWINDOWPOS2FPROC glad_glWindowPos2f = NULL;
-PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv = NULL;
-PFNGLWINDOWPOS2IPROC glad_glWindowPos2i = NULL;
-PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv = NULL;
-PFNGLWINDOWPOS2SPROC glad_glWindowPos2s = NULL;
-PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv = NULL;
-PFNGLWINDOWPOS3DPROC glad_glWindowPos3d = NULL;
-PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv = NULL;
-PFNGLWINDOWPOS3FPROC glad_glWindowPos3f = NULL;
-PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv = NULL;
-PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
-PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
-PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
-PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+static void APIENTRY glad_on_demand_glVertexAttribL1d(GLuint index, GLdouble x) {
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)glad_on_demand_load("glVertexAttribL1d");
+	glad_glVertexAttribL1d(index, x);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)glad_on_demand_load("glVertexAttribL1dv");
+	glad_glVertexAttribL1dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)glad_on_demand_load("glVertexAttribL2d");
+	glad_glVertexAttribL2d(index, x, y);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)glad_on_demand_load("glVertexAttribL2dv");
+	glad_glVertexAttribL2dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)glad_on_demand_load("glVertexAttribL3d");
+	glad_glVertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)glad_on_demand_load("glVertexAttribL3dv");
+	glad_glVertexAttribL3dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)glad_on_demand_load("glVertexAttribL4d");
+	glad_glVertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY glad_on_demand_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)glad_on_demand_load("glVertexAttribL4dv");
+	glad_glVertexAttribL4dv(index, v);
+}
+static void APIENTRY glad_on_demand_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)glad_on_demand_load("glVertexAttribLFormat");
+	glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_on_demand_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)glad_on_demand_load("glVertexAttribLPointer");
+	glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_on_demand_load("glVertexAttribP1ui");
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_on_demand_load("glVertexAttribP1uiv");
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_on_demand_load("glVertexAttribP2ui");
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_on_demand_load("glVertexAttribP2uiv");
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_on_demand_load("glVertexAttribP3ui");
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_on_demand_load("glVertexAttribP3uiv");
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_on_demand_load("glVertexAttribP4ui");
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_on_demand_load("glVertexAttribP4uiv");
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_on_demand_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_on_demand_load("glVertexAttribPointer");
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_on_demand_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)glad_on_demand_load("glVertexBindingDivisor");
+	glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY glad_on_demand_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_on_demand_load("glVertexP2ui");
+	glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_on_demand_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_on_demand_load("glVertexP2uiv");
+	glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_on_demand_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_on_demand_load("glVertexP3ui");
+	glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_on_demand_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_on_demand_load("glVertexP3uiv");
+	glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_on_demand_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_on_demand_load("glVertexP4ui");
+	glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_on_demand_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_on_demand_load("glVertexP4uiv");
+	glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_on_demand_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *ptr) {
+	glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)glad_on_demand_load("glVertexPointer");
+	glad_glVertexPointer(size, type, stride, ptr);
+}
+static void APIENTRY glad_on_demand_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)glad_on_demand_load("glViewport");
+	glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_on_demand_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)glad_on_demand_load("glViewportArrayv");
+	glad_glViewportArrayv(first, count, v);
+}
+static void APIENTRY glad_on_demand_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)glad_on_demand_load("glViewportIndexedf");
+	glad_glViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY glad_on_demand_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)glad_on_demand_load("glViewportIndexedfv");
+	glad_glViewportIndexedfv(index, v);
+}
+static void APIENTRY glad_on_demand_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)glad_on_demand_load("glWaitSync");
+	glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_on_demand_glWindowPos2d(GLdouble x, GLdouble y) {
+	glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)glad_on_demand_load("glWindowPos2d");
+	glad_glWindowPos2d(x, y);
+}
+static void APIENTRY glad_on_demand_glWindowPos2dv(const GLdouble *v) {
+	glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)glad_on_demand_load("glWindowPos2dv");
+	glad_glWindowPos2dv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos2f(GLfloat x, GLfloat y) {
+	glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)glad_on_demand_load("glWindowPos2f");
+	glad_glWindowPos2f(x, y);
+}
+static void APIENTRY glad_on_demand_glWindowPos2fv(const GLfloat *v) {
+	glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)glad_on_demand_load("glWindowPos2fv");
+	glad_glWindowPos2fv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos2i(GLint x, GLint y) {
+	glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)glad_on_demand_load("glWindowPos2i");
+	glad_glWindowPos2i(x, y);
+}
+static void APIENTRY glad_on_demand_glWindowPos2iv(const GLint *v) {
+	glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)glad_on_demand_load("glWindowPos2iv");
+	glad_glWindowPos2iv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos2s(GLshort x, GLshort y) {
+	glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)glad_on_demand_load("glWindowPos2s");
+	glad_glWindowPos2s(x, y);
+}
+static void APIENTRY glad_on_demand_glWindowPos2sv(const GLshort *v) {
+	glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)glad_on_demand_load("glWindowPos2sv");
+	glad_glWindowPos2sv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)glad_on_demand_load("glWindowPos3d");
+	glad_glWindowPos3d(x, y, z);
+}
+static void APIENTRY glad_on_demand_glWindowPos3dv(const GLdouble *v) {
+	glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)glad_on_demand_load("glWindowPos3dv");
+	glad_glWindowPos3dv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)glad_on_demand_load("glWindowPos3f");
+	glad_glWindowPos3f(x, y, z);
+}
+static void APIENTRY glad_on_demand_glWindowPos3fv(const GLfloat *v) {
+	glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)glad_on_demand_load("glWindowPos3fv");
+	glad_glWindowPos3fv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos3i(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)glad_on_demand_load("glWindowPos3i");
+	glad_glWindowPos3i(x, y, z);
+}
+static void APIENTRY glad_on_demand_glWindowPos3iv(const GLint *v) {
+	glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)glad_on_demand_load("glWindowPos3iv");
+	glad_glWindowPos3iv(v);
+}
+static void APIENTRY glad_on_demand_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)glad_on_demand_load("glWindowPos3s");
+	glad_glWindowPos3s(x, y, z);
+}
+static void APIENTRY glad_on_demand_glWindowPos3sv(const GLshort *v) {
+	glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)glad_on_demand_load("glWindowPos3sv");
+	glad_glWindowPos3sv(v);
+}
+#define GLAD_INITIAL_PROC(name) glad_on_demand_##name
+#else
+#define GLAD_INITIAL_PROC(name) NULL
+#endif
+PFNGLACCUMPROC glad_glAccum = GLAD_INITIAL_PROC(glAccum);
+PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = GLAD_INITIAL_PROC(glActiveShaderProgram);
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture = GLAD_INITIAL_PROC(glActiveTexture);
+PFNGLALPHAFUNCPROC glad_glAlphaFunc = GLAD_INITIAL_PROC(glAlphaFunc);
+PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident = GLAD_INITIAL_PROC(glAreTexturesResident);
+PFNGLARRAYELEMENTPROC glad_glArrayElement = GLAD_INITIAL_PROC(glArrayElement);
+PFNGLATTACHSHADERPROC glad_glAttachShader = GLAD_INITIAL_PROC(glAttachShader);
+PFNGLBEGINPROC glad_glBegin = GLAD_INITIAL_PROC(glBegin);
+PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = GLAD_INITIAL_PROC(glBeginConditionalRender);
+PFNGLBEGINQUERYPROC glad_glBeginQuery = GLAD_INITIAL_PROC(glBeginQuery);
+PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = GLAD_INITIAL_PROC(glBeginQueryIndexed);
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = GLAD_INITIAL_PROC(glBeginTransformFeedback);
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = GLAD_INITIAL_PROC(glBindAttribLocation);
+PFNGLBINDBUFFERPROC glad_glBindBuffer = GLAD_INITIAL_PROC(glBindBuffer);
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = GLAD_INITIAL_PROC(glBindBufferBase);
+PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = GLAD_INITIAL_PROC(glBindBufferRange);
+PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase = GLAD_INITIAL_PROC(glBindBuffersBase);
+PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange = GLAD_INITIAL_PROC(glBindBuffersRange);
+PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = GLAD_INITIAL_PROC(glBindFragDataLocation);
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = GLAD_INITIAL_PROC(glBindFragDataLocationIndexed);
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = GLAD_INITIAL_PROC(glBindFramebuffer);
+PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = GLAD_INITIAL_PROC(glBindImageTexture);
+PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures = GLAD_INITIAL_PROC(glBindImageTextures);
+PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = GLAD_INITIAL_PROC(glBindProgramPipeline);
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = GLAD_INITIAL_PROC(glBindRenderbuffer);
+PFNGLBINDSAMPLERPROC glad_glBindSampler = GLAD_INITIAL_PROC(glBindSampler);
+PFNGLBINDSAMPLERSPROC glad_glBindSamplers = GLAD_INITIAL_PROC(glBindSamplers);
+PFNGLBINDTEXTUREPROC glad_glBindTexture = GLAD_INITIAL_PROC(glBindTexture);
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = GLAD_INITIAL_PROC(glBindTextureUnit);
+PFNGLBINDTEXTURESPROC glad_glBindTextures = GLAD_INITIAL_PROC(glBindTextures);
+PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = GLAD_INITIAL_PROC(glBindTransformFeedback);
+PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = GLAD_INITIAL_PROC(glBindVertexArray);
+PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = GLAD_INITIAL_PROC(glBindVertexBuffer);
+PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers = GLAD_INITIAL_PROC(glBindVertexBuffers);
+PFNGLBITMAPPROC glad_glBitmap = GLAD_INITIAL_PROC(glBitmap);
+PFNGLBLENDCOLORPROC glad_glBlendColor = GLAD_INITIAL_PROC(glBlendColor);
+PFNGLBLENDEQUATIONPROC glad_glBlendEquation = GLAD_INITIAL_PROC(glBlendEquation);
+PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = GLAD_INITIAL_PROC(glBlendEquationSeparate);
+PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = GLAD_INITIAL_PROC(glBlendEquationSeparatei);
+PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = GLAD_INITIAL_PROC(glBlendEquationi);
+PFNGLBLENDFUNCPROC glad_glBlendFunc = GLAD_INITIAL_PROC(glBlendFunc);
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = GLAD_INITIAL_PROC(glBlendFuncSeparate);
+PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = GLAD_INITIAL_PROC(glBlendFuncSeparatei);
+PFNGLBLENDFUNCIPROC glad_glBlendFunci = GLAD_INITIAL_PROC(glBlendFunci);
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = GLAD_INITIAL_PROC(glBlitFramebuffer);
+PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = GLAD_INITIAL_PROC(glBlitNamedFramebuffer);
+PFNGLBUFFERDATAPROC glad_glBufferData = GLAD_INITIAL_PROC(glBufferData);
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = GLAD_INITIAL_PROC(glBufferStorage);
+PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = GLAD_INITIAL_PROC(glBufferSubData);
+PFNGLCALLLISTPROC glad_glCallList = GLAD_INITIAL_PROC(glCallList);
+PFNGLCALLLISTSPROC glad_glCallLists = GLAD_INITIAL_PROC(glCallLists);
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = GLAD_INITIAL_PROC(glCheckFramebufferStatus);
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = GLAD_INITIAL_PROC(glCheckNamedFramebufferStatus);
+PFNGLCLAMPCOLORPROC glad_glClampColor = GLAD_INITIAL_PROC(glClampColor);
+PFNGLCLEARPROC glad_glClear = GLAD_INITIAL_PROC(glClear);
+PFNGLCLEARACCUMPROC glad_glClearAccum = GLAD_INITIAL_PROC(glClearAccum);
+PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = GLAD_INITIAL_PROC(glClearBufferData);
+PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = GLAD_INITIAL_PROC(glClearBufferSubData);
+PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = GLAD_INITIAL_PROC(glClearBufferfi);
+PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = GLAD_INITIAL_PROC(glClearBufferfv);
+PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = GLAD_INITIAL_PROC(glClearBufferiv);
+PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = GLAD_INITIAL_PROC(glClearBufferuiv);
+PFNGLCLEARCOLORPROC glad_glClearColor = GLAD_INITIAL_PROC(glClearColor);
+PFNGLCLEARDEPTHPROC glad_glClearDepth = GLAD_INITIAL_PROC(glClearDepth);
+PFNGLCLEARDEPTHFPROC glad_glClearDepthf = GLAD_INITIAL_PROC(glClearDepthf);
+PFNGLCLEARINDEXPROC glad_glClearIndex = GLAD_INITIAL_PROC(glClearIndex);
+PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = GLAD_INITIAL_PROC(glClearNamedBufferData);
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = GLAD_INITIAL_PROC(glClearNamedBufferSubData);
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = GLAD_INITIAL_PROC(glClearNamedFramebufferfi);
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = GLAD_INITIAL_PROC(glClearNamedFramebufferfv);
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = GLAD_INITIAL_PROC(glClearNamedFramebufferiv);
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = GLAD_INITIAL_PROC(glClearNamedFramebufferuiv);
+PFNGLCLEARSTENCILPROC glad_glClearStencil = GLAD_INITIAL_PROC(glClearStencil);
+PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage = GLAD_INITIAL_PROC(glClearTexImage);
+PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage = GLAD_INITIAL_PROC(glClearTexSubImage);
+PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture = GLAD_INITIAL_PROC(glClientActiveTexture);
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = GLAD_INITIAL_PROC(glClientWaitSync);
+PFNGLCLIPCONTROLPROC glad_glClipControl = GLAD_INITIAL_PROC(glClipControl);
+PFNGLCLIPPLANEPROC glad_glClipPlane = GLAD_INITIAL_PROC(glClipPlane);
+PFNGLCOLOR3BPROC glad_glColor3b = GLAD_INITIAL_PROC(glColor3b);
+PFNGLCOLOR3BVPROC glad_glColor3bv = GLAD_INITIAL_PROC(glColor3bv);
+PFNGLCOLOR3DPROC glad_glColor3d = GLAD_INITIAL_PROC(glColor3d);
+PFNGLCOLOR3DVPROC glad_glColor3dv = GLAD_INITIAL_PROC(glColor3dv);
+PFNGLCOLOR3FPROC glad_glColor3f = GLAD_INITIAL_PROC(glColor3f);
+PFNGLCOLOR3FVPROC glad_glColor3fv = GLAD_INITIAL_PROC(glColor3fv);
+PFNGLCOLOR3IPROC glad_glColor3i = GLAD_INITIAL_PROC(glColor3i);
+PFNGLCOLOR3IVPROC glad_glColor3iv = GLAD_INITIAL_PROC(glColor3iv);
+PFNGLCOLOR3SPROC glad_glColor3s = GLAD_INITIAL_PROC(glColor3s);
+PFNGLCOLOR3SVPROC glad_glColor3sv = GLAD_INITIAL_PROC(glColor3sv);
+PFNGLCOLOR3UBPROC glad_glColor3ub = GLAD_INITIAL_PROC(glColor3ub);
+PFNGLCOLOR3UBVPROC glad_glColor3ubv = GLAD_INITIAL_PROC(glColor3ubv);
+PFNGLCOLOR3UIPROC glad_glColor3ui = GLAD_INITIAL_PROC(glColor3ui);
+PFNGLCOLOR3UIVPROC glad_glColor3uiv = GLAD_INITIAL_PROC(glColor3uiv);
+PFNGLCOLOR3USPROC glad_glColor3us = GLAD_INITIAL_PROC(glColor3us);
+PFNGLCOLOR3USVPROC glad_glColor3usv = GLAD_INITIAL_PROC(glColor3usv);
+PFNGLCOLOR4BPROC glad_glColor4b = GLAD_INITIAL_PROC(glColor4b);
+PFNGLCOLOR4BVPROC glad_glColor4bv = GLAD_INITIAL_PROC(glColor4bv);
+PFNGLCOLOR4DPROC glad_glColor4d = GLAD_INITIAL_PROC(glColor4d);
+PFNGLCOLOR4DVPROC glad_glColor4dv = GLAD_INITIAL_PROC(glColor4dv);
+PFNGLCOLOR4FPROC glad_glColor4f = GLAD_INITIAL_PROC(glColor4f);
+PFNGLCOLOR4FVPROC glad_glColor4fv = GLAD_INITIAL_PROC(glColor4fv);
+PFNGLCOLOR4IPROC glad_glColor4i = GLAD_INITIAL_PROC(glColor4i);
+PFNGLCOLOR4IVPROC glad_glColor4iv = GLAD_INITIAL_PROC(glColor4iv);
+PFNGLCOLOR4SPROC glad_glColor4s = GLAD_INITIAL_PROC(glColor4s);
+PFNGLCOLOR4SVPROC glad_glColor4sv = GLAD_INITIAL_PROC(glColor4sv);
+PFNGLCOLOR4UBPROC glad_glColor4ub = GLAD_INITIAL_PROC(glColor4ub);
+PFNGLCOLOR4UBVPROC glad_glColor4ubv = GLAD_INITIAL_PROC(glColor4ubv);
+PFNGLCOLOR4UIPROC glad_glColor4ui = GLAD_INITIAL_PROC(glColor4ui);
+PFNGLCOLOR4UIVPROC glad_glColor4uiv = GLAD_INITIAL_PROC(glColor4uiv);
+PFNGLCOLOR4USPROC glad_glColor4us = GLAD_INITIAL_PROC(glColor4us);
+PFNGLCOLOR4USVPROC glad_glColor4usv = GLAD_INITIAL_PROC(glColor4usv);
+PFNGLCOLORMASKPROC glad_glColorMask = GLAD_INITIAL_PROC(glColorMask);
+PFNGLCOLORMASKIPROC glad_glColorMaski = GLAD_INITIAL_PROC(glColorMaski);
+PFNGLCOLORMATERIALPROC glad_glColorMaterial = GLAD_INITIAL_PROC(glColorMaterial);
+PFNGLCOLORP3UIPROC glad_glColorP3ui = GLAD_INITIAL_PROC(glColorP3ui);
+PFNGLCOLORP3UIVPROC glad_glColorP3uiv = GLAD_INITIAL_PROC(glColorP3uiv);
+PFNGLCOLORP4UIPROC glad_glColorP4ui = GLAD_INITIAL_PROC(glColorP4ui);
+PFNGLCOLORP4UIVPROC glad_glColorP4uiv = GLAD_INITIAL_PROC(glColorP4uiv);
+PFNGLCOLORPOINTERPROC glad_glColorPointer = GLAD_INITIAL_PROC(glColorPointer);
+PFNGLCOMPILESHADERPROC glad_glCompileShader = GLAD_INITIAL_PROC(glCompileShader);
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = GLAD_INITIAL_PROC(glCompressedTexImage1D);
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = GLAD_INITIAL_PROC(glCompressedTexImage2D);
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = GLAD_INITIAL_PROC(glCompressedTexImage3D);
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = GLAD_INITIAL_PROC(glCompressedTexSubImage1D);
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = GLAD_INITIAL_PROC(glCompressedTexSubImage2D);
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = GLAD_INITIAL_PROC(glCompressedTexSubImage3D);
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = GLAD_INITIAL_PROC(glCompressedTextureSubImage1D);
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = GLAD_INITIAL_PROC(glCompressedTextureSubImage2D);
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = GLAD_INITIAL_PROC(glCompressedTextureSubImage3D);
+PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = GLAD_INITIAL_PROC(glCopyBufferSubData);
+PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = GLAD_INITIAL_PROC(glCopyImageSubData);
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = GLAD_INITIAL_PROC(glCopyNamedBufferSubData);
+PFNGLCOPYPIXELSPROC glad_glCopyPixels = GLAD_INITIAL_PROC(glCopyPixels);
+PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = GLAD_INITIAL_PROC(glCopyTexImage1D);
+PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = GLAD_INITIAL_PROC(glCopyTexImage2D);
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = GLAD_INITIAL_PROC(glCopyTexSubImage1D);
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = GLAD_INITIAL_PROC(glCopyTexSubImage2D);
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = GLAD_INITIAL_PROC(glCopyTexSubImage3D);
+PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = GLAD_INITIAL_PROC(glCopyTextureSubImage1D);
+PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = GLAD_INITIAL_PROC(glCopyTextureSubImage2D);
+PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = GLAD_INITIAL_PROC(glCopyTextureSubImage3D);
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = GLAD_INITIAL_PROC(glCreateBuffers);
+PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = GLAD_INITIAL_PROC(glCreateFramebuffers);
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram = GLAD_INITIAL_PROC(glCreateProgram);
+PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = GLAD_INITIAL_PROC(glCreateProgramPipelines);
+PFNGLCREATEQUERIESPROC glad_glCreateQueries = GLAD_INITIAL_PROC(glCreateQueries);
+PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = GLAD_INITIAL_PROC(glCreateRenderbuffers);
+PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = GLAD_INITIAL_PROC(glCreateSamplers);
+PFNGLCREATESHADERPROC glad_glCreateShader = GLAD_INITIAL_PROC(glCreateShader);
+PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = GLAD_INITIAL_PROC(glCreateShaderProgramv);
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = GLAD_INITIAL_PROC(glCreateTextures);
+PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = GLAD_INITIAL_PROC(glCreateTransformFeedbacks);
+PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = GLAD_INITIAL_PROC(glCreateVertexArrays);
+PFNGLCULLFACEPROC glad_glCullFace = GLAD_INITIAL_PROC(glCullFace);
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = GLAD_INITIAL_PROC(glDebugMessageCallback);
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = GLAD_INITIAL_PROC(glDebugMessageControl);
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = GLAD_INITIAL_PROC(glDebugMessageInsert);
+PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = GLAD_INITIAL_PROC(glDeleteBuffers);
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = GLAD_INITIAL_PROC(glDeleteFramebuffers);
+PFNGLDELETELISTSPROC glad_glDeleteLists = GLAD_INITIAL_PROC(glDeleteLists);
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = GLAD_INITIAL_PROC(glDeleteProgram);
+PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = GLAD_INITIAL_PROC(glDeleteProgramPipelines);
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries = GLAD_INITIAL_PROC(glDeleteQueries);
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = GLAD_INITIAL_PROC(glDeleteRenderbuffers);
+PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = GLAD_INITIAL_PROC(glDeleteSamplers);
+PFNGLDELETESHADERPROC glad_glDeleteShader = GLAD_INITIAL_PROC(glDeleteShader);
+PFNGLDELETESYNCPROC glad_glDeleteSync = GLAD_INITIAL_PROC(glDeleteSync);
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures = GLAD_INITIAL_PROC(glDeleteTextures);
+PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = GLAD_INITIAL_PROC(glDeleteTransformFeedbacks);
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = GLAD_INITIAL_PROC(glDeleteVertexArrays);
+PFNGLDEPTHFUNCPROC glad_glDepthFunc = GLAD_INITIAL_PROC(glDepthFunc);
+PFNGLDEPTHMASKPROC glad_glDepthMask = GLAD_INITIAL_PROC(glDepthMask);
+PFNGLDEPTHRANGEPROC glad_glDepthRange = GLAD_INITIAL_PROC(glDepthRange);
+PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = GLAD_INITIAL_PROC(glDepthRangeArrayv);
+PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = GLAD_INITIAL_PROC(glDepthRangeIndexed);
+PFNGLDEPTHRANGEFPROC glad_glDepthRangef = GLAD_INITIAL_PROC(glDepthRangef);
+PFNGLDETACHSHADERPROC glad_glDetachShader = GLAD_INITIAL_PROC(glDetachShader);
+PFNGLDISABLEPROC glad_glDisable = GLAD_INITIAL_PROC(glDisable);
+PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState = GLAD_INITIAL_PROC(glDisableClientState);
+PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = GLAD_INITIAL_PROC(glDisableVertexArrayAttrib);
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = GLAD_INITIAL_PROC(glDisableVertexAttribArray);
+PFNGLDISABLEIPROC glad_glDisablei = GLAD_INITIAL_PROC(glDisablei);
+PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = GLAD_INITIAL_PROC(glDispatchCompute);
+PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = GLAD_INITIAL_PROC(glDispatchComputeIndirect);
+PFNGLDRAWARRAYSPROC glad_glDrawArrays = GLAD_INITIAL_PROC(glDrawArrays);
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = GLAD_INITIAL_PROC(glDrawArraysIndirect);
+PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = GLAD_INITIAL_PROC(glDrawArraysInstanced);
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = GLAD_INITIAL_PROC(glDrawArraysInstancedBaseInstance);
+PFNGLDRAWBUFFERPROC glad_glDrawBuffer = GLAD_INITIAL_PROC(glDrawBuffer);
+PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = GLAD_INITIAL_PROC(glDrawBuffers);
+PFNGLDRAWELEMENTSPROC glad_glDrawElements = GLAD_INITIAL_PROC(glDrawElements);
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = GLAD_INITIAL_PROC(glDrawElementsBaseVertex);
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = GLAD_INITIAL_PROC(glDrawElementsIndirect);
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = GLAD_INITIAL_PROC(glDrawElementsInstanced);
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = GLAD_INITIAL_PROC(glDrawElementsInstancedBaseInstance);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = GLAD_INITIAL_PROC(glDrawElementsInstancedBaseVertex);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = GLAD_INITIAL_PROC(glDrawElementsInstancedBaseVertexBaseInstance);
+PFNGLDRAWPIXELSPROC glad_glDrawPixels = GLAD_INITIAL_PROC(glDrawPixels);
+PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = GLAD_INITIAL_PROC(glDrawRangeElements);
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = GLAD_INITIAL_PROC(glDrawRangeElementsBaseVertex);
+PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = GLAD_INITIAL_PROC(glDrawTransformFeedback);
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = GLAD_INITIAL_PROC(glDrawTransformFeedbackInstanced);
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = GLAD_INITIAL_PROC(glDrawTransformFeedbackStream);
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = GLAD_INITIAL_PROC(glDrawTransformFeedbackStreamInstanced);
+PFNGLEDGEFLAGPROC glad_glEdgeFlag = GLAD_INITIAL_PROC(glEdgeFlag);
+PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer = GLAD_INITIAL_PROC(glEdgeFlagPointer);
+PFNGLEDGEFLAGVPROC glad_glEdgeFlagv = GLAD_INITIAL_PROC(glEdgeFlagv);
+PFNGLENABLEPROC glad_glEnable = GLAD_INITIAL_PROC(glEnable);
+PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState = GLAD_INITIAL_PROC(glEnableClientState);
+PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = GLAD_INITIAL_PROC(glEnableVertexArrayAttrib);
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = GLAD_INITIAL_PROC(glEnableVertexAttribArray);
+PFNGLENABLEIPROC glad_glEnablei = GLAD_INITIAL_PROC(glEnablei);
+PFNGLENDPROC glad_glEnd = GLAD_INITIAL_PROC(glEnd);
+PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = GLAD_INITIAL_PROC(glEndConditionalRender);
+PFNGLENDLISTPROC glad_glEndList = GLAD_INITIAL_PROC(glEndList);
+PFNGLENDQUERYPROC glad_glEndQuery = GLAD_INITIAL_PROC(glEndQuery);
+PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = GLAD_INITIAL_PROC(glEndQueryIndexed);
+PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = GLAD_INITIAL_PROC(glEndTransformFeedback);
+PFNGLEVALCOORD1DPROC glad_glEvalCoord1d = GLAD_INITIAL_PROC(glEvalCoord1d);
+PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv = GLAD_INITIAL_PROC(glEvalCoord1dv);
+PFNGLEVALCOORD1FPROC glad_glEvalCoord1f = GLAD_INITIAL_PROC(glEvalCoord1f);
+PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv = GLAD_INITIAL_PROC(glEvalCoord1fv);
+PFNGLEVALCOORD2DPROC glad_glEvalCoord2d = GLAD_INITIAL_PROC(glEvalCoord2d);
+PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv = GLAD_INITIAL_PROC(glEvalCoord2dv);
+PFNGLEVALCOORD2FPROC glad_glEvalCoord2f = GLAD_INITIAL_PROC(glEvalCoord2f);
+PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv = GLAD_INITIAL_PROC(glEvalCoord2fv);
+PFNGLEVALMESH1PROC glad_glEvalMesh1 = GLAD_INITIAL_PROC(glEvalMesh1);
+PFNGLEVALMESH2PROC glad_glEvalMesh2 = GLAD_INITIAL_PROC(glEvalMesh2);
+PFNGLEVALPOINT1PROC glad_glEvalPoint1 = GLAD_INITIAL_PROC(glEvalPoint1);
+PFNGLEVALPOINT2PROC glad_glEvalPoint2 = GLAD_INITIAL_PROC(glEvalPoint2);
+PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer = GLAD_INITIAL_PROC(glFeedbackBuffer);
+PFNGLFENCESYNCPROC glad_glFenceSync = GLAD_INITIAL_PROC(glFenceSync);
+PFNGLFINISHPROC glad_glFinish = GLAD_INITIAL_PROC(glFinish);
+PFNGLFLUSHPROC glad_glFlush = GLAD_INITIAL_PROC(glFlush);
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = GLAD_INITIAL_PROC(glFlushMappedBufferRange);
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = GLAD_INITIAL_PROC(glFlushMappedNamedBufferRange);
+PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer = GLAD_INITIAL_PROC(glFogCoordPointer);
+PFNGLFOGCOORDDPROC glad_glFogCoordd = GLAD_INITIAL_PROC(glFogCoordd);
+PFNGLFOGCOORDDVPROC glad_glFogCoorddv = GLAD_INITIAL_PROC(glFogCoorddv);
+PFNGLFOGCOORDFPROC glad_glFogCoordf = GLAD_INITIAL_PROC(glFogCoordf);
+PFNGLFOGCOORDFVPROC glad_glFogCoordfv = GLAD_INITIAL_PROC(glFogCoordfv);
+PFNGLFOGFPROC glad_glFogf = GLAD_INITIAL_PROC(glFogf);
+PFNGLFOGFVPROC glad_glFogfv = GLAD_INITIAL_PROC(glFogfv);
+PFNGLFOGIPROC glad_glFogi = GLAD_INITIAL_PROC(glFogi);
+PFNGLFOGIVPROC glad_glFogiv = GLAD_INITIAL_PROC(glFogiv);
+PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = GLAD_INITIAL_PROC(glFramebufferParameteri);
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = GLAD_INITIAL_PROC(glFramebufferRenderbuffer);
+PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = GLAD_INITIAL_PROC(glFramebufferTexture);
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = GLAD_INITIAL_PROC(glFramebufferTexture1D);
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = GLAD_INITIAL_PROC(glFramebufferTexture2D);
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = GLAD_INITIAL_PROC(glFramebufferTexture3D);
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = GLAD_INITIAL_PROC(glFramebufferTextureLayer);
+PFNGLFRONTFACEPROC glad_glFrontFace = GLAD_INITIAL_PROC(glFrontFace);
+PFNGLFRUSTUMPROC glad_glFrustum = GLAD_INITIAL_PROC(glFrustum);
+PFNGLGENBUFFERSPROC glad_glGenBuffers = GLAD_INITIAL_PROC(glGenBuffers);
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = GLAD_INITIAL_PROC(glGenFramebuffers);
+PFNGLGENLISTSPROC glad_glGenLists = GLAD_INITIAL_PROC(glGenLists);
+PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = GLAD_INITIAL_PROC(glGenProgramPipelines);
+PFNGLGENQUERIESPROC glad_glGenQueries = GLAD_INITIAL_PROC(glGenQueries);
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = GLAD_INITIAL_PROC(glGenRenderbuffers);
+PFNGLGENSAMPLERSPROC glad_glGenSamplers = GLAD_INITIAL_PROC(glGenSamplers);
+PFNGLGENTEXTURESPROC glad_glGenTextures = GLAD_INITIAL_PROC(glGenTextures);
+PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = GLAD_INITIAL_PROC(glGenTransformFeedbacks);
+PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = GLAD_INITIAL_PROC(glGenVertexArrays);
+PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = GLAD_INITIAL_PROC(glGenerateMipmap);
+PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = GLAD_INITIAL_PROC(glGenerateTextureMipmap);
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = GLAD_INITIAL_PROC(glGetActiveAtomicCounterBufferiv);
+PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = GLAD_INITIAL_PROC(glGetActiveAttrib);
+PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = GLAD_INITIAL_PROC(glGetActiveSubroutineName);
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = GLAD_INITIAL_PROC(glGetActiveSubroutineUniformName);
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = GLAD_INITIAL_PROC(glGetActiveSubroutineUniformiv);
+PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = GLAD_INITIAL_PROC(glGetActiveUniform);
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = GLAD_INITIAL_PROC(glGetActiveUniformBlockName);
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = GLAD_INITIAL_PROC(glGetActiveUniformBlockiv);
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = GLAD_INITIAL_PROC(glGetActiveUniformName);
+PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = GLAD_INITIAL_PROC(glGetActiveUniformsiv);
+PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = GLAD_INITIAL_PROC(glGetAttachedShaders);
+PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = GLAD_INITIAL_PROC(glGetAttribLocation);
+PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = GLAD_INITIAL_PROC(glGetBooleani_v);
+PFNGLGETBOOLEANVPROC glad_glGetBooleanv = GLAD_INITIAL_PROC(glGetBooleanv);
+PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = GLAD_INITIAL_PROC(glGetBufferParameteri64v);
+PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = GLAD_INITIAL_PROC(glGetBufferParameteriv);
+PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = GLAD_INITIAL_PROC(glGetBufferPointerv);
+PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = GLAD_INITIAL_PROC(glGetBufferSubData);
+PFNGLGETCLIPPLANEPROC glad_glGetClipPlane = GLAD_INITIAL_PROC(glGetClipPlane);
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = GLAD_INITIAL_PROC(glGetCompressedTexImage);
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = GLAD_INITIAL_PROC(glGetCompressedTextureImage);
+PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage = GLAD_INITIAL_PROC(glGetCompressedTextureSubImage);
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = GLAD_INITIAL_PROC(glGetDebugMessageLog);
+PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = GLAD_INITIAL_PROC(glGetDoublei_v);
+PFNGLGETDOUBLEVPROC glad_glGetDoublev = GLAD_INITIAL_PROC(glGetDoublev);
+PFNGLGETERRORPROC glad_glGetError = GLAD_INITIAL_PROC(glGetError);
+PFNGLGETFLOATI_VPROC glad_glGetFloati_v = GLAD_INITIAL_PROC(glGetFloati_v);
+PFNGLGETFLOATVPROC glad_glGetFloatv = GLAD_INITIAL_PROC(glGetFloatv);
+PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = GLAD_INITIAL_PROC(glGetFragDataIndex);
+PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = GLAD_INITIAL_PROC(glGetFragDataLocation);
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = GLAD_INITIAL_PROC(glGetFramebufferAttachmentParameteriv);
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = GLAD_INITIAL_PROC(glGetFramebufferParameteriv);
+PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus = GLAD_INITIAL_PROC(glGetGraphicsResetStatus);
+PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = GLAD_INITIAL_PROC(glGetInteger64i_v);
+PFNGLGETINTEGER64VPROC glad_glGetInteger64v = GLAD_INITIAL_PROC(glGetInteger64v);
+PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = GLAD_INITIAL_PROC(glGetIntegeri_v);
+PFNGLGETINTEGERVPROC glad_glGetIntegerv = GLAD_INITIAL_PROC(glGetIntegerv);
+PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = GLAD_INITIAL_PROC(glGetInternalformati64v);
+PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = GLAD_INITIAL_PROC(glGetInternalformativ);
+PFNGLGETLIGHTFVPROC glad_glGetLightfv = GLAD_INITIAL_PROC(glGetLightfv);
+PFNGLGETLIGHTIVPROC glad_glGetLightiv = GLAD_INITIAL_PROC(glGetLightiv);
+PFNGLGETMAPDVPROC glad_glGetMapdv = GLAD_INITIAL_PROC(glGetMapdv);
+PFNGLGETMAPFVPROC glad_glGetMapfv = GLAD_INITIAL_PROC(glGetMapfv);
+PFNGLGETMAPIVPROC glad_glGetMapiv = GLAD_INITIAL_PROC(glGetMapiv);
+PFNGLGETMATERIALFVPROC glad_glGetMaterialfv = GLAD_INITIAL_PROC(glGetMaterialfv);
+PFNGLGETMATERIALIVPROC glad_glGetMaterialiv = GLAD_INITIAL_PROC(glGetMaterialiv);
+PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = GLAD_INITIAL_PROC(glGetMultisamplefv);
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = GLAD_INITIAL_PROC(glGetNamedBufferParameteri64v);
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = GLAD_INITIAL_PROC(glGetNamedBufferParameteriv);
+PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = GLAD_INITIAL_PROC(glGetNamedBufferPointerv);
+PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = GLAD_INITIAL_PROC(glGetNamedBufferSubData);
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = GLAD_INITIAL_PROC(glGetNamedFramebufferAttachmentParameteriv);
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = GLAD_INITIAL_PROC(glGetNamedFramebufferParameteriv);
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = GLAD_INITIAL_PROC(glGetNamedRenderbufferParameteriv);
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = GLAD_INITIAL_PROC(glGetObjectLabel);
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = GLAD_INITIAL_PROC(glGetObjectPtrLabel);
+PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv = GLAD_INITIAL_PROC(glGetPixelMapfv);
+PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv = GLAD_INITIAL_PROC(glGetPixelMapuiv);
+PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv = GLAD_INITIAL_PROC(glGetPixelMapusv);
+PFNGLGETPOINTERVPROC glad_glGetPointerv = GLAD_INITIAL_PROC(glGetPointerv);
+PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple = GLAD_INITIAL_PROC(glGetPolygonStipple);
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = GLAD_INITIAL_PROC(glGetProgramBinary);
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = GLAD_INITIAL_PROC(glGetProgramInfoLog);
+PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = GLAD_INITIAL_PROC(glGetProgramInterfaceiv);
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = GLAD_INITIAL_PROC(glGetProgramPipelineInfoLog);
+PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = GLAD_INITIAL_PROC(glGetProgramPipelineiv);
+PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = GLAD_INITIAL_PROC(glGetProgramResourceIndex);
+PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = GLAD_INITIAL_PROC(glGetProgramResourceLocation);
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = GLAD_INITIAL_PROC(glGetProgramResourceLocationIndex);
+PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = GLAD_INITIAL_PROC(glGetProgramResourceName);
+PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = GLAD_INITIAL_PROC(glGetProgramResourceiv);
+PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = GLAD_INITIAL_PROC(glGetProgramStageiv);
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = GLAD_INITIAL_PROC(glGetProgramiv);
+PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = GLAD_INITIAL_PROC(glGetQueryBufferObjecti64v);
+PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = GLAD_INITIAL_PROC(glGetQueryBufferObjectiv);
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = GLAD_INITIAL_PROC(glGetQueryBufferObjectui64v);
+PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = GLAD_INITIAL_PROC(glGetQueryBufferObjectuiv);
+PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = GLAD_INITIAL_PROC(glGetQueryIndexediv);
+PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = GLAD_INITIAL_PROC(glGetQueryObjecti64v);
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = GLAD_INITIAL_PROC(glGetQueryObjectiv);
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = GLAD_INITIAL_PROC(glGetQueryObjectui64v);
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = GLAD_INITIAL_PROC(glGetQueryObjectuiv);
+PFNGLGETQUERYIVPROC glad_glGetQueryiv = GLAD_INITIAL_PROC(glGetQueryiv);
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = GLAD_INITIAL_PROC(glGetRenderbufferParameteriv);
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = GLAD_INITIAL_PROC(glGetSamplerParameterIiv);
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = GLAD_INITIAL_PROC(glGetSamplerParameterIuiv);
+PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = GLAD_INITIAL_PROC(glGetSamplerParameterfv);
+PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = GLAD_INITIAL_PROC(glGetSamplerParameteriv);
+PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = GLAD_INITIAL_PROC(glGetShaderInfoLog);
+PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = GLAD_INITIAL_PROC(glGetShaderPrecisionFormat);
+PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = GLAD_INITIAL_PROC(glGetShaderSource);
+PFNGLGETSHADERIVPROC glad_glGetShaderiv = GLAD_INITIAL_PROC(glGetShaderiv);
+PFNGLGETSTRINGPROC glad_glGetString = GLAD_INITIAL_PROC(glGetString);
+PFNGLGETSTRINGIPROC glad_glGetStringi = GLAD_INITIAL_PROC(glGetStringi);
+PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = GLAD_INITIAL_PROC(glGetSubroutineIndex);
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = GLAD_INITIAL_PROC(glGetSubroutineUniformLocation);
+PFNGLGETSYNCIVPROC glad_glGetSynciv = GLAD_INITIAL_PROC(glGetSynciv);
+PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv = GLAD_INITIAL_PROC(glGetTexEnvfv);
+PFNGLGETTEXENVIVPROC glad_glGetTexEnviv = GLAD_INITIAL_PROC(glGetTexEnviv);
+PFNGLGETTEXGENDVPROC glad_glGetTexGendv = GLAD_INITIAL_PROC(glGetTexGendv);
+PFNGLGETTEXGENFVPROC glad_glGetTexGenfv = GLAD_INITIAL_PROC(glGetTexGenfv);
+PFNGLGETTEXGENIVPROC glad_glGetTexGeniv = GLAD_INITIAL_PROC(glGetTexGeniv);
+PFNGLGETTEXIMAGEPROC glad_glGetTexImage = GLAD_INITIAL_PROC(glGetTexImage);
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = GLAD_INITIAL_PROC(glGetTexLevelParameterfv);
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = GLAD_INITIAL_PROC(glGetTexLevelParameteriv);
+PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = GLAD_INITIAL_PROC(glGetTexParameterIiv);
+PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = GLAD_INITIAL_PROC(glGetTexParameterIuiv);
+PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = GLAD_INITIAL_PROC(glGetTexParameterfv);
+PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = GLAD_INITIAL_PROC(glGetTexParameteriv);
+PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = GLAD_INITIAL_PROC(glGetTextureImage);
+PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = GLAD_INITIAL_PROC(glGetTextureLevelParameterfv);
+PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = GLAD_INITIAL_PROC(glGetTextureLevelParameteriv);
+PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = GLAD_INITIAL_PROC(glGetTextureParameterIiv);
+PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = GLAD_INITIAL_PROC(glGetTextureParameterIuiv);
+PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = GLAD_INITIAL_PROC(glGetTextureParameterfv);
+PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = GLAD_INITIAL_PROC(glGetTextureParameteriv);
+PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage = GLAD_INITIAL_PROC(glGetTextureSubImage);
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = GLAD_INITIAL_PROC(glGetTransformFeedbackVarying);
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = GLAD_INITIAL_PROC(glGetTransformFeedbacki64_v);
+PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = GLAD_INITIAL_PROC(glGetTransformFeedbacki_v);
+PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = GLAD_INITIAL_PROC(glGetTransformFeedbackiv);
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = GLAD_INITIAL_PROC(glGetUniformBlockIndex);
+PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = GLAD_INITIAL_PROC(glGetUniformIndices);
+PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = GLAD_INITIAL_PROC(glGetUniformLocation);
+PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = GLAD_INITIAL_PROC(glGetUniformSubroutineuiv);
+PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = GLAD_INITIAL_PROC(glGetUniformdv);
+PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = GLAD_INITIAL_PROC(glGetUniformfv);
+PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = GLAD_INITIAL_PROC(glGetUniformiv);
+PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = GLAD_INITIAL_PROC(glGetUniformuiv);
+PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = GLAD_INITIAL_PROC(glGetVertexArrayIndexed64iv);
+PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = GLAD_INITIAL_PROC(glGetVertexArrayIndexediv);
+PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = GLAD_INITIAL_PROC(glGetVertexArrayiv);
+PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = GLAD_INITIAL_PROC(glGetVertexAttribIiv);
+PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = GLAD_INITIAL_PROC(glGetVertexAttribIuiv);
+PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = GLAD_INITIAL_PROC(glGetVertexAttribLdv);
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = GLAD_INITIAL_PROC(glGetVertexAttribPointerv);
+PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = GLAD_INITIAL_PROC(glGetVertexAttribdv);
+PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = GLAD_INITIAL_PROC(glGetVertexAttribfv);
+PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = GLAD_INITIAL_PROC(glGetVertexAttribiv);
+PFNGLGETNCOLORTABLEPROC glad_glGetnColorTable = GLAD_INITIAL_PROC(glGetnColorTable);
+PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage = GLAD_INITIAL_PROC(glGetnCompressedTexImage);
+PFNGLGETNCONVOLUTIONFILTERPROC glad_glGetnConvolutionFilter = GLAD_INITIAL_PROC(glGetnConvolutionFilter);
+PFNGLGETNHISTOGRAMPROC glad_glGetnHistogram = GLAD_INITIAL_PROC(glGetnHistogram);
+PFNGLGETNMAPDVPROC glad_glGetnMapdv = GLAD_INITIAL_PROC(glGetnMapdv);
+PFNGLGETNMAPFVPROC glad_glGetnMapfv = GLAD_INITIAL_PROC(glGetnMapfv);
+PFNGLGETNMAPIVPROC glad_glGetnMapiv = GLAD_INITIAL_PROC(glGetnMapiv);
+PFNGLGETNMINMAXPROC glad_glGetnMinmax = GLAD_INITIAL_PROC(glGetnMinmax);
+PFNGLGETNPIXELMAPFVPROC glad_glGetnPixelMapfv = GLAD_INITIAL_PROC(glGetnPixelMapfv);
+PFNGLGETNPIXELMAPUIVPROC glad_glGetnPixelMapuiv = GLAD_INITIAL_PROC(glGetnPixelMapuiv);
+PFNGLGETNPIXELMAPUSVPROC glad_glGetnPixelMapusv = GLAD_INITIAL_PROC(glGetnPixelMapusv);
+PFNGLGETNPOLYGONSTIPPLEPROC glad_glGetnPolygonStipple = GLAD_INITIAL_PROC(glGetnPolygonStipple);
+PFNGLGETNSEPARABLEFILTERPROC glad_glGetnSeparableFilter = GLAD_INITIAL_PROC(glGetnSeparableFilter);
+PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage = GLAD_INITIAL_PROC(glGetnTexImage);
+PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv = GLAD_INITIAL_PROC(glGetnUniformdv);
+PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv = GLAD_INITIAL_PROC(glGetnUniformfv);
+PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv = GLAD_INITIAL_PROC(glGetnUniformiv);
+PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv = GLAD_INITIAL_PROC(glGetnUniformuiv);
+PFNGLHINTPROC glad_glHint = GLAD_INITIAL_PROC(glHint);
+PFNGLINDEXMASKPROC glad_glIndexMask = GLAD_INITIAL_PROC(glIndexMask);
+PFNGLINDEXPOINTERPROC glad_glIndexPointer = GLAD_INITIAL_PROC(glIndexPointer);
+PFNGLINDEXDPROC glad_glIndexd = GLAD_INITIAL_PROC(glIndexd);
+PFNGLINDEXDVPROC glad_glIndexdv = GLAD_INITIAL_PROC(glIndexdv);
+PFNGLINDEXFPROC glad_glIndexf = GLAD_INITIAL_PROC(glIndexf);
+PFNGLINDEXFVPROC glad_glIndexfv = GLAD_INITIAL_PROC(glIndexfv);
+PFNGLINDEXIPROC glad_glIndexi = GLAD_INITIAL_PROC(glIndexi);
+PFNGLINDEXIVPROC glad_glIndexiv = GLAD_INITIAL_PROC(glIndexiv);
+PFNGLINDEXSPROC glad_glIndexs = GLAD_INITIAL_PROC(glIndexs);
+PFNGLINDEXSVPROC glad_glIndexsv = GLAD_INITIAL_PROC(glIndexsv);
+PFNGLINDEXUBPROC glad_glIndexub = GLAD_INITIAL_PROC(glIndexub);
+PFNGLINDEXUBVPROC glad_glIndexubv = GLAD_INITIAL_PROC(glIndexubv);
+PFNGLINITNAMESPROC glad_glInitNames = GLAD_INITIAL_PROC(glInitNames);
+PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays = GLAD_INITIAL_PROC(glInterleavedArrays);
+PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = GLAD_INITIAL_PROC(glInvalidateBufferData);
+PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = GLAD_INITIAL_PROC(glInvalidateBufferSubData);
+PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = GLAD_INITIAL_PROC(glInvalidateFramebuffer);
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = GLAD_INITIAL_PROC(glInvalidateNamedFramebufferData);
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = GLAD_INITIAL_PROC(glInvalidateNamedFramebufferSubData);
+PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = GLAD_INITIAL_PROC(glInvalidateSubFramebuffer);
+PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = GLAD_INITIAL_PROC(glInvalidateTexImage);
+PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = GLAD_INITIAL_PROC(glInvalidateTexSubImage);
+PFNGLISBUFFERPROC glad_glIsBuffer = GLAD_INITIAL_PROC(glIsBuffer);
+PFNGLISENABLEDPROC glad_glIsEnabled = GLAD_INITIAL_PROC(glIsEnabled);
+PFNGLISENABLEDIPROC glad_glIsEnabledi = GLAD_INITIAL_PROC(glIsEnabledi);
+PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = GLAD_INITIAL_PROC(glIsFramebuffer);
+PFNGLISLISTPROC glad_glIsList = GLAD_INITIAL_PROC(glIsList);
+PFNGLISPROGRAMPROC glad_glIsProgram = GLAD_INITIAL_PROC(glIsProgram);
+PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = GLAD_INITIAL_PROC(glIsProgramPipeline);
+PFNGLISQUERYPROC glad_glIsQuery = GLAD_INITIAL_PROC(glIsQuery);
+PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = GLAD_INITIAL_PROC(glIsRenderbuffer);
+PFNGLISSAMPLERPROC glad_glIsSampler = GLAD_INITIAL_PROC(glIsSampler);
+PFNGLISSHADERPROC glad_glIsShader = GLAD_INITIAL_PROC(glIsShader);
+PFNGLISSYNCPROC glad_glIsSync = GLAD_INITIAL_PROC(glIsSync);
+PFNGLISTEXTUREPROC glad_glIsTexture = GLAD_INITIAL_PROC(glIsTexture);
+PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = GLAD_INITIAL_PROC(glIsTransformFeedback);
+PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = GLAD_INITIAL_PROC(glIsVertexArray);
+PFNGLLIGHTMODELFPROC glad_glLightModelf = GLAD_INITIAL_PROC(glLightModelf);
+PFNGLLIGHTMODELFVPROC glad_glLightModelfv = GLAD_INITIAL_PROC(glLightModelfv);
+PFNGLLIGHTMODELIPROC glad_glLightModeli = GLAD_INITIAL_PROC(glLightModeli);
+PFNGLLIGHTMODELIVPROC glad_glLightModeliv = GLAD_INITIAL_PROC(glLightModeliv);
+PFNGLLIGHTFPROC glad_glLightf = GLAD_INITIAL_PROC(glLightf);
+PFNGLLIGHTFVPROC glad_glLightfv = GLAD_INITIAL_PROC(glLightfv);
+PFNGLLIGHTIPROC glad_glLighti = GLAD_INITIAL_PROC(glLighti);
+PFNGLLIGHTIVPROC glad_glLightiv = GLAD_INITIAL_PROC(glLightiv);
+PFNGLLINESTIPPLEPROC glad_glLineStipple = GLAD_INITIAL_PROC(glLineStipple);
+PFNGLLINEWIDTHPROC glad_glLineWidth = GLAD_INITIAL_PROC(glLineWidth);
+PFNGLLINKPROGRAMPROC glad_glLinkProgram = GLAD_INITIAL_PROC(glLinkProgram);
+PFNGLLISTBASEPROC glad_glListBase = GLAD_INITIAL_PROC(glListBase);
+PFNGLLOADIDENTITYPROC glad_glLoadIdentity = GLAD_INITIAL_PROC(glLoadIdentity);
+PFNGLLOADMATRIXDPROC glad_glLoadMatrixd = GLAD_INITIAL_PROC(glLoadMatrixd);
+PFNGLLOADMATRIXFPROC glad_glLoadMatrixf = GLAD_INITIAL_PROC(glLoadMatrixf);
+PFNGLLOADNAMEPROC glad_glLoadName = GLAD_INITIAL_PROC(glLoadName);
+PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd = GLAD_INITIAL_PROC(glLoadTransposeMatrixd);
+PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf = GLAD_INITIAL_PROC(glLoadTransposeMatrixf);
+PFNGLLOGICOPPROC glad_glLogicOp = GLAD_INITIAL_PROC(glLogicOp);
+PFNGLMAP1DPROC glad_glMap1d = GLAD_INITIAL_PROC(glMap1d);
+PFNGLMAP1FPROC glad_glMap1f = GLAD_INITIAL_PROC(glMap1f);
+PFNGLMAP2DPROC glad_glMap2d = GLAD_INITIAL_PROC(glMap2d);
+PFNGLMAP2FPROC glad_glMap2f = GLAD_INITIAL_PROC(glMap2f);
+PFNGLMAPBUFFERPROC glad_glMapBuffer = GLAD_INITIAL_PROC(glMapBuffer);
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = GLAD_INITIAL_PROC(glMapBufferRange);
+PFNGLMAPGRID1DPROC glad_glMapGrid1d = GLAD_INITIAL_PROC(glMapGrid1d);
+PFNGLMAPGRID1FPROC glad_glMapGrid1f = GLAD_INITIAL_PROC(glMapGrid1f);
+PFNGLMAPGRID2DPROC glad_glMapGrid2d = GLAD_INITIAL_PROC(glMapGrid2d);
+PFNGLMAPGRID2FPROC glad_glMapGrid2f = GLAD_INITIAL_PROC(glMapGrid2f);
+PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer = GLAD_INITIAL_PROC(glMapNamedBuffer);
+PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = GLAD_INITIAL_PROC(glMapNamedBufferRange);
+PFNGLMATERIALFPROC glad_glMaterialf = GLAD_INITIAL_PROC(glMaterialf);
+PFNGLMATERIALFVPROC glad_glMaterialfv = GLAD_INITIAL_PROC(glMaterialfv);
+PFNGLMATERIALIPROC glad_glMateriali = GLAD_INITIAL_PROC(glMateriali);
+PFNGLMATERIALIVPROC glad_glMaterialiv = GLAD_INITIAL_PROC(glMaterialiv);
+PFNGLMATRIXMODEPROC glad_glMatrixMode = GLAD_INITIAL_PROC(glMatrixMode);
+PFNGLMAXSHADERCOMPILERTHREADSARBPROC glad_glMaxShaderCompilerThreadsARB = GLAD_INITIAL_PROC(glMaxShaderCompilerThreadsARB);
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = GLAD_INITIAL_PROC(glMaxShaderCompilerThreadsKHR);
+PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = GLAD_INITIAL_PROC(glMemoryBarrier);
+PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion = GLAD_INITIAL_PROC(glMemoryBarrierByRegion);
+PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = GLAD_INITIAL_PROC(glMinSampleShading);
+PFNGLMULTMATRIXDPROC glad_glMultMatrixd = GLAD_INITIAL_PROC(glMultMatrixd);
+PFNGLMULTMATRIXFPROC glad_glMultMatrixf = GLAD_INITIAL_PROC(glMultMatrixf);
+PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd = GLAD_INITIAL_PROC(glMultTransposeMatrixd);
+PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf = GLAD_INITIAL_PROC(glMultTransposeMatrixf);
+PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = GLAD_INITIAL_PROC(glMultiDrawArrays);
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = GLAD_INITIAL_PROC(glMultiDrawArraysIndirect);
+PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_glMultiDrawArraysIndirectCount = GLAD_INITIAL_PROC(glMultiDrawArraysIndirectCount);
+PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = GLAD_INITIAL_PROC(glMultiDrawElements);
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = GLAD_INITIAL_PROC(glMultiDrawElementsBaseVertex);
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = GLAD_INITIAL_PROC(glMultiDrawElementsIndirect);
+PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_glMultiDrawElementsIndirectCount = GLAD_INITIAL_PROC(glMultiDrawElementsIndirectCount);
+PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d = GLAD_INITIAL_PROC(glMultiTexCoord1d);
+PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv = GLAD_INITIAL_PROC(glMultiTexCoord1dv);
+PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f = GLAD_INITIAL_PROC(glMultiTexCoord1f);
+PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv = GLAD_INITIAL_PROC(glMultiTexCoord1fv);
+PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i = GLAD_INITIAL_PROC(glMultiTexCoord1i);
+PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv = GLAD_INITIAL_PROC(glMultiTexCoord1iv);
+PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s = GLAD_INITIAL_PROC(glMultiTexCoord1s);
+PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv = GLAD_INITIAL_PROC(glMultiTexCoord1sv);
+PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d = GLAD_INITIAL_PROC(glMultiTexCoord2d);
+PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv = GLAD_INITIAL_PROC(glMultiTexCoord2dv);
+PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f = GLAD_INITIAL_PROC(glMultiTexCoord2f);
+PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv = GLAD_INITIAL_PROC(glMultiTexCoord2fv);
+PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i = GLAD_INITIAL_PROC(glMultiTexCoord2i);
+PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv = GLAD_INITIAL_PROC(glMultiTexCoord2iv);
+PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s = GLAD_INITIAL_PROC(glMultiTexCoord2s);
+PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv = GLAD_INITIAL_PROC(glMultiTexCoord2sv);
+PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d = GLAD_INITIAL_PROC(glMultiTexCoord3d);
+PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv = GLAD_INITIAL_PROC(glMultiTexCoord3dv);
+PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f = GLAD_INITIAL_PROC(glMultiTexCoord3f);
+PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv = GLAD_INITIAL_PROC(glMultiTexCoord3fv);
+PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i = GLAD_INITIAL_PROC(glMultiTexCoord3i);
+PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv = GLAD_INITIAL_PROC(glMultiTexCoord3iv);
+PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s = GLAD_INITIAL_PROC(glMultiTexCoord3s);
+PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv = GLAD_INITIAL_PROC(glMultiTexCoord3sv);
+PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d = GLAD_INITIAL_PROC(glMultiTexCoord4d);
+PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv = GLAD_INITIAL_PROC(glMultiTexCoord4dv);
+PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f = GLAD_INITIAL_PROC(glMultiTexCoord4f);
+PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv = GLAD_INITIAL_PROC(glMultiTexCoord4fv);
+PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i = GLAD_INITIAL_PROC(glMultiTexCoord4i);
+PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv = GLAD_INITIAL_PROC(glMultiTexCoord4iv);
+PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s = GLAD_INITIAL_PROC(glMultiTexCoord4s);
+PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv = GLAD_INITIAL_PROC(glMultiTexCoord4sv);
+PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = GLAD_INITIAL_PROC(glMultiTexCoordP1ui);
+PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = GLAD_INITIAL_PROC(glMultiTexCoordP1uiv);
+PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = GLAD_INITIAL_PROC(glMultiTexCoordP2ui);
+PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = GLAD_INITIAL_PROC(glMultiTexCoordP2uiv);
+PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = GLAD_INITIAL_PROC(glMultiTexCoordP3ui);
+PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = GLAD_INITIAL_PROC(glMultiTexCoordP3uiv);
+PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = GLAD_INITIAL_PROC(glMultiTexCoordP4ui);
+PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = GLAD_INITIAL_PROC(glMultiTexCoordP4uiv);
+PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = GLAD_INITIAL_PROC(glNamedBufferData);
+PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = GLAD_INITIAL_PROC(glNamedBufferStorage);
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = GLAD_INITIAL_PROC(glNamedBufferSubData);
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = GLAD_INITIAL_PROC(glNamedFramebufferDrawBuffer);
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = GLAD_INITIAL_PROC(glNamedFramebufferDrawBuffers);
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = GLAD_INITIAL_PROC(glNamedFramebufferParameteri);
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = GLAD_INITIAL_PROC(glNamedFramebufferReadBuffer);
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = GLAD_INITIAL_PROC(glNamedFramebufferRenderbuffer);
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = GLAD_INITIAL_PROC(glNamedFramebufferTexture);
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = GLAD_INITIAL_PROC(glNamedFramebufferTextureLayer);
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = GLAD_INITIAL_PROC(glNamedRenderbufferStorage);
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = GLAD_INITIAL_PROC(glNamedRenderbufferStorageMultisample);
+PFNGLNEWLISTPROC glad_glNewList = GLAD_INITIAL_PROC(glNewList);
+PFNGLNORMAL3BPROC glad_glNormal3b = GLAD_INITIAL_PROC(glNormal3b);
+PFNGLNORMAL3BVPROC glad_glNormal3bv = GLAD_INITIAL_PROC(glNormal3bv);
+PFNGLNORMAL3DPROC glad_glNormal3d = GLAD_INITIAL_PROC(glNormal3d);
+PFNGLNORMAL3DVPROC glad_glNormal3dv = GLAD_INITIAL_PROC(glNormal3dv);
+PFNGLNORMAL3FPROC glad_glNormal3f = GLAD_INITIAL_PROC(glNormal3f);
+PFNGLNORMAL3FVPROC glad_glNormal3fv = GLAD_INITIAL_PROC(glNormal3fv);
+PFNGLNORMAL3IPROC glad_glNormal3i = GLAD_INITIAL_PROC(glNormal3i);
+PFNGLNORMAL3IVPROC glad_glNormal3iv = GLAD_INITIAL_PROC(glNormal3iv);
+PFNGLNORMAL3SPROC glad_glNormal3s = GLAD_INITIAL_PROC(glNormal3s);
+PFNGLNORMAL3SVPROC glad_glNormal3sv = GLAD_INITIAL_PROC(glNormal3sv);
+PFNGLNORMALP3UIPROC glad_glNormalP3ui = GLAD_INITIAL_PROC(glNormalP3ui);
+PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = GLAD_INITIAL_PROC(glNormalP3uiv);
+PFNGLNORMALPOINTERPROC glad_glNormalPointer = GLAD_INITIAL_PROC(glNormalPointer);
+PFNGLOBJECTLABELPROC glad_glObjectLabel = GLAD_INITIAL_PROC(glObjectLabel);
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = GLAD_INITIAL_PROC(glObjectPtrLabel);
+PFNGLORTHOPROC glad_glOrtho = GLAD_INITIAL_PROC(glOrtho);
+PFNGLPASSTHROUGHPROC glad_glPassThrough = GLAD_INITIAL_PROC(glPassThrough);
+PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = GLAD_INITIAL_PROC(glPatchParameterfv);
+PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = GLAD_INITIAL_PROC(glPatchParameteri);
+PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = GLAD_INITIAL_PROC(glPauseTransformFeedback);
+PFNGLPIXELMAPFVPROC glad_glPixelMapfv = GLAD_INITIAL_PROC(glPixelMapfv);
+PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv = GLAD_INITIAL_PROC(glPixelMapuiv);
+PFNGLPIXELMAPUSVPROC glad_glPixelMapusv = GLAD_INITIAL_PROC(glPixelMapusv);
+PFNGLPIXELSTOREFPROC glad_glPixelStoref = GLAD_INITIAL_PROC(glPixelStoref);
+PFNGLPIXELSTOREIPROC glad_glPixelStorei = GLAD_INITIAL_PROC(glPixelStorei);
+PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf = GLAD_INITIAL_PROC(glPixelTransferf);
+PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi = GLAD_INITIAL_PROC(glPixelTransferi);
+PFNGLPIXELZOOMPROC glad_glPixelZoom = GLAD_INITIAL_PROC(glPixelZoom);
+PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = GLAD_INITIAL_PROC(glPointParameterf);
+PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = GLAD_INITIAL_PROC(glPointParameterfv);
+PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = GLAD_INITIAL_PROC(glPointParameteri);
+PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = GLAD_INITIAL_PROC(glPointParameteriv);
+PFNGLPOINTSIZEPROC glad_glPointSize = GLAD_INITIAL_PROC(glPointSize);
+PFNGLPOLYGONMODEPROC glad_glPolygonMode = GLAD_INITIAL_PROC(glPolygonMode);
+PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = GLAD_INITIAL_PROC(glPolygonOffset);
+PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp = GLAD_INITIAL_PROC(glPolygonOffsetClamp);
+PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple = GLAD_INITIAL_PROC(glPolygonStipple);
+PFNGLPOPATTRIBPROC glad_glPopAttrib = GLAD_INITIAL_PROC(glPopAttrib);
+PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib = GLAD_INITIAL_PROC(glPopClientAttrib);
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = GLAD_INITIAL_PROC(glPopDebugGroup);
+PFNGLPOPMATRIXPROC glad_glPopMatrix = GLAD_INITIAL_PROC(glPopMatrix);
+PFNGLPOPNAMEPROC glad_glPopName = GLAD_INITIAL_PROC(glPopName);
+PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = GLAD_INITIAL_PROC(glPrimitiveRestartIndex);
+PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures = GLAD_INITIAL_PROC(glPrioritizeTextures);
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = GLAD_INITIAL_PROC(glProgramBinary);
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = GLAD_INITIAL_PROC(glProgramParameteri);
+PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = GLAD_INITIAL_PROC(glProgramUniform1d);
+PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = GLAD_INITIAL_PROC(glProgramUniform1dv);
+PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = GLAD_INITIAL_PROC(glProgramUniform1f);
+PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = GLAD_INITIAL_PROC(glProgramUniform1fv);
+PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = GLAD_INITIAL_PROC(glProgramUniform1i);
+PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = GLAD_INITIAL_PROC(glProgramUniform1iv);
+PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = GLAD_INITIAL_PROC(glProgramUniform1ui);
+PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = GLAD_INITIAL_PROC(glProgramUniform1uiv);
+PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = GLAD_INITIAL_PROC(glProgramUniform2d);
+PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = GLAD_INITIAL_PROC(glProgramUniform2dv);
+PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = GLAD_INITIAL_PROC(glProgramUniform2f);
+PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = GLAD_INITIAL_PROC(glProgramUniform2fv);
+PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = GLAD_INITIAL_PROC(glProgramUniform2i);
+PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = GLAD_INITIAL_PROC(glProgramUniform2iv);
+PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = GLAD_INITIAL_PROC(glProgramUniform2ui);
+PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = GLAD_INITIAL_PROC(glProgramUniform2uiv);
+PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = GLAD_INITIAL_PROC(glProgramUniform3d);
+PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = GLAD_INITIAL_PROC(glProgramUniform3dv);
+PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = GLAD_INITIAL_PROC(glProgramUniform3f);
+PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = GLAD_INITIAL_PROC(glProgramUniform3fv);
+PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = GLAD_INITIAL_PROC(glProgramUniform3i);
+PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = GLAD_INITIAL_PROC(glProgramUniform3iv);
+PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = GLAD_INITIAL_PROC(glProgramUniform3ui);
+PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = GLAD_INITIAL_PROC(glProgramUniform3uiv);
+PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = GLAD_INITIAL_PROC(glProgramUniform4d);
+PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = GLAD_INITIAL_PROC(glProgramUniform4dv);
+PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = GLAD_INITIAL_PROC(glProgramUniform4f);
+PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = GLAD_INITIAL_PROC(glProgramUniform4fv);
+PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = GLAD_INITIAL_PROC(glProgramUniform4i);
+PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = GLAD_INITIAL_PROC(glProgramUniform4iv);
+PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = GLAD_INITIAL_PROC(glProgramUniform4ui);
+PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = GLAD_INITIAL_PROC(glProgramUniform4uiv);
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = GLAD_INITIAL_PROC(glProgramUniformMatrix2dv);
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = GLAD_INITIAL_PROC(glProgramUniformMatrix2fv);
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = GLAD_INITIAL_PROC(glProgramUniformMatrix2x3dv);
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = GLAD_INITIAL_PROC(glProgramUniformMatrix2x3fv);
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = GLAD_INITIAL_PROC(glProgramUniformMatrix2x4dv);
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = GLAD_INITIAL_PROC(glProgramUniformMatrix2x4fv);
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = GLAD_INITIAL_PROC(glProgramUniformMatrix3dv);
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = GLAD_INITIAL_PROC(glProgramUniformMatrix3fv);
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = GLAD_INITIAL_PROC(glProgramUniformMatrix3x2dv);
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = GLAD_INITIAL_PROC(glProgramUniformMatrix3x2fv);
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = GLAD_INITIAL_PROC(glProgramUniformMatrix3x4dv);
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = GLAD_INITIAL_PROC(glProgramUniformMatrix3x4fv);
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = GLAD_INITIAL_PROC(glProgramUniformMatrix4dv);
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = GLAD_INITIAL_PROC(glProgramUniformMatrix4fv);
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = GLAD_INITIAL_PROC(glProgramUniformMatrix4x2dv);
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = GLAD_INITIAL_PROC(glProgramUniformMatrix4x2fv);
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = GLAD_INITIAL_PROC(glProgramUniformMatrix4x3dv);
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = GLAD_INITIAL_PROC(glProgramUniformMatrix4x3fv);
+PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = GLAD_INITIAL_PROC(glProvokingVertex);
+PFNGLPUSHATTRIBPROC glad_glPushAttrib = GLAD_INITIAL_PROC(glPushAttrib);
+PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib = GLAD_INITIAL_PROC(glPushClientAttrib);
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = GLAD_INITIAL_PROC(glPushDebugGroup);
+PFNGLPUSHMATRIXPROC glad_glPushMatrix = GLAD_INITIAL_PROC(glPushMatrix);
+PFNGLPUSHNAMEPROC glad_glPushName = GLAD_INITIAL_PROC(glPushName);
+PFNGLQUERYCOUNTERPROC glad_glQueryCounter = GLAD_INITIAL_PROC(glQueryCounter);
+PFNGLRASTERPOS2DPROC glad_glRasterPos2d = GLAD_INITIAL_PROC(glRasterPos2d);
+PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv = GLAD_INITIAL_PROC(glRasterPos2dv);
+PFNGLRASTERPOS2FPROC glad_glRasterPos2f = GLAD_INITIAL_PROC(glRasterPos2f);
+PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv = GLAD_INITIAL_PROC(glRasterPos2fv);
+PFNGLRASTERPOS2IPROC glad_glRasterPos2i = GLAD_INITIAL_PROC(glRasterPos2i);
+PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv = GLAD_INITIAL_PROC(glRasterPos2iv);
+PFNGLRASTERPOS2SPROC glad_glRasterPos2s = GLAD_INITIAL_PROC(glRasterPos2s);
+PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv = GLAD_INITIAL_PROC(glRasterPos2sv);
+PFNGLRASTERPOS3DPROC glad_glRasterPos3d = GLAD_INITIAL_PROC(glRasterPos3d);
+PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv = GLAD_INITIAL_PROC(glRasterPos3dv);
+PFNGLRASTERPOS3FPROC glad_glRasterPos3f = GLAD_INITIAL_PROC(glRasterPos3f);
+PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv = GLAD_INITIAL_PROC(glRasterPos3fv);
+PFNGLRASTERPOS3IPROC glad_glRasterPos3i = GLAD_INITIAL_PROC(glRasterPos3i);
+PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv = GLAD_INITIAL_PROC(glRasterPos3iv);
+PFNGLRASTERPOS3SPROC glad_glRasterPos3s = GLAD_INITIAL_PROC(glRasterPos3s);
+PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv = GLAD_INITIAL_PROC(glRasterPos3sv);
+PFNGLRASTERPOS4DPROC glad_glRasterPos4d = GLAD_INITIAL_PROC(glRasterPos4d);
+PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv = GLAD_INITIAL_PROC(glRasterPos4dv);
+PFNGLRASTERPOS4FPROC glad_glRasterPos4f = GLAD_INITIAL_PROC(glRasterPos4f);
+PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv = GLAD_INITIAL_PROC(glRasterPos4fv);
+PFNGLRASTERPOS4IPROC glad_glRasterPos4i = GLAD_INITIAL_PROC(glRasterPos4i);
+PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv = GLAD_INITIAL_PROC(glRasterPos4iv);
+PFNGLRASTERPOS4SPROC glad_glRasterPos4s = GLAD_INITIAL_PROC(glRasterPos4s);
+PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv = GLAD_INITIAL_PROC(glRasterPos4sv);
+PFNGLREADBUFFERPROC glad_glReadBuffer = GLAD_INITIAL_PROC(glReadBuffer);
+PFNGLREADPIXELSPROC glad_glReadPixels = GLAD_INITIAL_PROC(glReadPixels);
+PFNGLREADNPIXELSPROC glad_glReadnPixels = GLAD_INITIAL_PROC(glReadnPixels);
+PFNGLRECTDPROC glad_glRectd = GLAD_INITIAL_PROC(glRectd);
+PFNGLRECTDVPROC glad_glRectdv = GLAD_INITIAL_PROC(glRectdv);
+PFNGLRECTFPROC glad_glRectf = GLAD_INITIAL_PROC(glRectf);
+PFNGLRECTFVPROC glad_glRectfv = GLAD_INITIAL_PROC(glRectfv);
+PFNGLRECTIPROC glad_glRecti = GLAD_INITIAL_PROC(glRecti);
+PFNGLRECTIVPROC glad_glRectiv = GLAD_INITIAL_PROC(glRectiv);
+PFNGLRECTSPROC glad_glRects = GLAD_INITIAL_PROC(glRects);
+PFNGLRECTSVPROC glad_glRectsv = GLAD_INITIAL_PROC(glRectsv);
+PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = GLAD_INITIAL_PROC(glReleaseShaderCompiler);
+PFNGLRENDERMODEPROC glad_glRenderMode = GLAD_INITIAL_PROC(glRenderMode);
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = GLAD_INITIAL_PROC(glRenderbufferStorage);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = GLAD_INITIAL_PROC(glRenderbufferStorageMultisample);
+PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = GLAD_INITIAL_PROC(glResumeTransformFeedback);
+PFNGLROTATEDPROC glad_glRotated = GLAD_INITIAL_PROC(glRotated);
+PFNGLROTATEFPROC glad_glRotatef = GLAD_INITIAL_PROC(glRotatef);
+PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = GLAD_INITIAL_PROC(glSampleCoverage);
+PFNGLSAMPLEMASKIPROC glad_glSampleMaski = GLAD_INITIAL_PROC(glSampleMaski);
+PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = GLAD_INITIAL_PROC(glSamplerParameterIiv);
+PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = GLAD_INITIAL_PROC(glSamplerParameterIuiv);
+PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = GLAD_INITIAL_PROC(glSamplerParameterf);
+PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = GLAD_INITIAL_PROC(glSamplerParameterfv);
+PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = GLAD_INITIAL_PROC(glSamplerParameteri);
+PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = GLAD_INITIAL_PROC(glSamplerParameteriv);
+PFNGLSCALEDPROC glad_glScaled = GLAD_INITIAL_PROC(glScaled);
+PFNGLSCALEFPROC glad_glScalef = GLAD_INITIAL_PROC(glScalef);
+PFNGLSCISSORPROC glad_glScissor = GLAD_INITIAL_PROC(glScissor);
+PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = GLAD_INITIAL_PROC(glScissorArrayv);
+PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = GLAD_INITIAL_PROC(glScissorIndexed);
+PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = GLAD_INITIAL_PROC(glScissorIndexedv);
+PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b = GLAD_INITIAL_PROC(glSecondaryColor3b);
+PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv = GLAD_INITIAL_PROC(glSecondaryColor3bv);
+PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d = GLAD_INITIAL_PROC(glSecondaryColor3d);
+PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv = GLAD_INITIAL_PROC(glSecondaryColor3dv);
+PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f = GLAD_INITIAL_PROC(glSecondaryColor3f);
+PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv = GLAD_INITIAL_PROC(glSecondaryColor3fv);
+PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i = GLAD_INITIAL_PROC(glSecondaryColor3i);
+PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv = GLAD_INITIAL_PROC(glSecondaryColor3iv);
+PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s = GLAD_INITIAL_PROC(glSecondaryColor3s);
+PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv = GLAD_INITIAL_PROC(glSecondaryColor3sv);
+PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub = GLAD_INITIAL_PROC(glSecondaryColor3ub);
+PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv = GLAD_INITIAL_PROC(glSecondaryColor3ubv);
+PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui = GLAD_INITIAL_PROC(glSecondaryColor3ui);
+PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv = GLAD_INITIAL_PROC(glSecondaryColor3uiv);
+PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us = GLAD_INITIAL_PROC(glSecondaryColor3us);
+PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv = GLAD_INITIAL_PROC(glSecondaryColor3usv);
+PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = GLAD_INITIAL_PROC(glSecondaryColorP3ui);
+PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = GLAD_INITIAL_PROC(glSecondaryColorP3uiv);
+PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer = GLAD_INITIAL_PROC(glSecondaryColorPointer);
+PFNGLSELECTBUFFERPROC glad_glSelectBuffer = GLAD_INITIAL_PROC(glSelectBuffer);
+PFNGLSHADEMODELPROC glad_glShadeModel = GLAD_INITIAL_PROC(glShadeModel);
+PFNGLSHADERBINARYPROC glad_glShaderBinary = GLAD_INITIAL_PROC(glShaderBinary);
+PFNGLSHADERSOURCEPROC glad_glShaderSource = GLAD_INITIAL_PROC(glShaderSource);
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = GLAD_INITIAL_PROC(glShaderStorageBlockBinding);
+PFNGLSPECIALIZESHADERPROC glad_glSpecializeShader = GLAD_INITIAL_PROC(glSpecializeShader);
+PFNGLSTENCILFUNCPROC glad_glStencilFunc = GLAD_INITIAL_PROC(glStencilFunc);
+PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = GLAD_INITIAL_PROC(glStencilFuncSeparate);
+PFNGLSTENCILMASKPROC glad_glStencilMask = GLAD_INITIAL_PROC(glStencilMask);
+PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = GLAD_INITIAL_PROC(glStencilMaskSeparate);
+PFNGLSTENCILOPPROC glad_glStencilOp = GLAD_INITIAL_PROC(glStencilOp);
+PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = GLAD_INITIAL_PROC(glStencilOpSeparate);
+PFNGLTEXBUFFERPROC glad_glTexBuffer = GLAD_INITIAL_PROC(glTexBuffer);
+PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = GLAD_INITIAL_PROC(glTexBufferRange);
+PFNGLTEXCOORD1DPROC glad_glTexCoord1d = GLAD_INITIAL_PROC(glTexCoord1d);
+PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv = GLAD_INITIAL_PROC(glTexCoord1dv);
+PFNGLTEXCOORD1FPROC glad_glTexCoord1f = GLAD_INITIAL_PROC(glTexCoord1f);
+PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv = GLAD_INITIAL_PROC(glTexCoord1fv);
+PFNGLTEXCOORD1IPROC glad_glTexCoord1i = GLAD_INITIAL_PROC(glTexCoord1i);
+PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv = GLAD_INITIAL_PROC(glTexCoord1iv);
+PFNGLTEXCOORD1SPROC glad_glTexCoord1s = GLAD_INITIAL_PROC(glTexCoord1s);
+PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv = GLAD_INITIAL_PROC(glTexCoord1sv);
+PFNGLTEXCOORD2DPROC glad_glTexCoord2d = GLAD_INITIAL_PROC(glTexCoord2d);
+PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv = GLAD_INITIAL_PROC(glTexCoord2dv);
+PFNGLTEXCOORD2FPROC glad_glTexCoord2f = GLAD_INITIAL_PROC(glTexCoord2f);
+PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv = GLAD_INITIAL_PROC(glTexCoord2fv);
+PFNGLTEXCOORD2IPROC glad_glTexCoord2i = GLAD_INITIAL_PROC(glTexCoord2i);
+PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv = GLAD_INITIAL_PROC(glTexCoord2iv);
+PFNGLTEXCOORD2SPROC glad_glTexCoord2s = GLAD_INITIAL_PROC(glTexCoord2s);
+PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv = GLAD_INITIAL_PROC(glTexCoord2sv);
+PFNGLTEXCOORD3DPROC glad_glTexCoord3d = GLAD_INITIAL_PROC(glTexCoord3d);
+PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv = GLAD_INITIAL_PROC(glTexCoord3dv);
+PFNGLTEXCOORD3FPROC glad_glTexCoord3f = GLAD_INITIAL_PROC(glTexCoord3f);
+PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv = GLAD_INITIAL_PROC(glTexCoord3fv);
+PFNGLTEXCOORD3IPROC glad_glTexCoord3i = GLAD_INITIAL_PROC(glTexCoord3i);
+PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv = GLAD_INITIAL_PROC(glTexCoord3iv);
+PFNGLTEXCOORD3SPROC glad_glTexCoord3s = GLAD_INITIAL_PROC(glTexCoord3s);
+PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv = GLAD_INITIAL_PROC(glTexCoord3sv);
+PFNGLTEXCOORD4DPROC glad_glTexCoord4d = GLAD_INITIAL_PROC(glTexCoord4d);
+PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv = GLAD_INITIAL_PROC(glTexCoord4dv);
+PFNGLTEXCOORD4FPROC glad_glTexCoord4f = GLAD_INITIAL_PROC(glTexCoord4f);
+PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv = GLAD_INITIAL_PROC(glTexCoord4fv);
+PFNGLTEXCOORD4IPROC glad_glTexCoord4i = GLAD_INITIAL_PROC(glTexCoord4i);
+PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv = GLAD_INITIAL_PROC(glTexCoord4iv);
+PFNGLTEXCOORD4SPROC glad_glTexCoord4s = GLAD_INITIAL_PROC(glTexCoord4s);
+PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv = GLAD_INITIAL_PROC(glTexCoord4sv);
+PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = GLAD_INITIAL_PROC(glTexCoordP1ui);
+PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = GLAD_INITIAL_PROC(glTexCoordP1uiv);
+PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = GLAD_INITIAL_PROC(glTexCoordP2ui);
+PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = GLAD_INITIAL_PROC(glTexCoordP2uiv);
+PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = GLAD_INITIAL_PROC(glTexCoordP3ui);
+PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = GLAD_INITIAL_PROC(glTexCoordP3uiv);
+PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = GLAD_INITIAL_PROC(glTexCoordP4ui);
+PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = GLAD_INITIAL_PROC(glTexCoordP4uiv);
+PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer = GLAD_INITIAL_PROC(glTexCoordPointer);
+PFNGLTEXENVFPROC glad_glTexEnvf = GLAD_INITIAL_PROC(glTexEnvf);
+PFNGLTEXENVFVPROC glad_glTexEnvfv = GLAD_INITIAL_PROC(glTexEnvfv);
+PFNGLTEXENVIPROC glad_glTexEnvi = GLAD_INITIAL_PROC(glTexEnvi);
+PFNGLTEXENVIVPROC glad_glTexEnviv = GLAD_INITIAL_PROC(glTexEnviv);
+PFNGLTEXGENDPROC glad_glTexGend = GLAD_INITIAL_PROC(glTexGend);
+PFNGLTEXGENDVPROC glad_glTexGendv = GLAD_INITIAL_PROC(glTexGendv);
+PFNGLTEXGENFPROC glad_glTexGenf = GLAD_INITIAL_PROC(glTexGenf);
+PFNGLTEXGENFVPROC glad_glTexGenfv = GLAD_INITIAL_PROC(glTexGenfv);
+PFNGLTEXGENIPROC glad_glTexGeni = GLAD_INITIAL_PROC(glTexGeni);
+PFNGLTEXGENIVPROC glad_glTexGeniv = GLAD_INITIAL_PROC(glTexGeniv);
+PFNGLTEXIMAGE1DPROC glad_glTexImage1D = GLAD_INITIAL_PROC(glTexImage1D);
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D = GLAD_INITIAL_PROC(glTexImage2D);
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = GLAD_INITIAL_PROC(glTexImage2DMultisample);
+PFNGLTEXIMAGE3DPROC glad_glTexImage3D = GLAD_INITIAL_PROC(glTexImage3D);
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = GLAD_INITIAL_PROC(glTexImage3DMultisample);
+PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = GLAD_INITIAL_PROC(glTexParameterIiv);
+PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = GLAD_INITIAL_PROC(glTexParameterIuiv);
+PFNGLTEXPARAMETERFPROC glad_glTexParameterf = GLAD_INITIAL_PROC(glTexParameterf);
+PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = GLAD_INITIAL_PROC(glTexParameterfv);
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri = GLAD_INITIAL_PROC(glTexParameteri);
+PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = GLAD_INITIAL_PROC(glTexParameteriv);
+PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = GLAD_INITIAL_PROC(glTexStorage1D);
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = GLAD_INITIAL_PROC(glTexStorage2D);
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = GLAD_INITIAL_PROC(glTexStorage2DMultisample);
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = GLAD_INITIAL_PROC(glTexStorage3D);
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = GLAD_INITIAL_PROC(glTexStorage3DMultisample);
+PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = GLAD_INITIAL_PROC(glTexSubImage1D);
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = GLAD_INITIAL_PROC(glTexSubImage2D);
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = GLAD_INITIAL_PROC(glTexSubImage3D);
+PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier = GLAD_INITIAL_PROC(glTextureBarrier);
+PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = GLAD_INITIAL_PROC(glTextureBuffer);
+PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = GLAD_INITIAL_PROC(glTextureBufferRange);
+PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = GLAD_INITIAL_PROC(glTextureParameterIiv);
+PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = GLAD_INITIAL_PROC(glTextureParameterIuiv);
+PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = GLAD_INITIAL_PROC(glTextureParameterf);
+PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = GLAD_INITIAL_PROC(glTextureParameterfv);
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = GLAD_INITIAL_PROC(glTextureParameteri);
+PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = GLAD_INITIAL_PROC(glTextureParameteriv);
+PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = GLAD_INITIAL_PROC(glTextureStorage1D);
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = GLAD_INITIAL_PROC(glTextureStorage2D);
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = GLAD_INITIAL_PROC(glTextureStorage2DMultisample);
+PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = GLAD_INITIAL_PROC(glTextureStorage3D);
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = GLAD_INITIAL_PROC(glTextureStorage3DMultisample);
+PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = GLAD_INITIAL_PROC(glTextureSubImage1D);
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = GLAD_INITIAL_PROC(glTextureSubImage2D);
+PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = GLAD_INITIAL_PROC(glTextureSubImage3D);
+PFNGLTEXTUREVIEWPROC glad_glTextureView = GLAD_INITIAL_PROC(glTextureView);
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = GLAD_INITIAL_PROC(glTransformFeedbackBufferBase);
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = GLAD_INITIAL_PROC(glTransformFeedbackBufferRange);
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = GLAD_INITIAL_PROC(glTransformFeedbackVaryings);
+PFNGLTRANSLATEDPROC glad_glTranslated = GLAD_INITIAL_PROC(glTranslated);
+PFNGLTRANSLATEFPROC glad_glTranslatef = GLAD_INITIAL_PROC(glTranslatef);
+PFNGLUNIFORM1DPROC glad_glUniform1d = GLAD_INITIAL_PROC(glUniform1d);
+PFNGLUNIFORM1DVPROC glad_glUniform1dv = GLAD_INITIAL_PROC(glUniform1dv);
+PFNGLUNIFORM1FPROC glad_glUniform1f = GLAD_INITIAL_PROC(glUniform1f);
+PFNGLUNIFORM1FVPROC glad_glUniform1fv = GLAD_INITIAL_PROC(glUniform1fv);
+PFNGLUNIFORM1IPROC glad_glUniform1i = GLAD_INITIAL_PROC(glUniform1i);
+PFNGLUNIFORM1IVPROC glad_glUniform1iv = GLAD_INITIAL_PROC(glUniform1iv);
+PFNGLUNIFORM1UIPROC glad_glUniform1ui = GLAD_INITIAL_PROC(glUniform1ui);
+PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = GLAD_INITIAL_PROC(glUniform1uiv);
+PFNGLUNIFORM2DPROC glad_glUniform2d = GLAD_INITIAL_PROC(glUniform2d);
+PFNGLUNIFORM2DVPROC glad_glUniform2dv = GLAD_INITIAL_PROC(glUniform2dv);
+PFNGLUNIFORM2FPROC glad_glUniform2f = GLAD_INITIAL_PROC(glUniform2f);
+PFNGLUNIFORM2FVPROC glad_glUniform2fv = GLAD_INITIAL_PROC(glUniform2fv);
+PFNGLUNIFORM2IPROC glad_glUniform2i = GLAD_INITIAL_PROC(glUniform2i);
+PFNGLUNIFORM2IVPROC glad_glUniform2iv = GLAD_INITIAL_PROC(glUniform2iv);
+PFNGLUNIFORM2UIPROC glad_glUniform2ui = GLAD_INITIAL_PROC(glUniform2ui);
+PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = GLAD_INITIAL_PROC(glUniform2uiv);
+PFNGLUNIFORM3DPROC glad_glUniform3d = GLAD_INITIAL_PROC(glUniform3d);
+PFNGLUNIFORM3DVPROC glad_glUniform3dv = GLAD_INITIAL_PROC(glUniform3dv);
+PFNGLUNIFORM3FPROC glad_glUniform3f = GLAD_INITIAL_PROC(glUniform3f);
+PFNGLUNIFORM3FVPROC glad_glUniform3fv = GLAD_INITIAL_PROC(glUniform3fv);
+PFNGLUNIFORM3IPROC glad_glUniform3i = GLAD_INITIAL_PROC(glUniform3i);
+PFNGLUNIFORM3IVPROC glad_glUniform3iv = GLAD_INITIAL_PROC(glUniform3iv);
+PFNGLUNIFORM3UIPROC glad_glUniform3ui = GLAD_INITIAL_PROC(glUniform3ui);
+PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = GLAD_INITIAL_PROC(glUniform3uiv);
+PFNGLUNIFORM4DPROC glad_glUniform4d = GLAD_INITIAL_PROC(glUniform4d);
+PFNGLUNIFORM4DVPROC glad_glUniform4dv = GLAD_INITIAL_PROC(glUniform4dv);
+PFNGLUNIFORM4FPROC glad_glUniform4f = GLAD_INITIAL_PROC(glUniform4f);
+PFNGLUNIFORM4FVPROC glad_glUniform4fv = GLAD_INITIAL_PROC(glUniform4fv);
+PFNGLUNIFORM4IPROC glad_glUniform4i = GLAD_INITIAL_PROC(glUniform4i);
+PFNGLUNIFORM4IVPROC glad_glUniform4iv = GLAD_INITIAL_PROC(glUniform4iv);
+PFNGLUNIFORM4UIPROC glad_glUniform4ui = GLAD_INITIAL_PROC(glUniform4ui);
+PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = GLAD_INITIAL_PROC(glUniform4uiv);
+PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = GLAD_INITIAL_PROC(glUniformBlockBinding);
+PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = GLAD_INITIAL_PROC(glUniformMatrix2dv);
+PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = GLAD_INITIAL_PROC(glUniformMatrix2fv);
+PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = GLAD_INITIAL_PROC(glUniformMatrix2x3dv);
+PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = GLAD_INITIAL_PROC(glUniformMatrix2x3fv);
+PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = GLAD_INITIAL_PROC(glUniformMatrix2x4dv);
+PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = GLAD_INITIAL_PROC(glUniformMatrix2x4fv);
+PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = GLAD_INITIAL_PROC(glUniformMatrix3dv);
+PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = GLAD_INITIAL_PROC(glUniformMatrix3fv);
+PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = GLAD_INITIAL_PROC(glUniformMatrix3x2dv);
+PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = GLAD_INITIAL_PROC(glUniformMatrix3x2fv);
+PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = GLAD_INITIAL_PROC(glUniformMatrix3x4dv);
+PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = GLAD_INITIAL_PROC(glUniformMatrix3x4fv);
+PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = GLAD_INITIAL_PROC(glUniformMatrix4dv);
+PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = GLAD_INITIAL_PROC(glUniformMatrix4fv);
+PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = GLAD_INITIAL_PROC(glUniformMatrix4x2dv);
+PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = GLAD_INITIAL_PROC(glUniformMatrix4x2fv);
+PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = GLAD_INITIAL_PROC(glUniformMatrix4x3dv);
+PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = GLAD_INITIAL_PROC(glUniformMatrix4x3fv);
+PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = GLAD_INITIAL_PROC(glUniformSubroutinesuiv);
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = GLAD_INITIAL_PROC(glUnmapBuffer);
+PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = GLAD_INITIAL_PROC(glUnmapNamedBuffer);
+PFNGLUSEPROGRAMPROC glad_glUseProgram = GLAD_INITIAL_PROC(glUseProgram);
+PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = GLAD_INITIAL_PROC(glUseProgramStages);
+PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = GLAD_INITIAL_PROC(glValidateProgram);
+PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = GLAD_INITIAL_PROC(glValidateProgramPipeline);
+PFNGLVERTEX2DPROC glad_glVertex2d = GLAD_INITIAL_PROC(glVertex2d);
+PFNGLVERTEX2DVPROC glad_glVertex2dv = GLAD_INITIAL_PROC(glVertex2dv);
+PFNGLVERTEX2FPROC glad_glVertex2f = GLAD_INITIAL_PROC(glVertex2f);
+PFNGLVERTEX2FVPROC glad_glVertex2fv = GLAD_INITIAL_PROC(glVertex2fv);
+PFNGLVERTEX2IPROC glad_glVertex2i = GLAD_INITIAL_PROC(glVertex2i);
+PFNGLVERTEX2IVPROC glad_glVertex2iv = GLAD_INITIAL_PROC(glVertex2iv);
+PFNGLVERTEX2SPROC glad_glVertex2s = GLAD_INITIAL_PROC(glVertex2s);
+PFNGLVERTEX2SVPROC glad_glVertex2sv = GLAD_INITIAL_PROC(glVertex2sv);
+PFNGLVERTEX3DPROC glad_glVertex3d = GLAD_INITIAL_PROC(glVertex3d);
+PFNGLVERTEX3DVPROC glad_glVertex3dv = GLAD_INITIAL_PROC(glVertex3dv);
+PFNGLVERTEX3FPROC glad_glVertex3f = GLAD_INITIAL_PROC(glVertex3f);
+PFNGLVERTEX3FVPROC glad_glVertex3fv = GLAD_INITIAL_PROC(glVertex3fv);
+PFNGLVERTEX3IPROC glad_glVertex3i = GLAD_INITIAL_PROC(glVertex3i);
+PFNGLVERTEX3IVPROC glad_glVertex3iv = GLAD_INITIAL_PROC(glVertex3iv);
+PFNGLVERTEX3SPROC glad_glVertex3s = GLAD_INITIAL_PROC(glVertex3s);
+PFNGLVERTEX3SVPROC glad_glVertex3sv = GLAD_INITIAL_PROC(glVertex3sv);
+PFNGLVERTEX4DPROC glad_glVertex4d = GLAD_INITIAL_PROC(glVertex4d);
+PFNGLVERTEX4DVPROC glad_glVertex4dv = GLAD_INITIAL_PROC(glVertex4dv);
+PFNGLVERTEX4FPROC glad_glVertex4f = GLAD_INITIAL_PROC(glVertex4f);
+PFNGLVERTEX4FVPROC glad_glVertex4fv = GLAD_INITIAL_PROC(glVertex4fv);
+PFNGLVERTEX4IPROC glad_glVertex4i = GLAD_INITIAL_PROC(glVertex4i);
+PFNGLVERTEX4IVPROC glad_glVertex4iv = GLAD_INITIAL_PROC(glVertex4iv);
+PFNGLVERTEX4SPROC glad_glVertex4s = GLAD_INITIAL_PROC(glVertex4s);
+PFNGLVERTEX4SVPROC glad_glVertex4sv = GLAD_INITIAL_PROC(glVertex4sv);
+PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = GLAD_INITIAL_PROC(glVertexArrayAttribBinding);
+PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = GLAD_INITIAL_PROC(glVertexArrayAttribFormat);
+PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = GLAD_INITIAL_PROC(glVertexArrayAttribIFormat);
+PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = GLAD_INITIAL_PROC(glVertexArrayAttribLFormat);
+PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = GLAD_INITIAL_PROC(glVertexArrayBindingDivisor);
+PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = GLAD_INITIAL_PROC(glVertexArrayElementBuffer);
+PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = GLAD_INITIAL_PROC(glVertexArrayVertexBuffer);
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = GLAD_INITIAL_PROC(glVertexArrayVertexBuffers);
+PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = GLAD_INITIAL_PROC(glVertexAttrib1d);
+PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = GLAD_INITIAL_PROC(glVertexAttrib1dv);
+PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = GLAD_INITIAL_PROC(glVertexAttrib1f);
+PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = GLAD_INITIAL_PROC(glVertexAttrib1fv);
+PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = GLAD_INITIAL_PROC(glVertexAttrib1s);
+PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = GLAD_INITIAL_PROC(glVertexAttrib1sv);
+PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = GLAD_INITIAL_PROC(glVertexAttrib2d);
+PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = GLAD_INITIAL_PROC(glVertexAttrib2dv);
+PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = GLAD_INITIAL_PROC(glVertexAttrib2f);
+PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = GLAD_INITIAL_PROC(glVertexAttrib2fv);
+PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = GLAD_INITIAL_PROC(glVertexAttrib2s);
+PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = GLAD_INITIAL_PROC(glVertexAttrib2sv);
+PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = GLAD_INITIAL_PROC(glVertexAttrib3d);
+PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = GLAD_INITIAL_PROC(glVertexAttrib3dv);
+PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = GLAD_INITIAL_PROC(glVertexAttrib3f);
+PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = GLAD_INITIAL_PROC(glVertexAttrib3fv);
+PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = GLAD_INITIAL_PROC(glVertexAttrib3s);
+PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = GLAD_INITIAL_PROC(glVertexAttrib3sv);
+PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = GLAD_INITIAL_PROC(glVertexAttrib4Nbv);
+PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = GLAD_INITIAL_PROC(glVertexAttrib4Niv);
+PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = GLAD_INITIAL_PROC(glVertexAttrib4Nsv);
+PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = GLAD_INITIAL_PROC(glVertexAttrib4Nub);
+PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = GLAD_INITIAL_PROC(glVertexAttrib4Nubv);
+PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = GLAD_INITIAL_PROC(glVertexAttrib4Nuiv);
+PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = GLAD_INITIAL_PROC(glVertexAttrib4Nusv);
+PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = GLAD_INITIAL_PROC(glVertexAttrib4bv);
+PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = GLAD_INITIAL_PROC(glVertexAttrib4d);
+PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = GLAD_INITIAL_PROC(glVertexAttrib4dv);
+PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = GLAD_INITIAL_PROC(glVertexAttrib4f);
+PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = GLAD_INITIAL_PROC(glVertexAttrib4fv);
+PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = GLAD_INITIAL_PROC(glVertexAttrib4iv);
+PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = GLAD_INITIAL_PROC(glVertexAttrib4s);
+PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = GLAD_INITIAL_PROC(glVertexAttrib4sv);
+PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = GLAD_INITIAL_PROC(glVertexAttrib4ubv);
+PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = GLAD_INITIAL_PROC(glVertexAttrib4uiv);
+PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = GLAD_INITIAL_PROC(glVertexAttrib4usv);
+PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = GLAD_INITIAL_PROC(glVertexAttribBinding);
+PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = GLAD_INITIAL_PROC(glVertexAttribDivisor);
+PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = GLAD_INITIAL_PROC(glVertexAttribFormat);
+PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = GLAD_INITIAL_PROC(glVertexAttribI1i);
+PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = GLAD_INITIAL_PROC(glVertexAttribI1iv);
+PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = GLAD_INITIAL_PROC(glVertexAttribI1ui);
+PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = GLAD_INITIAL_PROC(glVertexAttribI1uiv);
+PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = GLAD_INITIAL_PROC(glVertexAttribI2i);
+PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = GLAD_INITIAL_PROC(glVertexAttribI2iv);
+PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = GLAD_INITIAL_PROC(glVertexAttribI2ui);
+PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = GLAD_INITIAL_PROC(glVertexAttribI2uiv);
+PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = GLAD_INITIAL_PROC(glVertexAttribI3i);
+PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = GLAD_INITIAL_PROC(glVertexAttribI3iv);
+PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = GLAD_INITIAL_PROC(glVertexAttribI3ui);
+PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = GLAD_INITIAL_PROC(glVertexAttribI3uiv);
+PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = GLAD_INITIAL_PROC(glVertexAttribI4bv);
+PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = GLAD_INITIAL_PROC(glVertexAttribI4i);
+PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = GLAD_INITIAL_PROC(glVertexAttribI4iv);
+PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = GLAD_INITIAL_PROC(glVertexAttribI4sv);
+PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = GLAD_INITIAL_PROC(glVertexAttribI4ubv);
+PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = GLAD_INITIAL_PROC(glVertexAttribI4ui);
+PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = GLAD_INITIAL_PROC(glVertexAttribI4uiv);
+PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = GLAD_INITIAL_PROC(glVertexAttribI4usv);
+PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = GLAD_INITIAL_PROC(glVertexAttribIFormat);
+PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = GLAD_INITIAL_PROC(glVertexAttribIPointer);
+PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = GLAD_INITIAL_PROC(glVertexAttribL1d);
+PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = GLAD_INITIAL_PROC(glVertexAttribL1dv);
+PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = GLAD_INITIAL_PROC(glVertexAttribL2d);
+PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = GLAD_INITIAL_PROC(glVertexAttribL2dv);
+PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = GLAD_INITIAL_PROC(glVertexAttribL3d);
+PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = GLAD_INITIAL_PROC(glVertexAttribL3dv);
+PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = GLAD_INITIAL_PROC(glVertexAttribL4d);
+PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = GLAD_INITIAL_PROC(glVertexAttribL4dv);
+PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = GLAD_INITIAL_PROC(glVertexAttribLFormat);
+PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = GLAD_INITIAL_PROC(glVertexAttribLPointer);
+PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = GLAD_INITIAL_PROC(glVertexAttribP1ui);
+PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = GLAD_INITIAL_PROC(glVertexAttribP1uiv);
+PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = GLAD_INITIAL_PROC(glVertexAttribP2ui);
+PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = GLAD_INITIAL_PROC(glVertexAttribP2uiv);
+PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = GLAD_INITIAL_PROC(glVertexAttribP3ui);
+PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = GLAD_INITIAL_PROC(glVertexAttribP3uiv);
+PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = GLAD_INITIAL_PROC(glVertexAttribP4ui);
+PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = GLAD_INITIAL_PROC(glVertexAttribP4uiv);
+PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = GLAD_INITIAL_PROC(glVertexAttribPointer);
+PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = GLAD_INITIAL_PROC(glVertexBindingDivisor);
+PFNGLVERTEXP2UIPROC glad_glVertexP2ui = GLAD_INITIAL_PROC(glVertexP2ui);
+PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = GLAD_INITIAL_PROC(glVertexP2uiv);
+PFNGLVERTEXP3UIPROC glad_glVertexP3ui = GLAD_INITIAL_PROC(glVertexP3ui);
+PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = GLAD_INITIAL_PROC(glVertexP3uiv);
+PFNGLVERTEXP4UIPROC glad_glVertexP4ui = GLAD_INITIAL_PROC(glVertexP4ui);
+PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = GLAD_INITIAL_PROC(glVertexP4uiv);
+PFNGLVERTEXPOINTERPROC glad_glVertexPointer = GLAD_INITIAL_PROC(glVertexPointer);
+PFNGLVIEWPORTPROC glad_glViewport = GLAD_INITIAL_PROC(glViewport);
+PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = GLAD_INITIAL_PROC(glViewportArrayv);
+PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = GLAD_INITIAL_PROC(glViewportIndexedf);
+PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = GLAD_INITIAL_PROC(glViewportIndexedfv);
+PFNGLWAITSYNCPROC glad_glWaitSync = GLAD_INITIAL_PROC(glWaitSync);
+PFNGLWINDOWPOS2DPROC glad_glWindowPos2d = GLAD_INITIAL_PROC(glWindowPos2d);
+PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv = GLAD_INITIAL_PROC(glWindowPos2dv);
+PFNGLWINDOWPOS2FPROC glad_glWindowPos2f = GLAD_INITIAL_PROC(glWindowPos2f);
+PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv = GLAD_INITIAL_PROC(glWindowPos2fv);
+PFNGLWINDOWPOS2IPROC glad_glWindowPos2i = GLAD_INITIAL_PROC(glWindowPos2i);
+PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv = GLAD_INITIAL_PROC(glWindowPos2iv);
+PFNGLWINDOWPOS2SPROC glad_glWindowPos2s = GLAD_INITIAL_PROC(glWindowPos2s);
+PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv = GLAD_INITIAL_PROC(glWindowPos2sv);
+PFNGLWINDOWPOS3DPROC glad_glWindowPos3d = GLAD_INITIAL_PROC(glWindowPos3d);
+PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv = GLAD_INITIAL_PROC(glWindowPos3dv);
+PFNGLWINDOWPOS3FPROC glad_glWindowPos3f = GLAD_INITIAL_PROC(glWindowPos3f);
+PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv = GLAD_INITIAL_PROC(glWindowPos3fv);
+PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = GLAD_INITIAL_PROC(glWindowPos3i);
+PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = GLAD_INITIAL_PROC(glWindowPos3iv);
+PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = GLAD_INITIAL_PROC(glWindowPos3s);
+PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = GLAD_INITIAL_PROC(glWindowPos3sv);
+#ifndef GLAD_ON_DEMAND
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -2432,9 +6673,21 @@ static void load_GL_VERSION_4_6(GLADloadproc load) {
 	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
 	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
 }
+static void load_GL_ARB_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)load("glMaxShaderCompilerThreadsARB");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+#endif
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
+	GLAD_GL_ARB_parallel_shader_compile = has_ext("GL_ARB_parallel_shader_compile");
+	GLAD_GL_ARB_texture_compression_bptc = has_ext("GL_ARB_texture_compression_bptc");
+	GLAD_GL_EXT_texture_compression_s3tc = has_ext("GL_EXT_texture_compression_s3tc");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
 	free_exts();
 	return 1;
 }
@@ -2505,6 +6758,11 @@ int gladLoadGLLoader(GLADloadproc load) {
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
+#ifdef GLAD_ON_DEMAND
+	/* nothing else is resolved here, see glad_on_demand_load */
+	glad_on_demand_loader = load;
+	find_coreGL();
+#else
 	find_coreGL();
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
@@ -2525,8 +6783,13 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_4_4(load);
 	load_GL_VERSION_4_5(load);
 	load_GL_VERSION_4_6(load);
+#endif
 
 	if (!find_extensionsGL()) return 0;
+#ifndef GLAD_ON_DEMAND
+	load_GL_ARB_parallel_shader_compile(load);
+	load_GL_KHR_parallel_shader_compile(load);
+#endif
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
@@ -2,63 +2,219 @@
 #include <GLFW/glfw3.h>
 
 #include <iostream>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include "GLStateCache.h"
 #include "Shader.h"
-#include "stb_image.h"
+#include "ShaderPermutationCache.h"
+#include "ShaderWatcher.h"
+#include "Headless.h"
+#include "FrameProfiler.h"
+#include "TextureManager.h"
+#include "RenderQueue.h"
+#include "Benchmarks.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+// Command line options
+struct AppOptions
+{
+	bool headless = false;              // --headless: surfaceless EGL context + offscreen framebuffer, no window
+	int frames = 0;                     // --frames N: stop after N frames (0 = until the window is closed)
+	const char* screenshotPath = NULL;  // --screenshot file.png: dump the last headless frame
+	const char* profilePath = NULL;     // --profile-out trace.json|frames.csv: per stage CPU/GPU frame profile
+	bool uniformLookupBench = false;    // --uniform-bench: 1M uniform updates, glGetUniformLocation per call vs. the Shader's uniform table vs. handles, then exit
+	bool jpegBench = false;             // --jpeg-bench: decode MB/s of the JPEGs in src/assets/textures with the plain C, SSE2 and AVX2 kernels, then exit
+	bool pngBench = false;              // --png-bench: decode MB/s of RGB/RGBA PNGs per filter type, scalar vs. SIMD unfiltering, then exit
+	bool inflateBench = false;          // --inflate-bench: inflate MB/s of the PNG image data in src/assets/textures, fast loop vs. symbol at a time, then exit
+	int textureBenchCount = 0;          // --texture-bench N: time loading N textures serially vs. streamed, then exit
+	bool programCache = true;           // --no-program-cache: always compile shaders from source
+	const char* programCacheDir = NULL; // --program-cache-dir DIR: where linked programs are cached (default: shader_cache next to the executable)
+	bool startupStats = false;          // --startup-stats: print GL loader time, time to the first frame and peak RSS
+	bool spriteBench = false;           // --sprite-bench: sprites per second of the SpriteBatch at 10k, 100k and 1M sprites, then exit
+	bool instancingBench = false;       // --instancing-bench: 100k quads drawn one by one vs. instanced, then exit
+	bool queueBench = false;            // --queue-bench: randomized scene drawn in submission order vs. sorted by the RenderQueue, then exit
+	bool uboBench = false;              // --ubo-bench: uniform upload cost of 10k draws, glUniform* calls vs. uniform buffers, then exit
+	bool containerCheck = false;        // --container-check: malformed DDS/KTX2 headers must be rejected, exit code 1 if not
+	const char* compressTextures = NULL; // --compress-textures auto|bc1|bc3|bc7: write the sample textures as .dds next to them, report the memory saved, then exit
+	bool cullBench = false;            // --cull-bench: frustum culling of 1M objects, scalar vs. SIMD vs. BVH, then exit
+	bool lodBench = false;             // --lod-bench: 10k meshes at full detail vs. LODs picked by screen space error, then exit
+	bool meshBench = false;            // --mesh-bench: cache, overdraw and fetch optimization of a large mesh, CPU and GPU, then exit
+	bool vertexFormatBench = false;     // --vertex-format-bench: GPU time of a 1M vertex mesh with float vs. packed attributes, then exit
+	bool compileBench = false;          // --compile-bench: build 200 programs one by one vs. as one ShaderBatch, then exit
+	int jobsBenchThreads = -1;          // --jobs-bench N: record a 200k object scene on 1 to N threads (0 = all cores), then exit
+	bool stateStats = false;            // --state-stats: GL state calls issued and elided by the GLStateCache per frame
+	bool uniformColor = false;          // --uniform-color: draw the quad with the USE_UNIFORM_COLOR permutation of fshader.glsl
+	bool hotReload = true;              // --no-hot-reload: don't watch the shader files for changes
+};
+
+// Render loop stages measured by the frame profiler
+enum ProfileStage { STAGE_INPUT, STAGE_TEXTURE_UPLOAD, STAGE_SHADER_RELOAD, STAGE_CLEAR, STAGE_RECORD, STAGE_DRAW, STAGE_SWAP, STAGE_POLL_EVENTS, STAGE_COUNT };
 
 // Function prototype Declaration
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void processInput(GLFWwindow* window);
+AppOptions parseArguments(int argc, char** argv);
+long peakResidentKiB();
+std::string executableDirectory(const char* argv0);
 
 // Settings
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
 // App Entry point
-int main()
+int main(int argc, char** argv)
 {
-	// glfw: initialize and configure
-	// ------------------------------
-	glfwInit();
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3); // set major version to 3
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3); // set minor version to 3   osea sera 3.3
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-	// core-profile means we'll get access to a smaller subset of OpenGL features without backwards-compatible features we no longer need
+	auto startupBegin = std::chrono::steady_clock::now();
+	auto millisecondsSince = [](std::chrono::steady_clock::time_point start) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+	AppOptions options = parseArguments(argc, argv);
+	GLFWwindow* window = NULL;
+	GLADloadproc loader = (GLADloadproc)glfwGetProcAddress;
+
+#ifdef HEADLESS_SUPPORTED
+	HeadlessContext headlessContext; // must outlive every GL object below
+#endif
+	if (options.headless)
+	{
+		// headless: no GLFW at all, the same render path draws into an offscreen framebuffer
+		// -----------------------------------------------------------------------------------
+#ifdef HEADLESS_SUPPORTED
+		if (!headlessContext.Create(3, 3))
+			return -1;
+		loader = (GLADloadproc)HeadlessContext::GetProcAddress;
+#else
+		std::cout << "ERROR::HEADLESS::NOT_SUPPORTED_ON_THIS_PLATFORM (EGL headers not found)" << std::endl;
+		return -1;
+#endif
+	}
+	else
+	{
+		// glfw: initialize and configure
+		// ------------------------------
+		glfwInit();
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3); // set major version to 3
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3); // set minor version to 3   osea sera 3.3
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		// core-profile means we'll get access to a smaller subset of OpenGL features without backwards-compatible features we no longer need
 
 #ifdef __APPLE__
-	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE); // MAC Os
+		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE); // MAC Os
 #endif 
 
-	// GLFW window creation
-	// --------------------
-	GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Learning OpenGL", NULL, NULL); //The function returns a GLFWwindow object that we will later need for other GLFW operations
-	if (window == NULL)
-	{
-		std::cout << "Failed to create GLFW Window" << std::endl;
-		glfwTerminate();
-		return -1;
+		// GLFW window creation
+		// --------------------
+		window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Learning OpenGL", NULL, NULL); //The function returns a GLFWwindow object that we will later need for other GLFW operations
+		if (window == NULL)
+		{
+			std::cout << "Failed to create GLFW Window" << std::endl;
+			glfwTerminate();
+			return -1;
+		}
+		glfwMakeContextCurrent(window); // tell GLFW to make the context of our window the main context on the current thread
+		glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 	}
-	glfwMakeContextCurrent(window); // tell GLFW to make the context of our window the main context on the current thread
-	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
-	
 	// glad: load all OpenGL function pointers
 	// ---------------------------------------
 	//  GLAD manages function pointers for OpenGL so we want to initialize GLAD before we call any OpenGL function
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) //GLFW gives us glfwGetProcAddress that defines the correct function based on which OS we're compiling for
+	//  (glad.c built with -DGLAD_ON_DEMAND only reads the version here and resolves each function on its first call)
+	auto loaderBegin = std::chrono::steady_clock::now();
+	if (!gladLoadGLLoader(loader)) //GLFW gives us glfwGetProcAddress that defines the correct function based on which OS we're compiling for (eglGetProcAddress when headless)
 	{
 		std::cout << "Failed to initialize GLAD" << std::endl;
 		return -1;
 	}
+	double loaderMs = millisecondsSince(loaderBegin);
 
 	// There is a maximum number of vertex attributes we're allowed to declare limited by the hardware.
 	int nvAttrs = 0;
 	glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &nvAttrs);
 	std::cout << "Maximun number of vertex attributes supported: " << nvAttrs << std::endl;
 
+	// headless rendering goes into an offscreen framebuffer instead of the window's back buffer
+	std::unique_ptr<OffscreenTarget> offscreen;
+	if (options.headless)
+	{
+		std::cout << "Headless renderer: " << glGetString(GL_RENDERER) << " (" << glGetString(GL_VERSION) << ")" << std::endl;
+		offscreen.reset(new OffscreenTarget(SCR_WIDTH, SCR_HEIGHT));
+	}
+
+	if (options.uniformLookupBench || options.jpegBench || options.pngBench || options.inflateBench || options.textureBenchCount > 0 || options.spriteBench || options.instancingBench || options.queueBench || options.jobsBenchThreads >= 0 || options.uboBench || options.compileBench || options.vertexFormatBench || options.meshBench || options.lodBench || options.cullBench || options.compressTextures || options.containerCheck)
+	{
+		if (options.uniformLookupBench)
+			runUniformLookupBenchmark();
+		if (options.jpegBench)
+			runJpegBenchmark();
+		if (options.pngBench)
+			runPngBenchmark();
+		if (options.inflateBench)
+			runInflateBenchmark();
+		if (options.textureBenchCount > 0)
+			runTextureBenchmark(options.textureBenchCount);
+		if (options.spriteBench)
+			runSpriteBenchmark(SCR_WIDTH, SCR_HEIGHT);
+		if (options.instancingBench)
+			runInstancingBenchmark();
+		if (options.queueBench)
+			runQueueBenchmark();
+		if (options.jobsBenchThreads >= 0)
+			runJobsBenchmark(options.jobsBenchThreads);
+		if (options.uboBench)
+			runUniformBenchmark();
+		if (options.compileBench)
+			runCompileBenchmark();
+		if (options.vertexFormatBench)
+			runVertexFormatBenchmark();
+		if (options.meshBench)
+			runMeshBenchmark();
+		if (options.lodBench)
+			runLodBenchmark();
+		if (options.cullBench)
+			runCullBenchmark();
+		if (options.compressTextures)
+			runTextureCompression(options.compressTextures);
+		int exitCode = options.containerCheck && !runContainerCheck() ? 1 : 0;
+		offscreen.reset();
+		if (window)
+			glfwTerminate();
+		return exitCode;
+	}
+
 	// build and compile our shader program
 	// ------------------------------------
-	Shader firstShader("src/assets/shaders/vshader.glsl", "src/assets/shaders/fshader.glsl");
+	// linked programs are cached on disk, later runs skip the driver compiler when nothing changed
+	ProgramCache programCache(options.programCacheDir ? options.programCacheDir : executableDirectory(argv[0]) + "/shader_cache");
+	// each (source, #define set) permutation is built once per run, whoever asks for it
+	ShaderPermutationCache shaderPermutations(options.programCache ? &programCache : NULL);
+	ShaderDefines firstShaderDefines;
+	if (options.uniformColor)
+		firstShaderDefines.Set("USE_UNIFORM_COLOR");
+	Shader* firstShaderProgram = shaderPermutations.Get("src/assets/shaders/vshader.glsl", "src/assets/shaders/fshader.glsl", firstShaderDefines);
+	if (!firstShaderProgram)
+	{
+		offscreen.reset();
+		if (window)
+			glfwTerminate();
+		return -1;
+	}
+	Shader& firstShader = *firstShaderProgram;
+	if (options.programCache)
+		programCache.PrintStats();
+	shaderPermutations.PrintStats();
+
+	// rebuild the shaders when their source files are saved, without stalling the render loop
+	ShaderWatcher shaderWatcher;
+	if (options.hotReload)
+	{
+		shaderWatcher.Watch(firstShader);
+		shaderWatcher.Start();
+	}
 
 
 	// set up vertex data (and buffer(s)) and configure vertex attributes
@@ -94,7 +250,9 @@ int main()
 	glGenBuffers(1, &EBO);
 
 	// bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-	glBindVertexArray(VAO); // 1. bind Vertex Array Object
+	// binds and state sets go through the state cache, which skips them when nothing changed
+	GLStateCache& state = GLStateCache::Get();
+	state.BindVertexArray(VAO); // 1. bind Vertex Array Object
 
 	// 2. copy our vertices array in a buffer for OpenGL to use
 	glBindBuffer(GL_ARRAY_BUFFER, VBO);  // 0. copy our vertices array in a buffer for OpenGL to use
@@ -118,52 +276,16 @@ int main()
 
 	// load and create a texture 
     // -------------------------
-	unsigned int textureID, texture2ID;
-	// texture 1
-	// ---------
-	glGenTextures(1, &textureID);
-	glBindTexture(GL_TEXTURE_2D, textureID); // all upcoming GL_TEXTURE_2D operations now have effect on this texture object
-	// set the texture wrapping parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);	// set texture wrapping to GL_REPEAT (default wrapping method)
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	// set texture filtering parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	// load image, create texture and generate mipmaps
-	int width, height, channels;
-	// OpenGL expects the 0.0 coordinate on the y-axis to be on the bottom side of the image, but images usually have 0.0 at the top of the y-axis. 
-	// Luckily for us, stb_image.h can flip the y-axis during image loading by adding the following statement before loading any image
-	stbi_set_flip_vertically_on_load(true); //tell stb_image.h to flip loaded texture's on the y-axis.
-	unsigned char* data = stbi_load("src/assets/textures/container.jpg", &width, &height, &channels, 0);
-	if (data)
-	{
-		// texture target, mipmap level, kind of format we want to store the texture, width, height, should always be 0 (some legacy stuff),
-		// 7th and 8th argument specify the format and datatype of the source image, The last argument is a ptr to the actual image data.
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-		glGenerateMipmap(GL_TEXTURE_2D); //  call glGenerateMipmap after generating the texture. This will automatically generate all the required mipmaps for the currently bound texture
-	}
-	else { std::cout << "ERROR::TEXTURE::FAILED_TO_LOAD_TEXTURE" << std::endl; }
-	stbi_image_free(data); // free data
-
-	// texture 1
-	// ---------
-	glGenTextures(1, &texture2ID);
-	glBindTexture(GL_TEXTURE_2D, texture2ID);
-	// set the texture wrapping parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);	// set texture wrapping to GL_REPEAT (default wrapping method)
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	// set texture filtering parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	// load image, create texture and generate mipmaps
-	data = stbi_load("src/assets/textures/awesomeface.png", &width, &height, &channels, 0);
-	if (data)
-	{
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data); 
-		glGenerateMipmap(GL_TEXTURE_2D);
-	}
-	else { std::cout << "ERROR::TEXTURE::FAILED_TO_LOAD_TEXTURE" << std::endl; }
-	stbi_image_free(data); // free data
+	// images are decoded on worker threads and uploaded a few per frame, until then the handles bind a placeholder
+	TextureManager textures;
+	// OpenGL expects the 0.0 coordinate on the y-axis to be on the bottom side of the image, but images usually have 0.0 at the top of the y-axis,
+	// so the manager tells stb_image to flip the y-axis during loading (the flip flag of Load() defaults to true)
+	TextureHandle texture1 = textures.Load("src/assets/textures/container.jpg");
+	TextureHandle texture2 = textures.Load("src/assets/textures/awesomeface.png");
+
+	// headless runs are reproducible frame dumps, start with everything resident
+	if (options.headless)
+		textures.WaitAll();
 
 	// Unbinds
 	// note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
@@ -186,55 +308,132 @@ int main()
 	firstShader.SetInt("texture1", 0);
 	firstShader.SetInt("texture2", 1);
 
+	// draws are recorded into the queue and issued sorted by state at the end of the frame
+	RenderQueue renderQueue;
+	RenderCommand quad;
+	quad.shader = &firstShader;
+	quad.vertexArray = VAO;
+	quad.textureCount = 2;
+	quad.indexCount = 6;  // 6 indices
+	// the USE_UNIFORM_COLOR permutation animates ourColor, resolved once here
+	UniformHandle ourColor = firstShader.GetUniform("ourColor");
+	// headless runs have no GLFW timer
+	auto loopStart = std::chrono::steady_clock::now();
+
+	// frame profiler (only active with --profile-out)
+	FrameProfiler profiler(options.profilePath != NULL, { "input", "texture_upload", "shader_reload", "clear", "record_draws", "draw", "swap_buffers", "poll_events" });
+
 	// Render Loop
 	// -------------------------------------
-	while (!glfwWindowShouldClose(window))  // The glfwWindowShouldClose function checks at the start of each loop iteration if GLFW has been instructed to close
+	int frame = 0;
+	while (options.headless || !glfwWindowShouldClose(window))  // The glfwWindowShouldClose function checks at the start of each loop iteration if GLFW has been instructed to close
 	{
+		profiler.BeginFrame();
+
 		// input
 		// -----
-		processInput(window);
+		if (window)
+		{
+			profiler.BeginStage(STAGE_INPUT);
+			processInput(window);
+			profiler.EndStage(STAGE_INPUT);
+		}
+
+		// finish pending texture loads within this frame's upload budget
+		profiler.BeginStage(STAGE_TEXTURE_UPLOAD);
+		textures.Update();
+		profiler.EndStage(STAGE_TEXTURE_UPLOAD);
+
+		// start or finish rebuilding edited shaders
+		profiler.BeginStage(STAGE_SHADER_RELOAD);
+		shaderWatcher.Update();
+		profiler.EndStage(STAGE_SHADER_RELOAD);
 
 		// render
 		// ------
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		profiler.BeginStage(STAGE_CLEAR);
+		state.ClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
 		// the glClearColor function is a state-setting function and glClear is a state-using function in that it uses the current state to retrieve the clearing color from.
+		profiler.EndStage(STAGE_CLEAR);
 
-		 // bind textures on corresponding texture units
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, textureID);
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, texture2ID);
-
-		// draw our first triangle
-		firstShader.Bind();
+		// record our first triangle, its textures on the corresponding texture units (the placeholder until loaded)
+		profiler.BeginStage(STAGE_RECORD);
+		quad.textures[0] = textures.GetTexture(texture1);
+		quad.textures[1] = textures.GetTexture(texture2);
 
 		//update shader uniform
-		/*
-		double timeValue = glfwGetTime();   // returns time in seconds
-		float greenValue = static_cast<float>((sin(timeValue) / 2) + 0.5);   //sin siempre da un valor entre 0 y 1 
-		firstShader.SetFloat4("ourColor", { 0.0f, greenValue, 0.0f, 1.0f });
-		*/
-		glBindVertexArray(VAO);
+		if (options.uniformColor)
+		{
+			double timeValue = window ? glfwGetTime() : std::chrono::duration<double>(std::chrono::steady_clock::now() - loopStart).count();   // returns time in seconds
+			float greenValue = static_cast<float>((sin(timeValue) / 2) + 0.5);   //sin siempre da un valor entre 0 y 1 
+			quad.uniform = ourColor;
+			quad.uniformValue = { 0.0f, greenValue, 0.0f, 1.0f };
+		}
+		renderQueue.Submit(quad);
+		profiler.EndStage(STAGE_RECORD);
+
+		// bind what the draws need and draw them
+		profiler.BeginStage(STAGE_DRAW);
+		renderQueue.Execute();
 		//glDrawArrays(GL_TRIANGLES, 0, 3); // GL_TRIANGLES, second argument specifies the starting index of the vertex array, last argument specifies how many vertices we want to draw
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);  // 6 indices
 		// glBindVertexArray(0); // no need to unbind it every time 
+		profiler.EndStage(STAGE_DRAW);
 
 		// glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
 		// -------------------------------------------------------------------------------
-		glfwSwapBuffers(window); // will swap the color buffer (a large 2D buffer that contains color values for each pixel in GLFW's window) that is used to render to during this render iteration and show it as output to the screen
-		glfwPollEvents();       //  function checks if any events are triggered (like keyboard input or mouse movement events), updates the window state, and calls the corresponding functions (which we can register via callback methods).
+		if (window)
+		{
+			profiler.BeginStage(STAGE_SWAP);
+			glfwSwapBuffers(window); // will swap the color buffer (a large 2D buffer that contains color values for each pixel in GLFW's window) that is used to render to during this render iteration and show it as output to the screen
+			profiler.EndStage(STAGE_SWAP);
+			profiler.BeginStage(STAGE_POLL_EVENTS);
+			glfwPollEvents();       //  function checks if any events are triggered (like keyboard input or mouse movement events), updates the window state, and calls the corresponding functions (which we can register via callback methods).
+			profiler.EndStage(STAGE_POLL_EVENTS);
+		}
+		profiler.EndFrame();
+		state.EndFrame();
+		if (options.stateStats && (frame == 0 || frame + 1 == options.frames))
+			std::cout << "GL state, frame " << frame << ": " << state.GetFrameStats().issued << " calls issued, " << state.GetFrameStats().elided << " elided" << std::endl;
+
+		if (options.startupStats && frame == 0)
+		{
+			glFinish();
+			std::cout << "Startup: GL loader " << loaderMs << " ms, first frame after " << millisecondsSince(startupBegin)
+				<< " ms, peak RSS " << peakResidentKiB() << " KiB" << std::endl;
+		}
+
+		if (options.frames > 0 && ++frame >= options.frames)
+			break;
+	}
+
+	// dump the final offscreen frame
+	// ------------------------------
+	if (offscreen && options.screenshotPath)
+	{
+		glFinish();
+		std::vector<unsigned char> pixels = offscreen->ReadPixels();
+		if (WritePNG(options.screenshotPath, offscreen->Width(), offscreen->Height(), pixels.data()))
+			std::cout << "Saved frame " << frame << " to " << options.screenshotPath << std::endl;
 	}
+	offscreen.reset();
+
+	if (options.profilePath)
+		profiler.Finish(options.profilePath);
+	if (options.stateStats)
+		std::cout << "GL state, all frames: " << state.GetTotalStats().issued << " calls issued, " << state.GetTotalStats().elided << " elided" << std::endl;
 
 	// optional: de-allocate all resources once they've outlived their purpose:
 	// ------------------------------------------------------------------------
 	glDeleteVertexArrays(1, &VAO);
+	state.ForgetVertexArray(VAO);
 	glDeleteBuffers(1, &VBO);
 	glDeleteBuffers(1, &EBO);
 
 	// glfw: terminate, clearing all previously allocated GLFW resources.
    // ------------------------------------------------------------------
-	glfwTerminate();
+	if (window)
+		glfwTerminate();
 	return 0;
 }
 
@@ -256,4 +455,101 @@ void processInput(GLFWwindow* window)
 	{
 		glfwSetWindowShouldClose(window, true);
 	}
-}
\ No newline at end of file
+}
+
+// parse the command line: [--headless] [--frames N] [--screenshot file.png] [--profile-out trace.json|frames.csv] [--uniform-bench] [--jpeg-bench] [--png-bench] [--inflate-bench] [--texture-bench N] [--no-program-cache] [--program-cache-dir DIR] [--startup-stats] [--sprite-bench] [--instancing-bench] [--queue-bench] [--jobs-bench N] [--ubo-bench] [--compile-bench] [--vertex-format-bench] [--mesh-bench] [--lod-bench] [--cull-bench] [--compress-textures auto|bc1|bc3|bc7] [--container-check] [--state-stats] [--uniform-color] [--no-hot-reload]
+// ---------------------------------------------------------------------------------------------------------
+AppOptions parseArguments(int argc, char** argv)
+{
+	AppOptions options;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--headless") == 0)
+			options.headless = true;
+		else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			options.frames = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--screenshot") == 0 && i + 1 < argc)
+			options.screenshotPath = argv[++i];
+		else if (std::strcmp(argv[i], "--profile-out") == 0 && i + 1 < argc)
+			options.profilePath = argv[++i];
+		else if (std::strcmp(argv[i], "--uniform-bench") == 0)
+			options.uniformLookupBench = true;
+		else if (std::strcmp(argv[i], "--jpeg-bench") == 0)
+			options.jpegBench = true;
+		else if (std::strcmp(argv[i], "--png-bench") == 0)
+			options.pngBench = true;
+		else if (std::strcmp(argv[i], "--inflate-bench") == 0)
+			options.inflateBench = true;
+		else if (std::strcmp(argv[i], "--texture-bench") == 0 && i + 1 < argc)
+			options.textureBenchCount = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--no-program-cache") == 0)
+			options.programCache = false;
+		else if (std::strcmp(argv[i], "--program-cache-dir") == 0 && i + 1 < argc)
+			options.programCacheDir = argv[++i];
+		else if (std::strcmp(argv[i], "--startup-stats") == 0)
+			options.startupStats = true;
+		else if (std::strcmp(argv[i], "--sprite-bench") == 0)
+			options.spriteBench = true;
+		else if (std::strcmp(argv[i], "--instancing-bench") == 0)
+			options.instancingBench = true;
+		else if (std::strcmp(argv[i], "--queue-bench") == 0)
+			options.queueBench = true;
+		else if (std::strcmp(argv[i], "--jobs-bench") == 0 && i + 1 < argc)
+			options.jobsBenchThreads = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--ubo-bench") == 0)
+			options.uboBench = true;
+		else if (std::strcmp(argv[i], "--compile-bench") == 0)
+			options.compileBench = true;
+		else if (std::strcmp(argv[i], "--vertex-format-bench") == 0)
+			options.vertexFormatBench = true;
+		else if (std::strcmp(argv[i], "--mesh-bench") == 0)
+			options.meshBench = true;
+		else if (std::strcmp(argv[i], "--lod-bench") == 0)
+			options.lodBench = true;
+		else if (std::strcmp(argv[i], "--cull-bench") == 0)
+			options.cullBench = true;
+		else if (std::strcmp(argv[i], "--compress-textures") == 0 && i + 1 < argc)
+			options.compressTextures = argv[++i];
+		else if (std::strcmp(argv[i], "--container-check") == 0)
+			options.containerCheck = true;
+		else if (std::strcmp(argv[i], "--state-stats") == 0)
+			options.stateStats = true;
+		else if (std::strcmp(argv[i], "--uniform-color") == 0)
+			options.uniformColor = true;
+		else if (std::strcmp(argv[i], "--no-hot-reload") == 0)
+			options.hotReload = false;
+		else
+			std::cout << "WARNING::ARGS::UNKNOWN_ARGUMENT: " << argv[i] << std::endl;
+	}
+
+	// a headless run always ends on its own
+	if (options.headless && options.frames <= 0)
+		options.frames = 60;
+	return options;
+}
+
+// peak resident set size of the process so far, -1 where the platform offers no getrusage
+// ---------------------------------------------------------------------------------------------------------
+long peakResidentKiB()
+{
+#if defined(__APPLE__)
+	struct rusage usage;
+	return getrusage(RUSAGE_SELF, &usage) == 0 ? (long)(usage.ru_maxrss / 1024) : -1; // bytes on macOS
+#elif defined(__unix__)
+	struct rusage usage;
+	return getrusage(RUSAGE_SELF, &usage) == 0 ? (long)usage.ru_maxrss : -1;        // KiB on Linux and the BSDs
+#else
+	return -1;
+#endif
+}
+
+// directory of the running executable (from argv[0] where /proc/self/exe doesn't exist)
+// ---------------------------------------------------------------------------------------------------------
+std::string executableDirectory(const char* argv0)
+{
+	std::error_code error;
+	std::filesystem::path path = std::filesystem::read_symlink("/proc/self/exe", error);
+	if (error)
+		path = std::filesystem::absolute(argv0, error);
+	return path.parent_path().string();
+}
@@ -1,2 +1,3 @@
 #define STB_IMAGE_IMPLEMENTATION
+#define STBI_JPEG_THREADS // decode large JPEGs on all cores
 #include "stb_image.h"
\ No newline at end of file
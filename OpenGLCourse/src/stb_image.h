@@ -268,6 +268,12 @@ RECENT REVISION HISTORY:
 // (at least this is true for iOS and Android). Therefore, the NEON support is
 // toggled by a build flag: define STBI_NEON to get NEON loops.
 //
+// On x86 compilers that can target AVX2 (VC++ 2013+, GCC 5+, Clang), the
+// IDCT, YCbCr->RGB and 2x2 upsampling kernels additionally have AVX2 versions
+// that are picked at run time with CPUID/XGETBV, independent of the compiler
+// flags. They produce bit-identical results to the SSE2 kernels. Define
+// STBI_NO_AVX2 to leave them out.
+//
 // If for some reason you do not want to use any of SIMD code, or if
 // you have issues compiling it, you can disable it entirely by
 // defining STBI_NO_SIMD.
@@ -364,6 +370,27 @@ RECENT REVISION HISTORY:
 //    huge block of memory and spend disproportionate time decoding it. By
 //    default this is set to (1 << 24), which is 16777216, but that's still
 //    very big.
+//
+//  - If you define STBI_JPEG_THREADS, large JPEGs are decoded on several
+//    threads (pthreads, or Win32 threads on Windows). Entropy decoding is
+//    split at the restart markers (DRI/RSTn) when the file has them, and
+//    IDCT, upsampling and color conversion always run in row bands. The
+//    output is bit-exact with the single-threaded decoder. Call
+//    stbi_set_jpeg_threads(n) to pick the thread count (0 = one per CPU,
+//    the default; 1 = single-threaded), or stbi_set_jpeg_threads_thread(n)
+//    for the decodes of the calling thread only (e.g. 1 on the threads of
+//    a loader pool, which is already parallel). Images smaller than
+//    STBI_JPEG_THREADS_MIN_PIXELS (default 512*512) are always decoded on
+//    the calling thread.
+//    Memory: a baseline JPEG without restart markers is entropy decoded on
+//    one thread, and to run its IDCT in parallel afterwards the decoder
+//    keeps every coefficient, 2 bytes per sample, about as much again as
+//    the component planes and the output image, so peak memory roughly
+//    doubles. The kept coefficients are capped at
+//    STBI_JPEG_THREADS_MAX_DEFERRED bytes (default 64 MiB, about 22
+//    megapixels of 4:2:0 or 11 of 4:4:4); components past the cap, or whose
+//    buffer can't be allocated, get their IDCT during entropy decoding as
+//    in the single-threaded decoder, with no error.
 
 #ifndef STBI_NO_STDIO
 #include <stdio.h>
@@ -515,12 +542,31 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert);
 // flip the image vertically, so the first pixel in the output array is the bottom left
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
 
+// number of threads used to decode large JPEGs (0 = one per CPU, 1 = single-threaded);
+// only has an effect if the implementation was compiled with STBI_JPEG_THREADS
+STBIDEF void stbi_set_jpeg_threads(int thread_count);
+
+// highest JPEG kernel set (IDCT, upsampling, color conversion) the decoder may
+// use: 2 = AVX2 (the default), 1 = SSE2/NEON, 0 = plain C. A level the CPU
+// or the build doesn't support falls back to the next one down. Meant for
+// comparing the kernels; not thread-safe, set it before decoding.
+STBIDEF void stbi_set_jpeg_kernels(int max_level);
+
+// unfilter 8-bit RGB/RGBA PNG rows with SSE2/NEON (1, the default) or with
+// the byte-at-a-time loops (0); same caveats as stbi_set_jpeg_kernels
+STBIDEF void stbi_set_png_simd(int flag_true_if_simd);
+
+// inflate Huffman blocks with the 64-bit fast loop (1, the default) or only
+// with the symbol-at-a-time decoder (0); same caveats as stbi_set_jpeg_kernels
+STBIDEF void stbi_set_zlib_fast(int flag_true_if_fast);
+
 // as above, but only applies to images loaded on the thread that calls the function
 // this function is only available if your compiler supports thread-local variables;
 // calling it will fail to link if your compiler doesn't
 STBIDEF void stbi_set_unpremultiply_on_load_thread(int flag_true_if_should_unpremultiply);
 STBIDEF void stbi_convert_iphone_png_to_rgb_thread(int flag_true_if_should_convert);
 STBIDEF void stbi_set_flip_vertically_on_load_thread(int flag_true_if_should_flip);
+STBIDEF void stbi_set_jpeg_threads_thread(int thread_count);
 
 // ZLIB client - used by PNG, available for other purposes
 
@@ -748,7 +794,7 @@ static int stbi__cpuid3(void)
 
 #define STBI_SIMD_ALIGN(type, name) __declspec(align(16)) type name
 
-#if !defined(STBI_NO_JPEG) && defined(STBI_SSE2)
+#if (!defined(STBI_NO_JPEG) || !defined(STBI_NO_PNG)) && defined(STBI_SSE2)
 static int stbi__sse2_available(void)
 {
    int info3 = stbi__cpuid3();
@@ -756,10 +802,26 @@ static int stbi__sse2_available(void)
 }
 #endif
 
+#if !defined(STBI_NO_JPEG) && !defined(STBI_NO_AVX2) && _MSC_VER >= 1800 // VS2013, first with AVX2 intrinsics
+#define STBI_AVX2
+#define STBI__AVX2_FUNC
+#include <immintrin.h>
+static int stbi__cpuid(int leaf, int subleaf, int reg)
+{
+   int info[4];
+   __cpuidex(info, leaf, subleaf);
+   return info[reg];
+}
+static int stbi__xgetbv0(void)
+{
+   return (int) _xgetbv(0);
+}
+#endif
+
 #else // assume GCC-style if not VC++
 #define STBI_SIMD_ALIGN(type, name) type name __attribute__((aligned(16)))
 
-#if !defined(STBI_NO_JPEG) && defined(STBI_SSE2)
+#if (!defined(STBI_NO_JPEG) || !defined(STBI_NO_PNG)) && defined(STBI_SSE2)
 static int stbi__sse2_available(void)
 {
    // If we're even attempting to compile this on GCC/Clang, that means
@@ -769,6 +831,44 @@ static int stbi__sse2_available(void)
 }
 #endif
 
+#if !defined(STBI_NO_JPEG) && !defined(STBI_NO_AVX2) && (defined(__clang__) || __GNUC__ >= 5)
+// unlike SSE2, the AVX2 kernels are compiled with a per-function target
+// attribute and only called after the run-time check below, so the rest of
+// the file doesn't need -mavx2.
+#define STBI_AVX2
+#define STBI__AVX2_FUNC __attribute__((target("avx2")))
+#include <immintrin.h>
+#include <cpuid.h>
+static int stbi__cpuid(int leaf, int subleaf, int reg)
+{
+   unsigned int info[4];
+   if ((unsigned int) leaf > __get_cpuid_max(0, 0))
+      return 0;
+   __cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
+   return (int) info[reg];
+}
+static int stbi__xgetbv0(void)
+{
+   unsigned int eax, edx;
+   __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0)); // xgetbv
+   return (int) eax;
+}
+#endif
+
+#endif
+
+#ifdef STBI_AVX2
+static int stbi__avx2_available(void)
+{
+   // AVX needs the OS to save the upper halves of the ymm registers
+   // (CPUID.1:ECX bit 27 OSXSAVE, bit 28 AVX, then XCR0 bits 1-2 set)
+   int info2 = stbi__cpuid(1, 0, 2);
+   if ((info2 & (3 << 27)) != (3 << 27))
+      return 0;
+   if ((stbi__xgetbv0() & 6) != 6)
+      return 0;
+   return (stbi__cpuid(7, 0, 1) >> 5) & 1; // CPUID.7.0:EBX bit 5 AVX2
+}
 #endif
 #endif
 
@@ -1116,6 +1216,50 @@ STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip)
    stbi__vertically_flip_on_load_global = flag_true_if_should_flip;
 }
 
+static int stbi__jpeg_thread_count_global = 0;
+
+STBIDEF void stbi_set_jpeg_threads(int thread_count)
+{
+   stbi__jpeg_thread_count_global = thread_count;
+}
+
+static int stbi__jpeg_kernels_max = 2;
+
+STBIDEF void stbi_set_jpeg_kernels(int max_level)
+{
+   stbi__jpeg_kernels_max = max_level;
+}
+
+static int stbi__png_simd = 1;
+
+STBIDEF void stbi_set_png_simd(int flag_true_if_simd)
+{
+   stbi__png_simd = flag_true_if_simd;
+}
+
+static int stbi__zlib_fast = 1;
+
+STBIDEF void stbi_set_zlib_fast(int flag_true_if_fast)
+{
+   stbi__zlib_fast = flag_true_if_fast;
+}
+
+#ifndef STBI_THREAD_LOCAL
+#define stbi__jpeg_thread_count  stbi__jpeg_thread_count_global
+#else
+static STBI_THREAD_LOCAL int stbi__jpeg_thread_count_local, stbi__jpeg_thread_count_set;
+
+STBIDEF void stbi_set_jpeg_threads_thread(int thread_count)
+{
+   stbi__jpeg_thread_count_local = thread_count;
+   stbi__jpeg_thread_count_set = 1;
+}
+
+#define stbi__jpeg_thread_count  (stbi__jpeg_thread_count_set       \
+                                  ? stbi__jpeg_thread_count_local  \
+                                  : stbi__jpeg_thread_count_global)
+#endif // STBI_THREAD_LOCAL
+
 #ifndef STBI_THREAD_LOCAL
 #define stbi__vertically_flip_on_load  stbi__vertically_flip_on_load_global
 #else
@@ -1970,8 +2114,9 @@ typedef struct
       stbi_uc *data;
       void *raw_data, *raw_coeff;
       stbi_uc *linebuf;
-      short   *coeff;   // progressive only
+      short   *coeff;   // progressive only (or baseline with a deferred IDCT)
       int      coeff_w, coeff_h; // number of 8x8 coefficient blocks
+      int      idct_deferred;    // baseline blocks were stored in coeff, IDCT runs in stbi__jpeg_finish
    } img_comp[4];
 
    stbi__uint32   code_buffer; // jpeg entropy-coded buffer
@@ -2700,6 +2845,165 @@ static void stbi__idct_simd(stbi_uc *out, int out_stride, short data[64])
 #undef dct_pass
 }
 
+#ifdef STBI_AVX2
+// avx2 version of the integer IDCT above. the 16-bit parts and the transposes
+// stay 128 bits wide (one register per row), but every 32-bit intermediate
+// holds a whole row in one 256-bit register instead of a _l/_h pair, which
+// halves the multiply-adds and 32-bit adds/shifts. the arithmetic is the
+// same, so results are bit-identical to the sse2 and generic versions.
+static STBI__AVX2_FUNC void stbi__idct_avx2(stbi_uc *out, int out_stride, short data[64])
+{
+   __m128i row0, row1, row2, row3, row4, row5, row6, row7;
+   __m128i tmp;
+
+   // dot product constant: even elems=x, odd elems=y
+   #define dct_const(x,y)  _mm256_setr_epi16((x),(y),(x),(y),(x),(y),(x),(y),(x),(y),(x),(y),(x),(y),(x),(y))
+
+   // out(0) = c0[even]*x + c0[odd]*y   (c0, x, y 16-bit, out 32-bit)
+   // out(1) = c1[even]*x + c1[odd]*y
+   #define dct_rot(out0,out1, x,y,c0,c1) \
+      __m256i c0##xy = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16((x),(y))), _mm_unpackhi_epi16((x),(y)), 1); \
+      __m256i out0 = _mm256_madd_epi16(c0##xy, c0); \
+      __m256i out1 = _mm256_madd_epi16(c0##xy, c1)
+
+   // out = in << 12  (in 16-bit, out 32-bit)
+   #define dct_widen(out, in) \
+      __m256i out = _mm256_slli_epi32(_mm256_cvtepi16_epi32(in), 12)
+
+   // butterfly a/b, add bias, then shift by "s" and pack
+   #define dct_bfly32o(out0, out1, a,b,bias,s) \
+      { \
+         __m256i abiased = _mm256_add_epi32(a, bias); \
+         __m256i sum = _mm256_srai_epi32(_mm256_add_epi32(abiased, b), s); \
+         __m256i dif = _mm256_srai_epi32(_mm256_sub_epi32(abiased, b), s); \
+         out0 = _mm_packs_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)); \
+         out1 = _mm_packs_epi32(_mm256_castsi256_si128(dif), _mm256_extracti128_si256(dif, 1)); \
+      }
+
+   // 8-bit interleave step (for transposes)
+   #define dct_interleave8(a, b) \
+      tmp = a; \
+      a = _mm_unpacklo_epi8(a, b); \
+      b = _mm_unpackhi_epi8(tmp, b)
+
+   // 16-bit interleave step (for transposes)
+   #define dct_interleave16(a, b) \
+      tmp = a; \
+      a = _mm_unpacklo_epi16(a, b); \
+      b = _mm_unpackhi_epi16(tmp, b)
+
+   #define dct_pass(bias,shift) \
+      { \
+         /* even part */ \
+         dct_rot(t2e,t3e, row2,row6, rot0_0,rot0_1); \
+         __m128i sum04 = _mm_add_epi16(row0, row4); \
+         __m128i dif04 = _mm_sub_epi16(row0, row4); \
+         dct_widen(t0e, sum04); \
+         dct_widen(t1e, dif04); \
+         __m256i x0 = _mm256_add_epi32(t0e, t3e); \
+         __m256i x3 = _mm256_sub_epi32(t0e, t3e); \
+         __m256i x1 = _mm256_add_epi32(t1e, t2e); \
+         __m256i x2 = _mm256_sub_epi32(t1e, t2e); \
+         /* odd part */ \
+         dct_rot(y0o,y2o, row7,row3, rot2_0,rot2_1); \
+         dct_rot(y1o,y3o, row5,row1, rot3_0,rot3_1); \
+         __m128i sum17 = _mm_add_epi16(row1, row7); \
+         __m128i sum35 = _mm_add_epi16(row3, row5); \
+         dct_rot(y4o,y5o, sum17,sum35, rot1_0,rot1_1); \
+         __m256i x4 = _mm256_add_epi32(y0o, y4o); \
+         __m256i x5 = _mm256_add_epi32(y1o, y5o); \
+         __m256i x6 = _mm256_add_epi32(y2o, y5o); \
+         __m256i x7 = _mm256_add_epi32(y3o, y4o); \
+         dct_bfly32o(row0,row7, x0,x7,bias,shift); \
+         dct_bfly32o(row1,row6, x1,x6,bias,shift); \
+         dct_bfly32o(row2,row5, x2,x5,bias,shift); \
+         dct_bfly32o(row3,row4, x3,x4,bias,shift); \
+      }
+
+   __m256i rot0_0 = dct_const(stbi__f2f(0.5411961f), stbi__f2f(0.5411961f) + stbi__f2f(-1.847759065f));
+   __m256i rot0_1 = dct_const(stbi__f2f(0.5411961f) + stbi__f2f( 0.765366865f), stbi__f2f(0.5411961f));
+   __m256i rot1_0 = dct_const(stbi__f2f(1.175875602f) + stbi__f2f(-0.899976223f), stbi__f2f(1.175875602f));
+   __m256i rot1_1 = dct_const(stbi__f2f(1.175875602f), stbi__f2f(1.175875602f) + stbi__f2f(-2.562915447f));
+   __m256i rot2_0 = dct_const(stbi__f2f(-1.961570560f) + stbi__f2f( 0.298631336f), stbi__f2f(-1.961570560f));
+   __m256i rot2_1 = dct_const(stbi__f2f(-1.961570560f), stbi__f2f(-1.961570560f) + stbi__f2f( 3.072711026f));
+   __m256i rot3_0 = dct_const(stbi__f2f(-0.390180644f) + stbi__f2f( 2.053119869f), stbi__f2f(-0.390180644f));
+   __m256i rot3_1 = dct_const(stbi__f2f(-0.390180644f), stbi__f2f(-0.390180644f) + stbi__f2f( 1.501321110f));
+
+   // rounding biases in column/row passes, see stbi__idct_block for explanation.
+   __m256i bias_0 = _mm256_set1_epi32(512);
+   __m256i bias_1 = _mm256_set1_epi32(65536 + (128<<17));
+
+   // load
+   row0 = _mm_load_si128((const __m128i *) (data + 0*8));
+   row1 = _mm_load_si128((const __m128i *) (data + 1*8));
+   row2 = _mm_load_si128((const __m128i *) (data + 2*8));
+   row3 = _mm_load_si128((const __m128i *) (data + 3*8));
+   row4 = _mm_load_si128((const __m128i *) (data + 4*8));
+   row5 = _mm_load_si128((const __m128i *) (data + 5*8));
+   row6 = _mm_load_si128((const __m128i *) (data + 6*8));
+   row7 = _mm_load_si128((const __m128i *) (data + 7*8));
+
+   // column pass
+   dct_pass(bias_0, 10);
+
+   {
+      // 16bit 8x8 transpose
+      dct_interleave16(row0, row4);
+      dct_interleave16(row1, row5);
+      dct_interleave16(row2, row6);
+      dct_interleave16(row3, row7);
+
+      dct_interleave16(row0, row2);
+      dct_interleave16(row1, row3);
+      dct_interleave16(row4, row6);
+      dct_interleave16(row5, row7);
+
+      dct_interleave16(row0, row1);
+      dct_interleave16(row2, row3);
+      dct_interleave16(row4, row5);
+      dct_interleave16(row6, row7);
+   }
+
+   // row pass
+   dct_pass(bias_1, 17);
+
+   {
+      // pack, then 8bit 8x8 transpose
+      __m128i p0 = _mm_packus_epi16(row0, row1);
+      __m128i p1 = _mm_packus_epi16(row2, row3);
+      __m128i p2 = _mm_packus_epi16(row4, row5);
+      __m128i p3 = _mm_packus_epi16(row6, row7);
+
+      dct_interleave8(p0, p2);
+      dct_interleave8(p1, p3);
+
+      dct_interleave8(p0, p1);
+      dct_interleave8(p2, p3);
+
+      dct_interleave8(p0, p2);
+      dct_interleave8(p1, p3);
+
+      // store
+      _mm_storel_epi64((__m128i *) out, p0); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(p0, 0x4e)); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, p2); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(p2, 0x4e)); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, p1); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(p1, 0x4e)); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, p3); out += out_stride;
+      _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi32(p3, 0x4e));
+   }
+
+#undef dct_const
+#undef dct_rot
+#undef dct_widen
+#undef dct_bfly32o
+#undef dct_interleave8
+#undef dct_interleave16
+#undef dct_pass
+}
+#endif // STBI_AVX2
+
 #endif // STBI_SSE2
 
 #ifdef STBI_NEON
@@ -3075,53 +3379,389 @@ static void stbi__jpeg_dequantize(short *data, stbi__uint16 *dequant)
       data[i] *= dequant[i];
 }
 
-static void stbi__jpeg_finish(stbi__jpeg *z)
+#ifdef STBI_JPEG_THREADS
+// multi-threaded decoding: a minimal fork/join "parallel for" on top of the
+// native threads, plus the scan decoder that splits at restart markers.
+
+#ifndef STBI_JPEG_THREADS_MIN_PIXELS
+#define STBI_JPEG_THREADS_MIN_PIXELS (512*512)
+#endif
+
+#ifndef STBI_JPEG_THREADS_MAX_DEFERRED
+#define STBI_JPEG_THREADS_MAX_DEFERRED (64 << 20)
+#endif
+
+#define STBI__JPEG_MAX_THREADS 64
+
+#ifdef _WIN32
+#include <process.h> // _beginthreadex
+STBI_EXTERN __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+STBI_EXTERN __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+STBI_EXTERN __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+typedef void (*stbi__jpeg_task)(void *user, int index);
+
+typedef struct
 {
-   if (z->progressive) {
-      // dequantize and idct the data
-      int i,j,n;
-      for (n=0; n < z->s->img_n; ++n) {
-         int w = (z->img_comp[n].x+7) >> 3;
-         int h = (z->img_comp[n].y+7) >> 3;
-         for (j=0; j < h; ++j) {
-            for (i=0; i < w; ++i) {
-               short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
-               stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+   stbi__jpeg_task task;
+   void *user;
+   int first, step, count;
+} stbi__jpeg_worker;
+
+static void stbi__jpeg_run_worker(stbi__jpeg_worker *w)
+{
+   int i;
+   for (i = w->first; i < w->count; i += w->step)
+      w->task(w->user, i);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall stbi__jpeg_thread_main(void *w) { stbi__jpeg_run_worker((stbi__jpeg_worker *) w); return 0; }
+#else
+static void *stbi__jpeg_thread_main(void *w) { stbi__jpeg_run_worker((stbi__jpeg_worker *) w); return NULL; }
+#endif
+
+static int stbi__jpeg_cpu_count(void)
+{
+#ifdef _WIN32
+   return (int) GetActiveProcessorCount(0xffff); // ALL_PROCESSOR_GROUPS
+#else
+   long n = sysconf(_SC_NPROCESSORS_ONLN);
+   return n > 0 ? (int) n : 1;
+#endif
+}
+
+// number of threads to decode this image with, 1 if it isn't worth it
+static int stbi__jpeg_threads(stbi__jpeg *z)
+{
+   int n = stbi__jpeg_thread_count > 0 ? stbi__jpeg_thread_count : stbi__jpeg_cpu_count();
+   if ((size_t) z->s->img_x * z->s->img_y < STBI_JPEG_THREADS_MIN_PIXELS) return 1;
+   return n < 1 ? 1 : n > STBI__JPEG_MAX_THREADS ? STBI__JPEG_MAX_THREADS : n;
+}
+
+// run task(user, i) for i in [0,count) on up to 'threads' threads; task i goes to
+// thread i % threads and the calling thread does its share too. if a thread can't
+// be created its tasks simply run on the calling thread.
+static void stbi__jpeg_parallel_for(int threads, int count, stbi__jpeg_task task, void *user)
+{
+   stbi__jpeg_worker workers[STBI__JPEG_MAX_THREADS];
+#ifdef _WIN32
+   void *handles[STBI__JPEG_MAX_THREADS];
+#else
+   pthread_t handles[STBI__JPEG_MAX_THREADS];
+#endif
+   int started[STBI__JPEG_MAX_THREADS];
+   int i, n = threads < count ? threads : count;
+   if (n <= 1) {
+      for (i = 0; i < count; ++i) task(user, i);
+      return;
+   }
+   for (i = 0; i < n; ++i) {
+      workers[i].task = task;
+      workers[i].user = user;
+      workers[i].first = i;
+      workers[i].step = n;
+      workers[i].count = count;
+   }
+   for (i = 1; i < n; ++i) {
+#ifdef _WIN32
+      handles[i] = (void *) _beginthreadex(NULL, 0, stbi__jpeg_thread_main, &workers[i], 0, NULL);
+      started[i] = handles[i] != NULL;
+#else
+      started[i] = pthread_create(&handles[i], NULL, stbi__jpeg_thread_main, &workers[i]) == 0;
+#endif
+   }
+   stbi__jpeg_run_worker(&workers[0]);
+   for (i = 1; i < n; ++i) {
+      if (!started[i]) {
+         stbi__jpeg_run_worker(&workers[i]);
+         continue;
+      }
+#ifdef _WIN32
+      WaitForSingleObject(handles[i], 0xFFFFFFFF); // INFINITE
+      CloseHandle(handles[i]);
+#else
+      pthread_join(handles[i], NULL);
+#endif
+   }
+}
+
+// write a decoded baseline block: IDCT it into the component plane, or keep the
+// (already dequantized) coefficients for the parallel IDCT in stbi__jpeg_finish
+stbi_inline static void stbi__jpeg_put_block(stbi__jpeg *z, int n, int bx, int by, short data[64])
+{
+   if (z->img_comp[n].idct_deferred)
+      memcpy(z->img_comp[n].coeff + 64 * (bx + by * z->img_comp[n].coeff_w), data, 64 * sizeof(short));
+   else
+      z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*by*8+bx*8, z->img_comp[n].w2, data);
+}
+
+// decode 'count' MCUs of a baseline scan starting at MCU 'first', without any
+// restart handling (the caller hands us exactly one restart interval, or the whole scan)
+static int stbi__jpeg_decode_mcu_range(stbi__jpeg *z, int first, int count)
+{
+   STBI_SIMD_ALIGN(short, data[64]);
+   int m,k,x,y;
+   if (z->scan_n == 1) {
+      int n = z->order[0];
+      int w = (z->img_comp[n].x+7) >> 3;
+      int ha = z->img_comp[n].ha;
+      for (m=first; m < first+count; ++m) {
+         if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+         stbi__jpeg_put_block(z, n, m % w, m / w, data);
+      }
+   } else {
+      for (m=first; m < first+count; ++m) {
+         int i = m % z->img_mcu_x, j = m / z->img_mcu_x;
+         for (k=0; k < z->scan_n; ++k) {
+            int n = z->order[k];
+            int ha = z->img_comp[n].ha;
+            for (y=0; y < z->img_comp[n].v; ++y) {
+               for (x=0; x < z->img_comp[n].h; ++x) {
+                  if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+                  stbi__jpeg_put_block(z, n, i*z->img_comp[n].h + x, j*z->img_comp[n].v + y, data);
+               }
             }
          }
       }
    }
+   return 1;
 }
 
-static int stbi__process_marker(stbi__jpeg *z, int m)
+typedef struct
 {
-   int L;
-   switch (m) {
-      case STBI__MARKER_none: // no marker found
-         return stbi__err("expected marker","Corrupt JPEG");
-
-      case 0xDD: // DRI - specify restart interval
-         if (stbi__get16be(z->s) != 4) return stbi__err("bad DRI len","Corrupt JPEG");
-         z->restart_interval = stbi__get16be(z->s);
-         return 1;
+   stbi__jpeg *z;
+   stbi_uc *data;        // entropy-coded bytes of the scan, every interval followed by an RST marker
+   int *start;           // intervals+1 byte offsets into data
+   int intervals, threads, mcus;
+   const char *failure[STBI__JPEG_MAX_THREADS];
+} stbi__jpeg_scan_job;
 
-      case 0xDB: // DQT - define quantization table
-         L = stbi__get16be(z->s)-2;
-         while (L > 0) {
-            int q = stbi__get8(z->s);
-            int p = q >> 4, sixteen = (p != 0);
-            int t = q & 15,i;
-            if (p != 0 && p != 1) return stbi__err("bad DQT type","Corrupt JPEG");
-            if (t > 3) return stbi__err("bad DQT table","Corrupt JPEG");
+// one thread: decode restart intervals t, t+threads, ... with a private copy of the decoder state
+static void stbi__jpeg_scan_task(void *user, int t)
+{
+   stbi__jpeg_scan_job *job = (stbi__jpeg_scan_job *) user;
+   stbi__context s;
+   int i;
+   stbi__jpeg *z = (stbi__jpeg *) stbi__malloc(sizeof(stbi__jpeg));
+   job->failure[t] = NULL;
+   if (!z) { job->failure[t] = "outofmem"; return; }
+   memcpy(z, job->z, sizeof(stbi__jpeg));
+   z->s = &s;
+   for (i = t; i < job->intervals; i += job->threads) {
+      int first = i * job->z->restart_interval;
+      int count = job->mcus - first < job->z->restart_interval ? job->mcus - first : job->z->restart_interval;
+      if (count <= 0) break;
+      stbi__start_mem(&s, job->data + job->start[i], job->start[i+1] - job->start[i]);
+      stbi__jpeg_reset(z);
+      if (!stbi__jpeg_decode_mcu_range(z, first, count)) {
+         job->failure[t] = stbi_failure_reason() ? stbi_failure_reason() : "Corrupt JPEG";
+         break;
+      }
+   }
+   STBI_FREE(z);
+}
 
-            for (i=0; i < 64; ++i)
-               z->dequant[t][stbi__jpeg_dezigzag[i]] = (stbi__uint16)(sixteen ? stbi__get16be(z->s) : stbi__get8(z->s));
-            L -= (sixteen ? 129 : 65);
+// multi-threaded replacement for stbi__parse_entropy_coded_data on baseline scans
+static int stbi__parse_entropy_coded_data_threaded(stbi__jpeg *z, int threads)
+{
+   int n, k, mcus;
+   if (z->scan_n == 1) {
+      n = z->order[0];
+      mcus = ((z->img_comp[n].x+7) >> 3) * ((z->img_comp[n].y+7) >> 3);
+   } else {
+      mcus = z->img_mcu_x * z->img_mcu_y;
+   }
+
+   if (z->restart_interval == 0) {
+      // a single entropy-coded segment has to be decoded in order; keep the coefficients
+      // so that at least the IDCT can run in parallel once the whole image is in. they
+      // take 2 bytes per sample on top of the component planes, so a component whose
+      // coefficients would push the total past STBI_JPEG_THREADS_MAX_DEFERRED, or can't
+      // be allocated, is transformed block by block as it is decoded, as if serial
+      size_t deferred_bytes = 0;
+      for (k=0; k < z->s->img_n; ++k)
+         if (z->img_comp[k].idct_deferred)
+            deferred_bytes += (size_t) z->img_comp[k].w2 * z->img_comp[k].h2 * sizeof(short);
+      for (k=0; k < z->scan_n; ++k) {
+         size_t bytes;
+         n = z->order[k];
+         if (z->img_comp[n].idct_deferred) continue;
+         bytes = (size_t) z->img_comp[n].w2 * z->img_comp[n].h2 * sizeof(short);
+         if (deferred_bytes + bytes > STBI_JPEG_THREADS_MAX_DEFERRED) continue;
+         if (!z->img_comp[n].raw_coeff) {
+            z->img_comp[n].raw_coeff = stbi__malloc_mad3(z->img_comp[n].w2, z->img_comp[n].h2, sizeof(short), 15);
+            if (z->img_comp[n].raw_coeff == NULL) continue;
+            z->img_comp[n].coeff_w = z->img_comp[n].w2 / 8;
+            z->img_comp[n].coeff_h = z->img_comp[n].h2 / 8;
+            z->img_comp[n].coeff = (short*) (((size_t) z->img_comp[n].raw_coeff + 15) & ~15);
+            memset(z->img_comp[n].coeff, 0, bytes);
          }
-         return L==0;
-
-      case 0xC4: // DHT - define huffman table
+         deferred_bytes += bytes;
+         z->img_comp[n].idct_deferred = 1;
+      }
+      stbi__jpeg_reset(z);
+      return stbi__jpeg_decode_mcu_range(z, 0, mcus);
+   } else {
+      // split the scan at its RSTn markers; every interval starts with a reset
+      // decoder, so they can be decoded independently
+      stbi__jpeg_scan_job job;
+      int size = 0, capacity = 1 << 16, max_intervals = 64, t;
+      stbi_uc *data = (stbi_uc *) stbi__malloc(capacity);
+      int *start = (int *) stbi__malloc(max_intervals * sizeof(int));
+      if (!data || !start) { STBI_FREE(data); STBI_FREE(start); return stbi__err("outofmem", "Out of memory"); }
+      start[0] = 0;
+      job.intervals = 0;
+      z->marker = STBI__MARKER_none;
+      for (;;) {
+         int b = 0, end_interval = 0, end_scan = 0;
+         if (stbi__at_eof(z->s)) {
+            end_interval = end_scan = 1;
+         } else {
+            b = stbi__get8(z->s);
+            if (b == 0xff) {
+               int c = stbi__get8(z->s);
+               while (c == 0xff) c = stbi__get8(z->s); // consume fill bytes
+               if (c == 0) {
+                  data[size++] = 0xff; // stuffed zero, the bit reader undoes it
+                  b = 0;
+               } else if (STBI__RESTART(c)) {
+                  end_interval = 1;
+               } else {
+                  z->marker = (unsigned char) c;
+                  end_interval = end_scan = 1;
+               }
+            }
+            if (!end_interval) data[size++] = (stbi_uc) b;
+         }
+         if (end_interval) {
+            // terminate the interval with a marker, exactly what the serial decoder sees
+            data[size++] = 0xff;
+            data[size++] = 0xd0;
+            if (++job.intervals + 1 > max_intervals) {
+               int *p = (int *) STBI_REALLOC_SIZED(start, max_intervals * sizeof(int), max_intervals * 2 * sizeof(int));
+               if (!p) { STBI_FREE(data); STBI_FREE(start); return stbi__err("outofmem", "Out of memory"); }
+               start = p;
+               max_intervals *= 2;
+            }
+            start[job.intervals] = size;
+            if (end_scan) break;
+         }
+         if (size + 4 > capacity) {
+            stbi_uc *p = (stbi_uc *) STBI_REALLOC_SIZED(data, capacity, capacity * 2);
+            if (!p) { STBI_FREE(data); STBI_FREE(start); return stbi__err("outofmem", "Out of memory"); }
+            data = p;
+            capacity *= 2;
+         }
+      }
+
+      job.z = z;
+      job.data = data;
+      job.start = start;
+      job.mcus = mcus;
+      job.threads = threads;
+      stbi__jpeg_parallel_for(threads, threads, stbi__jpeg_scan_task, &job);
+      STBI_FREE(data);
+      STBI_FREE(start);
+      for (t=0; t < threads; ++t) {
+         if (job.failure[t]) {
+            stbi__g_failure_reason = job.failure[t];
+            return 0;
+         }
+      }
+      return 1;
+   }
+}
+
+typedef struct
+{
+   stbi__jpeg *z;
+   int rows[4]; // block rows per component
+} stbi__jpeg_idct_job;
+
+// IDCT one row of blocks, for one component; task index enumerates all rows of all components
+static void stbi__jpeg_idct_row_task(void *user, int index)
+{
+   stbi__jpeg_idct_job *job = (stbi__jpeg_idct_job *) user;
+   stbi__jpeg *z = job->z;
+   int i, n = 0, j = index;
+   while (j >= job->rows[n]) j -= job->rows[n++];
+   for (i=0; i < (z->img_comp[n].x+7) >> 3; ++i) {
+      short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
+      if (z->progressive)
+         stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
+      z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+   }
+}
+#endif // STBI_JPEG_THREADS
+
+static void stbi__jpeg_finish(stbi__jpeg *z)
+{
+#ifdef STBI_JPEG_THREADS
+   int threads = stbi__jpeg_threads(z);
+   if (threads > 1) {
+      // progressive images, and baseline ones whose IDCT was deferred, in parallel block rows
+      stbi__jpeg_idct_job job;
+      int n, total = 0;
+      job.z = z;
+      for (n=0; n < z->s->img_n; ++n) {
+         int deferred = z->progressive || z->img_comp[n].idct_deferred;
+         job.rows[n] = deferred ? (z->img_comp[n].y+7) >> 3 : 0;
+         total += job.rows[n];
+      }
+      stbi__jpeg_parallel_for(threads, total, stbi__jpeg_idct_row_task, &job);
+      return;
+   }
+#endif
+   if (z->progressive) {
+      // dequantize and idct the data
+      int i,j,n;
+      for (n=0; n < z->s->img_n; ++n) {
+         int w = (z->img_comp[n].x+7) >> 3;
+         int h = (z->img_comp[n].y+7) >> 3;
+         for (j=0; j < h; ++j) {
+            for (i=0; i < w; ++i) {
+               short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
+               stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
+               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+            }
+         }
+      }
+   }
+}
+
+static int stbi__process_marker(stbi__jpeg *z, int m)
+{
+   int L;
+   switch (m) {
+      case STBI__MARKER_none: // no marker found
+         return stbi__err("expected marker","Corrupt JPEG");
+
+      case 0xDD: // DRI - specify restart interval
+         if (stbi__get16be(z->s) != 4) return stbi__err("bad DRI len","Corrupt JPEG");
+         z->restart_interval = stbi__get16be(z->s);
+         return 1;
+
+      case 0xDB: // DQT - define quantization table
+         L = stbi__get16be(z->s)-2;
+         while (L > 0) {
+            int q = stbi__get8(z->s);
+            int p = q >> 4, sixteen = (p != 0);
+            int t = q & 15,i;
+            if (p != 0 && p != 1) return stbi__err("bad DQT type","Corrupt JPEG");
+            if (t > 3) return stbi__err("bad DQT table","Corrupt JPEG");
+
+            for (i=0; i < 64; ++i)
+               z->dequant[t][stbi__jpeg_dezigzag[i]] = (stbi__uint16)(sixteen ? stbi__get16be(z->s) : stbi__get8(z->s));
+            L -= (sixteen ? 129 : 65);
+         }
+         return L==0;
+
+      case 0xC4: // DHT - define huffman table
          L = stbi__get16be(z->s)-2;
          while (L > 0) {
             stbi_uc *v;
@@ -3331,6 +3971,7 @@ static int stbi__process_frame_header(stbi__jpeg *z, int scan)
       z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * 8;
       z->img_comp[i].coeff = 0;
       z->img_comp[i].raw_coeff = 0;
+      z->img_comp[i].idct_deferred = 0;
       z->img_comp[i].linebuf = NULL;
       z->img_comp[i].raw_data = stbi__malloc_mad2(z->img_comp[i].w2, z->img_comp[i].h2, 15);
       if (z->img_comp[i].raw_data == NULL)
@@ -3409,7 +4050,7 @@ static int stbi__skip_jpeg_junk_at_end(stbi__jpeg *j)
 // decode image to YCbCr format
 static int stbi__decode_jpeg_image(stbi__jpeg *j)
 {
-   int m;
+   int m, deferred = 0;
    for (m = 0; m < 4; m++) {
       j->img_comp[m].raw_data = NULL;
       j->img_comp[m].raw_coeff = NULL;
@@ -3420,6 +4061,12 @@ static int stbi__decode_jpeg_image(stbi__jpeg *j)
    while (!stbi__EOI(m)) {
       if (stbi__SOS(m)) {
          if (!stbi__process_scan_header(j)) return 0;
+#ifdef STBI_JPEG_THREADS
+         if (!j->progressive && stbi__jpeg_threads(j) > 1) {
+            if (!stbi__parse_entropy_coded_data_threaded(j, stbi__jpeg_threads(j))) return 0;
+            deferred |= j->restart_interval == 0;
+         } else
+#endif
          if (!stbi__parse_entropy_coded_data(j)) return 0;
          if (j->marker == STBI__MARKER_none ) {
          j->marker = stbi__skip_jpeg_junk_at_end(j);
@@ -3435,11 +4082,14 @@ static int stbi__decode_jpeg_image(stbi__jpeg *j)
          if (NL != j->s->img_y) return stbi__err("bad DNL height", "Corrupt JPEG");
          m = stbi__get_marker(j);
       } else {
-         if (!stbi__process_marker(j, m)) return 1;
+         if (!stbi__process_marker(j, m)) {
+            if (deferred) stbi__jpeg_finish(j); // blocks decoded so far, like the serial path
+            return 1;
+         }
          m = stbi__get_marker(j);
       }
    }
-   if (j->progressive)
+   if (j->progressive || deferred)
       stbi__jpeg_finish(j);
    return 1;
 }
@@ -3641,6 +4291,79 @@ static stbi_uc *stbi__resample_row_hv_2_simd(stbi_uc *out, stbi_uc *in_near, stb
 }
 #endif
 
+#ifdef STBI_AVX2
+// same filter as stbi__resample_row_hv_2_simd, 16 pixels per iteration
+static STBI__AVX2_FUNC stbi_uc *stbi__resample_row_hv_2_avx2(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs)
+{
+   int i=0,t0,t1;
+
+   if (w == 1) {
+      out[0] = out[1] = stbi__div4(3*in_near[0] + in_far[0] + 2);
+      return out;
+   }
+
+   t1 = 3*in_near[0] + in_far[0];
+   for (; i < ((w-1) & ~15); i += 16) {
+      // vertical filtering pass, 3*x + y = 4*x + (y - x)
+      __m256i farw  = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) (in_far + i)));
+      __m256i nearw = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) (in_near + i)));
+      __m256i diff  = _mm256_sub_epi16(farw, nearw);
+      __m256i nears = _mm256_slli_epi16(nearw, 2);
+      __m256i curr  = _mm256_add_epi16(nears, diff); // current row
+
+      // "prev"/"next" are the current row shifted by one pixel. byte shifts
+      // work per 128-bit lane in avx2, so the pixel crossing the lane
+      // boundary is brought in with alignr against the swapped halves.
+      __m256i lo0  = _mm256_permute2x128_si256(curr, curr, 0x08); // [0, curr.lo]
+      __m256i hi0  = _mm256_permute2x128_si256(curr, curr, 0x81); // [curr.hi, 0]
+      __m256i prv0 = _mm256_alignr_epi8(curr, lo0, 14);
+      __m256i nxt0 = _mm256_alignr_epi8(hi0, curr, 2);
+      __m256i prev = _mm256_insert_epi16(prv0, t1, 0);
+      __m256i next = _mm256_insert_epi16(nxt0, 3*in_near[i+16] + in_far[i+16], 15);
+
+      // horizontal filter, polyphase:
+      // even pixels = 3*cur + prev = cur*4 + (prev - cur)
+      // odd  pixels = 3*cur + next = cur*4 + (next - cur)
+      __m256i bias = _mm256_set1_epi16(8);
+      __m256i curs = _mm256_slli_epi16(curr, 2);
+      __m256i prvd = _mm256_sub_epi16(prev, curr);
+      __m256i nxtd = _mm256_sub_epi16(next, curr);
+      __m256i curb = _mm256_add_epi16(curs, bias);
+      __m256i even = _mm256_add_epi16(prvd, curb);
+      __m256i odd  = _mm256_add_epi16(nxtd, curb);
+
+      // interleave even and odd pixels, then undo scaling. the per-lane
+      // unpack/pack pair puts pixels 0-7 in the low lane and 8-15 in the
+      // high lane, which is already output order.
+      __m256i int0 = _mm256_unpacklo_epi16(even, odd);
+      __m256i int1 = _mm256_unpackhi_epi16(even, odd);
+      __m256i de0  = _mm256_srli_epi16(int0, 4);
+      __m256i de1  = _mm256_srli_epi16(int1, 4);
+      __m256i outv = _mm256_packus_epi16(de0, de1);
+      _mm256_storeu_si256((__m256i *) (out + i*2), outv);
+
+      // "previous" value for next iter
+      t1 = 3*in_near[i+15] + in_far[i+15];
+   }
+
+   t0 = t1;
+   t1 = 3*in_near[i] + in_far[i];
+   out[i*2] = stbi__div16(3*t1 + t0 + 8);
+
+   for (++i; i < w; ++i) {
+      t0 = t1;
+      t1 = 3*in_near[i]+in_far[i];
+      out[i*2-1] = stbi__div16(3*t0 + t1 + 8);
+      out[i*2  ] = stbi__div16(3*t1 + t0 + 8);
+   }
+   out[w*2-1] = stbi__div4(t1+2);
+
+   STBI_NOTUSED(hs);
+
+   return out;
+}
+#endif
+
 static stbi_uc *stbi__resample_row_generic(stbi_uc *out, stbi_uc *in_near, stbi_uc *in_far, int w, int hs)
 {
    // resample with nearest-neighbor
@@ -3815,6 +4538,71 @@ static void stbi__YCbCr_to_RGB_simd(stbi_uc *out, stbi_uc const *y, stbi_uc cons
 }
 #endif
 
+#ifdef STBI_AVX2
+// 16 pixels per iteration with the same 16-bit math as the sse2 loop; the
+// remaining pixels (and step != 4) are handed to stbi__YCbCr_to_RGB_simd.
+static STBI__AVX2_FUNC void stbi__YCbCr_to_RGB_avx2(stbi_uc *out, stbi_uc const *y, stbi_uc const *pcb, stbi_uc const *pcr, int count, int step)
+{
+   int i = 0;
+
+   if (step == 4) {
+      __m128i signflip  = _mm_set1_epi8(-0x80);
+      __m256i cr_const0 = _mm256_set1_epi16(   (short) ( 1.40200f*4096.0f+0.5f));
+      __m256i cr_const1 = _mm256_set1_epi16( - (short) ( 0.71414f*4096.0f+0.5f));
+      __m256i cb_const0 = _mm256_set1_epi16( - (short) ( 0.34414f*4096.0f+0.5f));
+      __m256i cb_const1 = _mm256_set1_epi16(   (short) ( 1.77200f*4096.0f+0.5f));
+      __m256i y_bias = _mm256_set1_epi16(128);
+      __m256i xw = _mm256_set1_epi16(255); // alpha channel
+
+      for (; i+15 < count; i += 16) {
+         // load
+         __m128i y_bytes = _mm_loadu_si128((__m128i *) (y+i));
+         __m128i cr_bytes = _mm_loadu_si128((__m128i *) (pcr+i));
+         __m128i cb_bytes = _mm_loadu_si128((__m128i *) (pcb+i));
+         __m128i cr_biased = _mm_xor_si128(cr_bytes, signflip); // -128
+         __m128i cb_biased = _mm_xor_si128(cb_bytes, signflip); // -128
+
+         // widen to short, byte in the high half (same values as the sse2 unpack)
+         __m256i yw  = _mm256_or_si256(_mm256_slli_epi16(_mm256_cvtepu8_epi16(y_bytes), 8), y_bias);
+         __m256i crw = _mm256_slli_epi16(_mm256_cvtepu8_epi16(cr_biased), 8);
+         __m256i cbw = _mm256_slli_epi16(_mm256_cvtepu8_epi16(cb_biased), 8);
+
+         // color transform
+         __m256i yws = _mm256_srli_epi16(yw, 4);
+         __m256i cr0 = _mm256_mulhi_epi16(cr_const0, crw);
+         __m256i cb0 = _mm256_mulhi_epi16(cb_const0, cbw);
+         __m256i cb1 = _mm256_mulhi_epi16(cbw, cb_const1);
+         __m256i cr1 = _mm256_mulhi_epi16(crw, cr_const1);
+         __m256i rws = _mm256_add_epi16(cr0, yws);
+         __m256i gwt = _mm256_add_epi16(cb0, yws);
+         __m256i bws = _mm256_add_epi16(yws, cb1);
+         __m256i gws = _mm256_add_epi16(gwt, cr1);
+
+         // descale
+         __m256i rw = _mm256_srai_epi16(rws, 4);
+         __m256i bw = _mm256_srai_epi16(bws, 4);
+         __m256i gw = _mm256_srai_epi16(gws, 4);
+
+         // back to byte and interleave channels, per 128-bit lane this is
+         // exactly the sse2 sequence (low lane pixels 0-7, high lane 8-15)
+         __m256i brb = _mm256_packus_epi16(rw, bw);
+         __m256i gxb = _mm256_packus_epi16(gw, xw);
+         __m256i t0 = _mm256_unpacklo_epi8(brb, gxb);
+         __m256i t1 = _mm256_unpackhi_epi8(brb, gxb);
+         __m256i o0 = _mm256_unpacklo_epi16(t0, t1); // pixels 0-3, 8-11
+         __m256i o1 = _mm256_unpackhi_epi16(t0, t1); // pixels 4-7, 12-15
+
+         // store
+         _mm256_storeu_si256((__m256i *) (out + 0), _mm256_permute2x128_si256(o0, o1, 0x20));
+         _mm256_storeu_si256((__m256i *) (out + 32), _mm256_permute2x128_si256(o0, o1, 0x31));
+         out += 64;
+      }
+   }
+
+   stbi__YCbCr_to_RGB_simd(out, y+i, pcb+i, pcr+i, count-i, step);
+}
+#endif
+
 // set up the kernels
 static void stbi__setup_jpeg(stbi__jpeg *j)
 {
@@ -3823,17 +4611,27 @@ static void stbi__setup_jpeg(stbi__jpeg *j)
    j->resample_row_hv_2_kernel = stbi__resample_row_hv_2;
 
 #ifdef STBI_SSE2
-   if (stbi__sse2_available()) {
+   if (stbi__jpeg_kernels_max >= 1 && stbi__sse2_available()) {
       j->idct_block_kernel = stbi__idct_simd;
       j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
       j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_simd;
    }
 #endif
 
+#ifdef STBI_AVX2
+   if (stbi__jpeg_kernels_max >= 2 && stbi__avx2_available()) {
+      j->idct_block_kernel = stbi__idct_avx2;
+      j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_avx2;
+      j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_avx2;
+   }
+#endif
+
 #ifdef STBI_NEON
-   j->idct_block_kernel = stbi__idct_simd;
-   j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
-   j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_simd;
+   if (stbi__jpeg_kernels_max >= 1) {
+      j->idct_block_kernel = stbi__idct_simd;
+      j->YCbCr_to_RGB_kernel = stbi__YCbCr_to_RGB_simd;
+      j->resample_row_hv_2_kernel = stbi__resample_row_hv_2_simd;
+   }
 #endif
 }
 
@@ -3860,6 +4658,158 @@ static stbi_uc stbi__blinn_8x8(stbi_uc x, stbi_uc y)
    return (stbi_uc) ((t + (t >>8)) >> 8);
 }
 
+// advance a resampler to the next output row
+stbi_inline static void stbi__resample_next_row(stbi__resample *r, int comp_y, int w2)
+{
+   if (++r->ystep >= r->vs) {
+      r->ystep = 0;
+      r->line0 = r->line1;
+      if (++r->ypos < comp_y)
+         r->line1 += w2;
+   }
+}
+
+// resample and color-convert output rows [y0,y1) into output (which points at row y0);
+// res_comp holds the resampler state for row y0 and linebuf one scratch row per component
+static void stbi__jpeg_convert_rows(stbi__jpeg *z, stbi__resample *res_comp, stbi_uc **linebuf, stbi_uc *output, int n, int decode_n, int is_rgb, unsigned int y0, unsigned int y1)
+{
+   int k;
+   unsigned int i,j;
+   stbi_uc *coutput[4] = { NULL, NULL, NULL, NULL };
+   for (j=y0; j < y1; ++j) {
+      stbi_uc *out = output + n * z->s->img_x * (j-y0);
+      for (k=0; k < decode_n; ++k) {
+         stbi__resample *r = &res_comp[k];
+         int y_bot = r->ystep >= (r->vs >> 1);
+         coutput[k] = r->resample(linebuf[k],
+                                  y_bot ? r->line1 : r->line0,
+                                  y_bot ? r->line0 : r->line1,
+                                  r->w_lores, r->hs);
+         stbi__resample_next_row(r, z->img_comp[k].y, z->img_comp[k].w2);
+      }
+      if (n >= 3) {
+         stbi_uc *y = coutput[0];
+         if (z->s->img_n == 3) {
+            if (is_rgb) {
+               for (i=0; i < z->s->img_x; ++i) {
+                  out[0] = y[i];
+                  out[1] = coutput[1][i];
+                  out[2] = coutput[2][i];
+                  out[3] = 255;
+                  out += n;
+               }
+            } else {
+               z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
+            }
+         } else if (z->s->img_n == 4) {
+            if (z->app14_color_transform == 0) { // CMYK
+               for (i=0; i < z->s->img_x; ++i) {
+                  stbi_uc m = coutput[3][i];
+                  out[0] = stbi__blinn_8x8(coutput[0][i], m);
+                  out[1] = stbi__blinn_8x8(coutput[1][i], m);
+                  out[2] = stbi__blinn_8x8(coutput[2][i], m);
+                  out[3] = 255;
+                  out += n;
+               }
+            } else if (z->app14_color_transform == 2) { // YCCK
+               z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
+               for (i=0; i < z->s->img_x; ++i) {
+                  stbi_uc m = coutput[3][i];
+                  out[0] = stbi__blinn_8x8(255 - out[0], m);
+                  out[1] = stbi__blinn_8x8(255 - out[1], m);
+                  out[2] = stbi__blinn_8x8(255 - out[2], m);
+                  out += n;
+               }
+            } else { // YCbCr + alpha?  Ignore the fourth channel for now
+               z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
+            }
+         } else
+            for (i=0; i < z->s->img_x; ++i) {
+               out[0] = out[1] = out[2] = y[i];
+               out[3] = 255; // not used if n==3
+               out += n;
+            }
+      } else {
+         if (is_rgb) {
+            if (n == 1)
+               for (i=0; i < z->s->img_x; ++i)
+                  *out++ = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+            else {
+               for (i=0; i < z->s->img_x; ++i, out += 2) {
+                  out[0] = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+                  out[1] = 255;
+               }
+            }
+         } else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
+            for (i=0; i < z->s->img_x; ++i) {
+               stbi_uc m = coutput[3][i];
+               stbi_uc r = stbi__blinn_8x8(coutput[0][i], m);
+               stbi_uc g = stbi__blinn_8x8(coutput[1][i], m);
+               stbi_uc b = stbi__blinn_8x8(coutput[2][i], m);
+               out[0] = stbi__compute_y(r, g, b);
+               out[1] = 255;
+               out += n;
+            }
+         } else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
+            for (i=0; i < z->s->img_x; ++i) {
+               out[0] = stbi__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
+               out[1] = 255;
+               out += n;
+            }
+         } else {
+            stbi_uc *y = coutput[0];
+            if (n == 1)
+               for (i=0; i < z->s->img_x; ++i) out[i] = y[i];
+            else
+               for (i=0; i < z->s->img_x; ++i) { *out++ = y[i]; *out++ = 255; }
+         }
+      }
+   }
+}
+
+#ifdef STBI_JPEG_THREADS
+typedef struct
+{
+   stbi__jpeg *z;
+   stbi__resample *res_comp; // state for row 0
+   stbi_uc *output;
+   stbi_uc *scratch;         // per band: decode_n line buffers and one output row (+1 byte)
+   size_t scratch_size;
+   int n, decode_n, is_rgb, bands;
+} stbi__jpeg_convert_job;
+
+// one band of output rows, with its own line buffers and a resampler fast-forwarded to the first row
+static void stbi__jpeg_convert_band_task(void *user, int band)
+{
+   stbi__jpeg_convert_job *job = (stbi__jpeg_convert_job *) user;
+   stbi__jpeg *z = job->z;
+   stbi__resample res_comp[4];
+   stbi_uc *linebuf[4];
+   stbi_uc *scratch = job->scratch + job->scratch_size * band;
+   stbi_uc *last_row = scratch + (size_t) job->decode_n * (z->s->img_x + 3);
+   size_t row_bytes = (size_t) job->n * z->s->img_x;
+   unsigned int j, y0 = (unsigned int) ((size_t) z->s->img_y * band / job->bands);
+   unsigned int y1 = (unsigned int) ((size_t) z->s->img_y * (band+1) / job->bands);
+   int k;
+   if (y0 == y1) return;
+   for (k=0; k < job->decode_n; ++k) {
+      res_comp[k] = job->res_comp[k];
+      linebuf[k] = scratch + (size_t) k * (z->s->img_x + 3);
+      for (j=0; j < y0; ++j)
+         stbi__resample_next_row(&res_comp[k], z->img_comp[k].y, z->img_comp[k].w2);
+   }
+   if (y1 == z->s->img_y) {
+      stbi__jpeg_convert_rows(z, res_comp, linebuf, job->output + row_bytes * y0, job->n, job->decode_n, job->is_rgb, y0, y1);
+   } else {
+      // the converters may write one byte past a row (out[3] with n == 3), which belongs to
+      // the next band; the last row goes through a scratch row to keep the bands independent
+      stbi__jpeg_convert_rows(z, res_comp, linebuf, job->output + row_bytes * y0, job->n, job->decode_n, job->is_rgb, y0, y1-1);
+      stbi__jpeg_convert_rows(z, res_comp, linebuf, last_row, job->n, job->decode_n, job->is_rgb, y1-1, y1);
+      memcpy(job->output + row_bytes * (y1-1), last_row, row_bytes);
+   }
+}
+#endif
+
 static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp)
 {
    int n, decode_n, is_rgb;
@@ -3888,9 +4838,8 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    // resample and color-convert
    {
       int k;
-      unsigned int i,j;
       stbi_uc *output;
-      stbi_uc *coutput[4] = { NULL, NULL, NULL, NULL };
+      stbi_uc *linebuf[4] = { NULL, NULL, NULL, NULL };
 
       stbi__resample res_comp[4];
 
@@ -3901,6 +4850,7 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
          // with upsample factor of 4
          z->img_comp[k].linebuf = (stbi_uc *) stbi__malloc(z->s->img_x + 3);
          if (!z->img_comp[k].linebuf) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
+         linebuf[k] = z->img_comp[k].linebuf;
 
          r->hs      = z->img_h_max / z->img_comp[k].h;
          r->vs      = z->img_v_max / z->img_comp[k].v;
@@ -3921,100 +4871,28 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
       if (!output) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
 
       // now go ahead and resample
-      for (j=0; j < z->s->img_y; ++j) {
-         stbi_uc *out = output + n * z->s->img_x * j;
-         for (k=0; k < decode_n; ++k) {
-            stbi__resample *r = &res_comp[k];
-            int y_bot = r->ystep >= (r->vs >> 1);
-            coutput[k] = r->resample(z->img_comp[k].linebuf,
-                                     y_bot ? r->line1 : r->line0,
-                                     y_bot ? r->line0 : r->line1,
-                                     r->w_lores, r->hs);
-            if (++r->ystep >= r->vs) {
-               r->ystep = 0;
-               r->line0 = r->line1;
-               if (++r->ypos < z->img_comp[k].y)
-                  r->line1 += z->img_comp[k].w2;
-            }
-         }
-         if (n >= 3) {
-            stbi_uc *y = coutput[0];
-            if (z->s->img_n == 3) {
-               if (is_rgb) {
-                  for (i=0; i < z->s->img_x; ++i) {
-                     out[0] = y[i];
-                     out[1] = coutput[1][i];
-                     out[2] = coutput[2][i];
-                     out[3] = 255;
-                     out += n;
-                  }
-               } else {
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-               }
-            } else if (z->s->img_n == 4) {
-               if (z->app14_color_transform == 0) { // CMYK
-                  for (i=0; i < z->s->img_x; ++i) {
-                     stbi_uc m = coutput[3][i];
-                     out[0] = stbi__blinn_8x8(coutput[0][i], m);
-                     out[1] = stbi__blinn_8x8(coutput[1][i], m);
-                     out[2] = stbi__blinn_8x8(coutput[2][i], m);
-                     out[3] = 255;
-                     out += n;
-                  }
-               } else if (z->app14_color_transform == 2) { // YCCK
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                  for (i=0; i < z->s->img_x; ++i) {
-                     stbi_uc m = coutput[3][i];
-                     out[0] = stbi__blinn_8x8(255 - out[0], m);
-                     out[1] = stbi__blinn_8x8(255 - out[1], m);
-                     out[2] = stbi__blinn_8x8(255 - out[2], m);
-                     out += n;
-                  }
-               } else { // YCbCr + alpha?  Ignore the fourth channel for now
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-               }
-            } else
-               for (i=0; i < z->s->img_x; ++i) {
-                  out[0] = out[1] = out[2] = y[i];
-                  out[3] = 255; // not used if n==3
-                  out += n;
-               }
+#ifdef STBI_JPEG_THREADS
+      if (stbi__jpeg_threads(z) > 1) {
+         stbi__jpeg_convert_job job;
+         job.z = z;
+         job.res_comp = res_comp;
+         job.output = output;
+         job.n = n;
+         job.decode_n = decode_n;
+         job.is_rgb = is_rgb;
+         job.bands = stbi__jpeg_threads(z);
+         job.scratch_size = (size_t) decode_n * (z->s->img_x + 3) + (size_t) n * z->s->img_x + 1;
+         job.scratch = (stbi_uc *) stbi__malloc(job.scratch_size * job.bands);
+         if (job.scratch) {
+            stbi__jpeg_parallel_for(job.bands, job.bands, stbi__jpeg_convert_band_task, &job);
+            STBI_FREE(job.scratch);
          } else {
-            if (is_rgb) {
-               if (n == 1)
-                  for (i=0; i < z->s->img_x; ++i)
-                     *out++ = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-               else {
-                  for (i=0; i < z->s->img_x; ++i, out += 2) {
-                     out[0] = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                     out[1] = 255;
-                  }
-               }
-            } else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
-               for (i=0; i < z->s->img_x; ++i) {
-                  stbi_uc m = coutput[3][i];
-                  stbi_uc r = stbi__blinn_8x8(coutput[0][i], m);
-                  stbi_uc g = stbi__blinn_8x8(coutput[1][i], m);
-                  stbi_uc b = stbi__blinn_8x8(coutput[2][i], m);
-                  out[0] = stbi__compute_y(r, g, b);
-                  out[1] = 255;
-                  out += n;
-               }
-            } else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
-               for (i=0; i < z->s->img_x; ++i) {
-                  out[0] = stbi__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
-                  out[1] = 255;
-                  out += n;
-               }
-            } else {
-               stbi_uc *y = coutput[0];
-               if (n == 1)
-                  for (i=0; i < z->s->img_x; ++i) out[i] = y[i];
-               else
-                  for (i=0; i < z->s->img_x; ++i) { *out++ = y[i]; *out++ = 255; }
-            }
+            stbi__jpeg_convert_rows(z, res_comp, linebuf, output, n, decode_n, is_rgb, 0, z->s->img_y);
          }
-      }
+      } else
+#endif
+      stbi__jpeg_convert_rows(z, res_comp, linebuf, output, n, decode_n, is_rgb, 0, z->s->img_y);
+
       stbi__cleanup_jpeg(z);
       *out_x = z->s->img_x;
       *out_y = z->s->img_y;
@@ -4166,6 +5044,26 @@ static int stbi__zbuild_huffman(stbi__zhuffman *z, const stbi_uc *sizelist, int
    return 1;
 }
 
+// decode tables for the fast inflate loop. one lookup of the next STBI__ZDEC_BITS
+// bits gives the code length, the kind of symbol and either the literal byte or
+// the length/distance base plus the number of extra bits that follow the code:
+//    bits 0-3 code length, 4-7 extra bits, 8-9 kind, 16-31 literal or base
+// zero entries (codes longer than the table, invalid symbols) take the slow path.
+#define STBI__ZDEC_BITS      10
+#define STBI__ZDEC_MASK      ((1 << STBI__ZDEC_BITS) - 1)
+#define STBI__ZDEC_LITERAL   0x100
+#define STBI__ZDEC_BASE      0x200
+#define STBI__ZDEC_END       0x300
+#define STBI__ZDEC_KIND      0x300
+
+// bit buffer of the fast loop; 64 bits hold a complete length/distance pair
+// (at most 15+5+15+13 bits) after a single refill
+#ifdef _MSC_VER
+typedef unsigned __int64 stbi__zbits;
+#else
+typedef unsigned long long stbi__zbits;
+#endif
+
 // zlib-from-memory implementation for PNG reading
 //    because PNG allows splitting the zlib stream arbitrarily,
 //    and it's annoying structurally to have PNG call ZLIB call PNG,
@@ -4184,6 +5082,7 @@ typedef struct
    int   z_expandable;
 
    stbi__zhuffman z_length, z_distance;
+   stbi__uint32 z_length_dec[1 << STBI__ZDEC_BITS], z_distance_dec[1 << STBI__ZDEC_BITS];
 } stbi__zbuf;
 
 stbi_inline static int stbi__zeof(stbi__zbuf *z)
@@ -4218,12 +5117,19 @@ stbi_inline static unsigned int stbi__zreceive(stbi__zbuf *z, int n)
    return k;
 }
 
-static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
+// decode one symbol from the next 16 bits of input (LSB first), returns -1 for
+// invalid codes. doesn't consume anything, the code length goes to *size.
+static int stbi__zhuffman_decode_bits(stbi__zhuffman *z, unsigned int bits, int *size)
 {
    int b,s,k;
+   b = z->fast[bits & STBI__ZFAST_MASK];
+   if (b) {
+      *size = b >> 9;
+      return b & 511;
+   }
    // not resolved by fast table, so compute it the slow way
    // use jpeg approach, which requires MSbits at top
-   k = stbi__bit_reverse(a->code_buffer, 16);
+   k = stbi__bit_reverse(bits & 0xffff, 16);
    for (s=STBI__ZFAST_BITS+1; ; ++s)
       if (k < z->maxcode[s])
          break;
@@ -4232,9 +5138,17 @@ static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
    b = (k >> (16-s)) - z->firstcode[s] + z->firstsymbol[s];
    if (b >= STBI__ZNSYMS) return -1; // some data was corrupt somewhere!
    if (z->size[b] != s) return -1;  // was originally an assert, but report failure instead.
+   *size = s;
+   return z->value[b];
+}
+
+static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
+{
+   int s, v = stbi__zhuffman_decode_bits(z, a->code_buffer, &s);
+   if (v < 0) return -1;
    a->code_buffer >>= s;
    a->num_bits -= s;
-   return z->value[b];
+   return v;
 }
 
 stbi_inline static int stbi__zhuffman_decode(stbi__zbuf *a, stbi__zhuffman *z)
@@ -4292,11 +5206,165 @@ static const int stbi__zdist_base[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129
 static const int stbi__zdist_extra[32] =
 { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
 
+static stbi__uint32 stbi__zdec_entry(int sym, int size, int distance)
+{
+   if (distance) {
+      if (sym >= 30) return 0; // per DEFLATE, distance codes 30 and 31 must not appear in compressed data
+      return ((stbi__uint32) stbi__zdist_base[sym] << 16) | STBI__ZDEC_BASE | (stbi__zdist_extra[sym] << 4) | size;
+   }
+   if (sym < 256)  return ((stbi__uint32) sym << 16) | STBI__ZDEC_LITERAL | size;
+   if (sym == 256) return STBI__ZDEC_END | size;
+   if (sym >= 286) return 0; // length codes 286 and 287 must not appear either
+   return ((stbi__uint32) stbi__zlength_base[sym-257] << 16) | STBI__ZDEC_BASE | (stbi__zlength_extra[sym-257] << 4) | size;
+}
+
+// fill a decode table from the canonical code built by stbi__zbuild_huffman
+static void stbi__zbuild_decode_table(stbi__uint32 *table, const stbi__zhuffman *z, int distance)
+{
+   int s;
+   memset(table, 0, sizeof(stbi__uint32) << STBI__ZDEC_BITS);
+   for (s=1; s <= STBI__ZDEC_BITS; ++s) {
+      int count = (z->maxcode[s] >> (16-s)) - z->firstcode[s];
+      int c;
+      for (c=0; c < count; ++c) {
+         int sym = z->value[z->firstsymbol[s] + c];
+         stbi__uint32 e = stbi__zdec_entry(sym, s, distance);
+         int j = stbi__bit_reverse(z->firstcode[s] + c, s);
+         for (; j < (1 << STBI__ZDEC_BITS); j += (1 << s))
+            table[j] = e;
+      }
+   }
+}
+
+stbi_inline static stbi__zbits stbi__zload64(const stbi_uc *p)
+{
+#if defined(STBI__X86_TARGET) || defined(STBI__X64_TARGET)
+   stbi__zbits v;
+   memcpy(&v, p, 8); // little endian
+   return v;
+#else
+   return  (stbi__zbits) p[0]        | ((stbi__zbits) p[1] <<  8) | ((stbi__zbits) p[2] << 16) | ((stbi__zbits) p[3] << 24) |
+          ((stbi__zbits) p[4] << 32) | ((stbi__zbits) p[5] << 40) | ((stbi__zbits) p[6] << 48) | ((stbi__zbits) p[7] << 56);
+#endif
+}
+
+// room the fast loop needs at the output: the longest match, plus up to 7
+// bytes the 8-byte copies may write past its end
+#define STBI__ZFAST_OUT_MARGIN  (258 + 8)
+
+// inner loop of stbi__parse_huffman_block for the bulk of the data. it runs
+// while at least 8 input bytes (one refill) and STBI__ZFAST_OUT_MARGIN output
+// bytes are left, so nothing in it needs bounds checks. returns 1 at the end
+// of the block, 0 on error and 2 when the caller should continue with the
+// careful one-symbol-at-a-time path.
+static int stbi__parse_huffman_block_fast(stbi__zbuf *a, char **pzout)
+{
+   stbi_uc *in = a->zbuffer;
+   char *zout = *pzout;
+   stbi__zbits bits = a->code_buffer;
+   int num_bits = a->num_bits;
+   int result = 2;
+
+   while (a->zbuffer_end - in >= 8 && a->zout_end - zout >= STBI__ZFAST_OUT_MARGIN) {
+      stbi__uint32 e;
+      int len, dist, extra;
+
+      // refill to 56..63 bits. only whole bytes are consumed; the partial
+      // byte loaded above num_bits is loaded again by the next refill.
+      bits |= stbi__zload64(in) << num_bits;
+      in += (63 - num_bits) >> 3;
+      num_bits |= 56;
+
+      e = a->z_length_dec[bits & STBI__ZDEC_MASK];
+      if (!e) {
+         int size, sym = stbi__zhuffman_decode_bits(&a->z_length, (unsigned int) bits, &size);
+         if (sym < 0 || !(e = stbi__zdec_entry(sym, size, 0))) {
+            result = stbi__err("bad huffman code","Corrupt PNG");
+            break;
+         }
+      }
+      bits >>= e & 15;
+      num_bits -= e & 15;
+      if ((e & STBI__ZDEC_KIND) == STBI__ZDEC_LITERAL) {
+         *zout++ = (char) (e >> 16);
+         continue;
+      }
+      if ((e & STBI__ZDEC_KIND) == STBI__ZDEC_END) {
+         result = 1;
+         break;
+      }
+
+      extra = (e >> 4) & 15;
+      len = (int) (e >> 16) + (int) (bits & ((1u << extra) - 1));
+      bits >>= extra;
+      num_bits -= extra;
+
+      e = a->z_distance_dec[bits & STBI__ZDEC_MASK];
+      if (!e) {
+         int size, sym = stbi__zhuffman_decode_bits(&a->z_distance, (unsigned int) bits, &size);
+         if (sym < 0 || !(e = stbi__zdec_entry(sym, size, 1))) {
+            result = stbi__err("bad huffman code","Corrupt PNG");
+            break;
+         }
+      }
+      bits >>= e & 15;
+      num_bits -= e & 15;
+      extra = (e >> 4) & 15;
+      dist = (int) (e >> 16) + (int) (bits & ((1u << extra) - 1));
+      bits >>= extra;
+      num_bits -= extra;
+      if (zout - a->zout_start < dist) {
+         result = stbi__err("bad dist","Corrupt PNG");
+         break;
+      }
+
+      {
+         char *end = zout + len;
+         if (dist == 1) { // run of one byte; common in images.
+            memset(zout, zout[-1], len);
+         } else if (dist >= 8) {
+            char *p = zout - dist;
+            do { memcpy(zout, p, 8); zout += 8; p += 8; } while (zout < end);
+         } else {
+            // short period (e.g. RGB/RGBA pixel runs): copy bytes until the
+            // pattern repeats at a distance of 8 or more, then 8 at a time
+            int period = dist;
+            char *stop;
+            while (period < 8) period += dist;
+            stop = zout + (period - dist);
+            if (stop > end) stop = end;
+            while (zout < stop) { *zout = zout[-dist]; ++zout; }
+            while (zout < end) { memcpy(zout, zout - period, 8); zout += 8; }
+         }
+         zout = end;
+      }
+   }
+
+   if (in != a->zbuffer) {
+      // give back the whole bytes still in the bit buffer, so the slow
+      // path and stored blocks see the usual <= 32 buffered bits
+      in -= num_bits >> 3;
+      num_bits &= 7;
+      a->zbuffer = in;
+      a->code_buffer = (stbi__uint32) (bits & ((1u << num_bits) - 1));
+      a->num_bits = num_bits;
+   }
+   if (result == 1)
+      a->zout = zout;
+   *pzout = zout;
+   return result;
+}
+
 static int stbi__parse_huffman_block(stbi__zbuf *a)
 {
    char *zout = a->zout;
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
+      int z;
+      if (stbi__zlib_fast && a->zbuffer_end - a->zbuffer >= 8 && a->zout_end - zout >= STBI__ZFAST_OUT_MARGIN) {
+         int r = stbi__parse_huffman_block_fast(a, &zout);
+         if (r != 2) return r;
+      }
+      z = stbi__zhuffman_decode(a, &a->z_length);
       if (z < 256) {
          if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
          if (zout >= a->zout_end) {
@@ -4382,6 +5450,8 @@ static int stbi__compute_huffman_codes(stbi__zbuf *a)
    if (n != ntot) return stbi__err("bad codelengths","Corrupt PNG");
    if (!stbi__zbuild_huffman(&a->z_length, lencodes, hlit)) return 0;
    if (!stbi__zbuild_huffman(&a->z_distance, lencodes+hlit, hdist)) return 0;
+   stbi__zbuild_decode_table(a->z_length_dec, &a->z_length, 0);
+   stbi__zbuild_decode_table(a->z_distance_dec, &a->z_distance, 1);
    return 1;
 }
 
@@ -4476,6 +5546,8 @@ static int stbi__parse_zlib(stbi__zbuf *a, int parse_header)
             // use fixed code lengths
             if (!stbi__zbuild_huffman(&a->z_length  , stbi__zdefault_length  , STBI__ZNSYMS)) return 0;
             if (!stbi__zbuild_huffman(&a->z_distance, stbi__zdefault_distance,  32)) return 0;
+            stbi__zbuild_decode_table(a->z_length_dec, &a->z_length, 0);
+            stbi__zbuild_decode_table(a->z_distance_dec, &a->z_distance, 1);
          } else {
             if (!stbi__compute_huffman_codes(a)) return 0;
          }
@@ -4644,6 +5716,190 @@ static int stbi__paeth(int a, int b, int c)
    return c;
 }
 
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+// simd unfiltering for 8-bit RGB/RGBA rows. Sub, Avg and Paeth depend on the
+// pixel to the left, so these work one pixel (3 or 4 bytes) at a time with all
+// channels in one register; Up has no such dependency and runs 16 bytes at a
+// time. results are identical to the scalar loops.
+#ifdef STBI_SSE2
+typedef __m128i stbi__png_px;
+
+// 3-byte pixels are assembled in registers: a 3-byte memcpy into an int goes
+// through the stack and the 4-byte reload can't be store-forwarded
+static stbi__png_px stbi__png_px_load(stbi_uc const *p, int n)
+{
+   int v;
+   if (n == 4) memcpy(&v, p, 4);
+   else v = p[0] | (p[1] << 8) | (p[2] << 16);
+   return _mm_cvtsi32_si128(v);
+}
+
+static void stbi__png_px_store(stbi_uc *p, stbi__png_px v, int n)
+{
+   int x = _mm_cvtsi128_si32(v);
+   if (n == 4) memcpy(p, &x, 4);
+   else { p[0] = (stbi_uc) x; p[1] = (stbi_uc) (x >> 8); p[2] = (stbi_uc) (x >> 16); }
+}
+
+#define stbi__png_px_zero()      _mm_setzero_si128()
+#define stbi__png_px_add(a,b)    _mm_add_epi8(a,b)
+#define stbi__png_px_or(a,b)     _mm_or_si128(a,b)
+#define stbi__png_px_alpha()     _mm_cvtsi32_si128((int) 0xff000000)
+
+// (a+b)>>1; pavgb rounds up, so subtract the carry of odd sums
+static stbi__png_px stbi__png_px_avg(stbi__png_px a, stbi__png_px b)
+{
+   stbi__png_px avg = _mm_avg_epu8(a, b);
+   return _mm_sub_epi8(avg, _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+}
+
+static stbi__png_px stbi__png_px_paeth(stbi__png_px a, stbi__png_px b, stbi__png_px c)
+{
+   __m128i zero = _mm_setzero_si128();
+   __m128i aw = _mm_unpacklo_epi8(a, zero);
+   __m128i bw = _mm_unpacklo_epi8(b, zero);
+   __m128i cw = _mm_unpacklo_epi8(c, zero);
+
+   // p = a+b-c, so p-a = b-c, p-b = a-c and p-c = (b-c)+(a-c)
+   __m128i pa = _mm_sub_epi16(bw, cw);
+   __m128i pb = _mm_sub_epi16(aw, cw);
+   __m128i pc = _mm_add_epi16(pa, pb);
+   pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+   pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+   pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+   // same tie-breaking as stbi__paeth: a, then b, then c
+   {
+      __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+      __m128i use_a = _mm_cmpeq_epi16(smallest, pa);
+      __m128i use_b = _mm_cmpeq_epi16(smallest, pb);
+      __m128i bc = _mm_or_si128(_mm_and_si128(use_b, bw), _mm_andnot_si128(use_b, cw));
+      __m128i abc = _mm_or_si128(_mm_and_si128(use_a, aw), _mm_andnot_si128(use_a, bc));
+      return _mm_packus_epi16(abc, abc);
+   }
+}
+
+static void stbi__png_unfilter_up16(stbi_uc *cur, stbi_uc const *prior, stbi_uc const *raw)
+{
+   __m128i r = _mm_loadu_si128((__m128i const *) raw);
+   __m128i p = _mm_loadu_si128((__m128i const *) prior);
+   _mm_storeu_si128((__m128i *) cur, _mm_add_epi8(r, p));
+}
+#else // STBI_NEON
+typedef uint8x8_t stbi__png_px;
+
+static stbi__png_px stbi__png_px_load(stbi_uc const *p, int n)
+{
+   stbi__uint32 v;
+   if (n == 4) memcpy(&v, p, 4);
+   else v = p[0] | (p[1] << 8) | (p[2] << 16);
+   return vreinterpret_u8_u32(vdup_n_u32(v));
+}
+
+static void stbi__png_px_store(stbi_uc *p, stbi__png_px v, int n)
+{
+   stbi__uint32 x = vget_lane_u32(vreinterpret_u32_u8(v), 0);
+   if (n == 4) memcpy(p, &x, 4);
+   else { p[0] = (stbi_uc) x; p[1] = (stbi_uc) (x >> 8); p[2] = (stbi_uc) (x >> 16); }
+}
+
+#define stbi__png_px_zero()      vdup_n_u8(0)
+#define stbi__png_px_add(a,b)    vadd_u8(a,b)
+#define stbi__png_px_or(a,b)     vorr_u8(a,b)
+#define stbi__png_px_alpha()     vreinterpret_u8_u32(vdup_n_u32(0xff000000))
+
+// (a+b)>>1
+static stbi__png_px stbi__png_px_avg(stbi__png_px a, stbi__png_px b)
+{
+   return vhadd_u8(a, b);
+}
+
+static stbi__png_px stbi__png_px_paeth(stbi__png_px a, stbi__png_px b, stbi__png_px c)
+{
+   uint16x8_t p1 = vaddl_u8(a, b);      // a + b
+   uint16x8_t c2 = vaddl_u8(c, c);      // c * 2
+   uint16x8_t pa = vabdl_u8(b, c);      // |p-a|
+   uint16x8_t pb = vabdl_u8(a, c);      // |p-b|
+   uint16x8_t pc = vabdq_u16(p1, c2);   // |p-c|
+   uint8x8_t use_a = vmovn_u16(vandq_u16(vcleq_u16(pa, pb), vcleq_u16(pa, pc)));
+   uint8x8_t use_b = vmovn_u16(vcleq_u16(pb, pc));
+   return vbsl_u8(use_a, a, vbsl_u8(use_b, b, c));
+}
+
+static void stbi__png_unfilter_up16(stbi_uc *cur, stbi_uc const *prior, stbi_uc const *raw)
+{
+   vst1q_u8(cur, vaddq_u8(vld1q_u8(raw), vld1q_u8(prior)));
+}
+#endif
+
+// unfilter one row of x pixels: img_n (3 or 4) bytes per pixel in raw, out_n
+// (img_n, or 4 with alpha filled in) in cur/prior. filter is already remapped
+// for the first row, so prior is not touched then.
+static void stbi__png_unfilter_row_simd(stbi_uc *cur, stbi_uc const *prior, stbi_uc const *raw, stbi__uint32 x, int filter, int img_n, int out_n)
+{
+   stbi__png_px a = stbi__png_px_zero(); // left
+   stbi__png_px c = stbi__png_px_zero(); // up-left
+   stbi__png_px b;                       // up
+   stbi__png_px alpha = img_n != out_n ? stbi__png_px_alpha() : stbi__png_px_zero();
+   stbi__uint32 i = 0;
+
+   switch (filter) {
+      case STBI__F_none:
+         if (img_n == out_n) { memcpy(cur, raw, x*img_n); break; }
+         for (; i < x; ++i, raw += img_n, cur += out_n)
+            stbi__png_px_store(cur, stbi__png_px_or(stbi__png_px_load(raw, img_n), alpha), out_n);
+         break;
+      case STBI__F_sub:
+      case STBI__F_paeth_first: // paeth(a,0,0) is always a
+         for (; i < x; ++i, raw += img_n, cur += out_n) {
+            a = stbi__png_px_add(stbi__png_px_load(raw, img_n), a);
+            stbi__png_px_store(cur, stbi__png_px_or(a, alpha), out_n);
+         }
+         break;
+      case STBI__F_up:
+         if (img_n == out_n) {
+            stbi__uint32 n = x*img_n;
+            for (; i+16 <= n; i += 16)
+               stbi__png_unfilter_up16(cur+i, prior+i, raw+i);
+            for (; i < n; ++i)
+               cur[i] = STBI__BYTECAST(raw[i] + prior[i]);
+            break;
+         }
+         for (; i < x; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            b = stbi__png_px_add(stbi__png_px_load(raw, img_n), stbi__png_px_load(prior, out_n));
+            stbi__png_px_store(cur, stbi__png_px_or(b, alpha), out_n);
+         }
+         break;
+      case STBI__F_avg:
+         for (; i < x; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            b = stbi__png_px_load(prior, out_n);
+            a = stbi__png_px_add(stbi__png_px_load(raw, img_n), stbi__png_px_avg(a, b));
+            stbi__png_px_store(cur, stbi__png_px_or(a, alpha), out_n);
+         }
+         break;
+      case STBI__F_avg_first:
+         for (; i < x; ++i, raw += img_n, cur += out_n) {
+            a = stbi__png_px_add(stbi__png_px_load(raw, img_n), stbi__png_px_avg(a, c));
+            stbi__png_px_store(cur, stbi__png_px_or(a, alpha), out_n);
+         }
+         break;
+      case STBI__F_paeth:
+         for (; i < x; ++i, raw += img_n, cur += out_n, prior += out_n) {
+            b = stbi__png_px_load(prior, out_n);
+            a = stbi__png_px_add(stbi__png_px_load(raw, img_n), stbi__png_px_paeth(a, b, c));
+            c = b;
+            stbi__png_px_store(cur, stbi__png_px_or(a, alpha), out_n);
+         }
+         break;
+   }
+}
+
+#undef stbi__png_px_zero
+#undef stbi__png_px_add
+#undef stbi__png_px_or
+#undef stbi__png_px_alpha
+#endif // STBI_SSE2 || STBI_NEON
+
 static const stbi_uc stbi__depth_scale_table[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
 // create the png data from post-deflated data
@@ -4659,6 +5915,11 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
    int output_bytes = out_n*bytes;
    int filter_bytes = img_n*bytes;
    int width = x;
+#if defined(STBI_SSE2)
+   int simd = depth == 8 && img_n >= 3 && stbi__png_simd && stbi__sse2_available();
+#elif defined(STBI_NEON)
+   int simd = depth == 8 && img_n >= 3 && stbi__png_simd;
+#endif
 
    STBI_ASSERT(out_n == s->img_n || out_n == s->img_n+1);
    a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
@@ -4692,6 +5953,14 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
       // if first row, use special filter that doesn't sample previous row
       if (j == 0) filter = first_row_filter[filter];
 
+#if defined(STBI_SSE2) || defined(STBI_NEON)
+      if (simd) {
+         stbi__png_unfilter_row_simd(cur, prior, raw, x, filter, img_n, out_n);
+         raw += x*img_n;
+         continue;
+      }
+#endif
+
       // handle first byte explicitly
       for (k=0; k < filter_bytes; ++k) {
          switch (filter) {
@@ -5200,9 +6469,22 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (scan != STBI__SCAN_load) return 1;
             if (z->idata == NULL) return stbi__err("no IDAT","Corrupt PNG");
-            // initial guess for decoded data size to avoid unnecessary reallocs
+            // exact decoded data size from the header, so inflate never has to realloc
             bpl = (s->img_x * z->depth + 7) / 8; // bytes per line, per component
             raw_len = bpl * s->img_y * s->img_n /* pixels */ + s->img_y /* filter mode per row */;
+            if (interlace) {
+               // sum of the 7 Adam7 passes, each with its own filter bytes and row padding
+               static const int xorig[] = { 0,4,0,2,0,1,0 }, xspc[] = { 8,8,4,4,2,2,1 };
+               static const int yorig[] = { 0,0,4,0,2,0,1 }, yspc[] = { 8,8,8,4,4,2,2 };
+               int p;
+               raw_len = 0;
+               for (p=0; p < 7; ++p) {
+                  stbi__uint32 x = (s->img_x - xorig[p] + xspc[p]-1) / xspc[p];
+                  stbi__uint32 y = (s->img_y - yorig[p] + yspc[p]-1) / yspc[p];
+                  if (x && y)
+                     raw_len += (((s->img_n * x * z->depth) + 7) / 8 + 1) * y;
+               }
+            }
             z->expanded = (stbi_uc *) stbi_zlib_decode_malloc_guesssize_headerflag((char *) z->idata, ioff, raw_len, (int *) &raw_len, !is_iphone);
             if (z->expanded == NULL) return 0; // zlib should set error
             STBI_FREE(z->idata); z->idata = NULL;